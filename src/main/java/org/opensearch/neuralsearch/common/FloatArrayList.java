@@ -0,0 +1,119 @@
+/*
+ * Copyright OpenSearch Contributors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+package org.opensearch.neuralsearch.common;
+
+import lombok.NonNull;
+
+import java.util.AbstractList;
+import java.util.Arrays;
+import java.util.List;
+import java.util.Objects;
+import java.util.RandomAccess;
+
+/**
+ * List of floats backed by a primitive float array. Embeddings are kept in this list from the model response
+ * to the ingest document and the query, so a vector takes four bytes per dimension instead of a boxed Float per
+ * dimension. Values are only boxed when they are read through the {@link List} interface, e.g. when the
+ * document source is serialized. It is a regular mutable list, so ingest processors can work with it like with any
+ * list value of a document. Null elements are not supported.
+ */
+public final class FloatArrayList extends AbstractList<Float> implements RandomAccess {
+    private float[] values;
+    private int size;
+
+    /**
+     * Wraps an array without copying it. The caller must not modify the array afterwards.
+     *
+     * @param values the values of the list
+     */
+    public FloatArrayList(@NonNull float[] values) {
+        this.values = values;
+        this.size = values.length;
+    }
+
+    /**
+     * Creates a list of the float values of numbers
+     *
+     * @param numbers the numbers
+     * @return the list
+     */
+    public static FloatArrayList fromNumbers(@NonNull Number[] numbers) {
+        float[] values = new float[numbers.length];
+        for (int i = 0; i < numbers.length; i++) {
+            values[i] = numbers[i].floatValue();
+        }
+        return new FloatArrayList(values);
+    }
+
+    /**
+     * Creates a list of the float values of a list of numbers
+     *
+     * @param numbers the numbers
+     * @return the list
+     */
+    public static FloatArrayList fromNumbers(@NonNull List<?> numbers) {
+        float[] values = new float[numbers.size()];
+        for (int i = 0; i < values.length; i++) {
+            values[i] = ((Number) numbers.get(i)).floatValue();
+        }
+        return new FloatArrayList(values);
+    }
+
+    /**
+     * @param index index of the value
+     * @return the value without boxing
+     */
+    public float getFloat(int index) {
+        Objects.checkIndex(index, size);
+        return values[index];
+    }
+
+    /**
+     * @return a copy of the values
+     */
+    public float[] toFloatArray() {
+        return Arrays.copyOf(values, size);
+    }
+
+    @Override
+    public Float get(int index) {
+        return getFloat(index);
+    }
+
+    @Override
+    public Float set(int index, @NonNull Float value) {
+        Objects.checkIndex(index, size);
+        float previous = values[index];
+        values[index] = value;
+        return previous;
+    }
+
+    @Override
+    public void add(int index, @NonNull Float value) {
+        Objects.checkIndex(index, size + 1);
+        if (size == values.length) {
+            values = Arrays.copyOf(values, Math.max(8, size + (size >> 1)));
+        }
+        System.arraycopy(values, index, values, index + 1, size - index);
+        values[index] = value;
+        size++;
+        modCount++;
+    }
+
+    @Override
+    public Float remove(int index) {
+        Objects.checkIndex(index, size);
+        float previous = values[index];
+        System.arraycopy(values, index + 1, values, index, size - index - 1);
+        size--;
+        modCount++;
+        return previous;
+    }
+
+    @Override
+    public int size() {
+        return size;
+    }
+}
@@ -22,6 +22,10 @@ public class VectorUtil {
      * @return array of floats produced from input list
      */
     public static float[] vectorAsListToArray(List<Number> vectorAsList) {
+        if ((List<?>) vectorAsList instanceof FloatArrayList floatArrayList) {
+            // the list may be shared, e.g. by the inference result cache, so the caller gets a copy
+            return floatArrayList.toFloatArray();
+        }
         float[] vector = new float[vectorAsList.size()];
         for (int i = 0; i < vectorAsList.size(); i++) {
             vector[i] = vectorAsList.get(i).floatValue();
@@ -29,6 +29,7 @@ public final class HybridQueryExecutor {
     private static final Integer MIN_THREAD_SIZE = 2;
     private static final Integer PROCESSOR_COUNT_MULTIPLIER = 2;
     private static TaskExecutor taskExecutor;
+    private static volatile boolean parallelSubQueryScoringEnabled;
 
     /**
      * Provide fixed executor builder to use for hybrid query executors
@@ -68,6 +69,21 @@ public final class HybridQueryExecutor {
         return taskExecutor != null ? taskExecutor : new TaskExecutor(Runnable::run);
     }
 
+    /**
+     * Enable or disable scoring the sub-queries of a hybrid query in parallel within a segment
+     * @param enabled true to score every sub-query over a segment in its own task
+     */
+    public static void setParallelSubQueryScoringEnabled(final boolean enabled) {
+        parallelSubQueryScoringEnabled = enabled;
+    }
+
+    /**
+     * @return true if the sub-queries of a hybrid query are scored in parallel within a segment
+     */
+    public static boolean isParallelSubQueryScoringEnabled() {
+        return parallelSubQueryScoringEnabled;
+    }
+
     @PackagePrivate
     public static String getThreadPoolName() {
         return HYBRID_QUERY_EXEC_THREAD_POOL_NAME;
@@ -0,0 +1,348 @@
+/*
+ * Copyright OpenSearch Contributors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+package org.opensearch.neuralsearch.ml;
+
+import com.google.common.annotations.VisibleForTesting;
+import lombok.NonNull;
+import lombok.extern.log4j.Log4j2;
+import org.opensearch.ExceptionsHelper;
+import org.opensearch.common.util.concurrent.AbstractRunnable;
+import org.opensearch.common.util.concurrent.ThreadContext;
+import org.opensearch.core.action.ActionListener;
+import org.opensearch.core.concurrency.OpenSearchRejectedExecutionException;
+import org.opensearch.core.rest.RestStatus;
+import org.opensearch.neuralsearch.stats.events.EventStatName;
+import org.opensearch.neuralsearch.stats.events.EventStatsManager;
+import org.opensearch.threadpool.ThreadPool;
+
+import java.util.ArrayDeque;
+import java.util.ArrayList;
+import java.util.List;
+import java.util.Locale;
+import java.util.Map;
+import java.util.Queue;
+import java.util.concurrent.ConcurrentHashMap;
+import java.util.concurrent.atomic.AtomicBoolean;
+import java.util.function.Consumer;
+import java.util.function.LongSupplier;
+import java.util.function.Supplier;
+
+/**
+ * Node level dispatcher of ML inference calls that bounds the number of in-flight calls per model.
+ * Calls beyond the limit wait in a bounded per-model queue and are rejected once the queue is full, so bursts of bulk
+ * ingestion put back-pressure on the caller instead of overloading the model or its remote connector.
+ * With adaptive concurrency the limit of a model follows AIMD: it grows by one per round of successful calls and is
+ * halved when the model throttles a call, bounded by the maximum. Latency is not a congestion signal, calls of one model
+ * range from single query texts to large ingest batches, so their latencies vary without any congestion.
+ * A queued call keeps the thread context of the request that submitted it and is started on the generic thread pool,
+ * not on the transport or ML response thread that freed its slot.
+ */
+@Log4j2
+public class InferenceDispatcher {
+    private static final double DECREASE_FACTOR = 0.5;
+
+    private static volatile InferenceDispatcher INSTANCE;
+
+    private final Map<String, ModelLimiter> limiters = new ConcurrentHashMap<>();
+    private final LongSupplier nanoTime;
+    private volatile ThreadPool threadPool;
+    private volatile int maxInFlight;
+    private volatile int maxQueueSize;
+    private volatile boolean adaptive;
+
+    @VisibleForTesting
+    InferenceDispatcher(int maxInFlight, int maxQueueSize, boolean adaptive, @NonNull LongSupplier nanoTime) {
+        this.maxInFlight = maxInFlight;
+        this.maxQueueSize = maxQueueSize;
+        this.adaptive = adaptive;
+        this.nanoTime = nanoTime;
+    }
+
+    public static InferenceDispatcher getInstance() {
+        if (INSTANCE == null) {
+            synchronized (InferenceDispatcher.class) {
+                if (INSTANCE == null) {
+                    INSTANCE = new InferenceDispatcher(0, 0, false, System::nanoTime);
+                }
+            }
+        }
+        return INSTANCE;
+    }
+
+    /**
+     * Initializes the thread pool queued calls are started on
+     * @param threadPool ThreadPool of the node
+     */
+    public void initialize(@NonNull ThreadPool threadPool) {
+        this.threadPool = threadPool;
+    }
+
+    /**
+     * @param maxInFlight maximum number of in-flight inference calls per model, zero disables the dispatcher
+     */
+    public void setMaxInFlight(int maxInFlight) {
+        this.maxInFlight = maxInFlight;
+        limiters.values().forEach(ModelLimiter::drain);
+    }
+
+    /**
+     * @param maxQueueSize maximum number of inference calls per model waiting for a free slot
+     */
+    public void setMaxQueueSize(int maxQueueSize) {
+        this.maxQueueSize = maxQueueSize;
+    }
+
+    /**
+     * @param adaptive whether the in-flight limit of a model adapts to throttling of its calls
+     */
+    public void setAdaptive(boolean adaptive) {
+        this.adaptive = adaptive;
+        limiters.values().forEach(ModelLimiter::drain);
+    }
+
+    /**
+     * Runs an inference call of a model once the model has a free slot. The call must complete the listener passed to
+     * it exactly once, which frees the slot.
+     *
+     * @param modelId id of the model
+     * @param listener listener of the inference, failed with a {@link OpenSearchRejectedExecutionException} if the queue is full
+     * @param call the inference call
+     * @param <T> type of the inference result
+     */
+    public <T> void dispatch(@NonNull String modelId, @NonNull ActionListener<T> listener, @NonNull Consumer<ActionListener<T>> call) {
+        if (maxInFlight <= 0) {
+            call.accept(listener);
+            return;
+        }
+        ModelLimiter limiter = limiters.computeIfAbsent(modelId, ModelLimiter::new);
+        limiter.submit(() -> {
+            ActionListener<T> releasingListener = new ReleasingListener<>(limiter, nanoTime.getAsLong(), listener);
+            try {
+                call.accept(releasingListener);
+            } catch (Exception e) {
+                releasingListener.onFailure(e);
+            }
+        }, listener::onFailure);
+    }
+
+    /**
+     * @param modelId id of the model
+     * @return the current in-flight limit of the model
+     */
+    public int currentLimit(@NonNull String modelId) {
+        ModelLimiter limiter = limiters.get(modelId);
+        return limiter == null ? maxInFlight : limiter.effectiveLimit();
+    }
+
+    /**
+     * Drops the state of all models
+     */
+    @VisibleForTesting
+    void reset() {
+        limiters.clear();
+    }
+
+    private static boolean isThrottled(Exception e) {
+        return ExceptionsHelper.status(ExceptionsHelper.unwrapCause(e)) == RestStatus.TOO_MANY_REQUESTS;
+    }
+
+    /**
+     * Frees the slot of a call when the call completes, before the result is handed to the caller.
+     * A slot is freed only once, even if handling the result fails and the failure is reported to this listener.
+     */
+    private class ReleasingListener<T> implements ActionListener<T> {
+        private final ModelLimiter limiter;
+        private final long startNanos;
+        private final ActionListener<T> delegate;
+        private final AtomicBoolean released = new AtomicBoolean();
+
+        ReleasingListener(ModelLimiter limiter, long startNanos, ActionListener<T> delegate) {
+            this.limiter = limiter;
+            this.startNanos = startNanos;
+            this.delegate = delegate;
+        }
+
+        @Override
+        public void onResponse(T result) {
+            release(false);
+            delegate.onResponse(result);
+        }
+
+        @Override
+        public void onFailure(Exception e) {
+            release(isThrottled(e));
+            delegate.onFailure(e);
+        }
+
+        private void release(boolean throttled) {
+            if (released.compareAndSet(false, true)) {
+                limiter.release(startNanos, throttled);
+            }
+        }
+    }
+
+    /**
+     * In-flight calls, queued calls and the adaptive limit of one model. All state is guarded by the limiter itself,
+     * calls are started outside the lock.
+     */
+    private class ModelLimiter {
+        private final String modelId;
+        private final Queue<AbstractRunnable> queue = new ArrayDeque<>();
+        private int inFlight;
+        private double limit;
+        private long lastDecreaseNanos;
+        private boolean decreased;
+
+        ModelLimiter(String modelId) {
+            this.modelId = modelId;
+            this.limit = maxInFlight;
+        }
+
+        void submit(Runnable task, Consumer<Exception> onRejected) {
+            final int rejectedInFlight;
+            synchronized (this) {
+                if (inFlight < effectiveLimit()) {
+                    inFlight++;
+                    rejectedInFlight = -1;
+                } else if (queue.size() < maxQueueSize) {
+                    queue.add(new QueuedCall(this, task, onRejected));
+                    EventStatsManager.increment(EventStatName.INFERENCE_DISPATCHER_QUEUED_REQUESTS);
+                    return;
+                } else {
+                    rejectedInFlight = inFlight;
+                }
+            }
+            if (rejectedInFlight < 0) {
+                task.run();
+                return;
+            }
+            EventStatsManager.increment(EventStatName.INFERENCE_DISPATCHER_REJECTIONS);
+            onRejected.accept(
+                new OpenSearchRejectedExecutionException(
+                    String.format(
+                        Locale.ROOT,
+                        "too many concurrent inference requests for model [%s], in flight [%d], queue size [%d]",
+                        modelId,
+                        rejectedInFlight,
+                        maxQueueSize
+                    )
+                )
+            );
+        }
+
+        void release(long startNanos, boolean throttled) {
+            synchronized (this) {
+                inFlight--;
+                if (adaptive) {
+                    adapt(startNanos, throttled);
+                }
+            }
+            drain();
+        }
+
+        /**
+         * Frees the slot of a queued call that could not be started
+         */
+        void releaseRejected() {
+            synchronized (this) {
+                inFlight--;
+            }
+            drain();
+        }
+
+        /**
+         * Starts queued calls while the model has free slots. The calls are forked to the generic thread pool, so they do
+         * not run on the thread that freed the slot.
+         */
+        void drain() {
+            List<AbstractRunnable> tasks = new ArrayList<>();
+            synchronized (this) {
+                while (inFlight < effectiveLimit() && queue.isEmpty() == false) {
+                    inFlight++;
+                    tasks.add(queue.poll());
+                }
+            }
+            ThreadPool pool = threadPool;
+            for (AbstractRunnable task : tasks) {
+                if (pool == null) {
+                    task.run();
+                } else {
+                    pool.executor(ThreadPool.Names.GENERIC).execute(task);
+                }
+            }
+        }
+
+        synchronized int effectiveLimit() {
+            int max = maxInFlight;
+            if (max <= 0) {
+                return Integer.MAX_VALUE;
+            }
+            return adaptive ? Math.max(1, Math.min(max, (int) limit)) : max;
+        }
+
+        private void adapt(long startNanos, boolean throttled) {
+            int max = maxInFlight;
+            if (max <= 0) {
+                return;
+            }
+            if (throttled) {
+                // calls started before the last decrease were sent at the old limit and report the same congestion
+                if (decreased == false || startNanos > lastDecreaseNanos) {
+                    decreased = true;
+                    lastDecreaseNanos = nanoTime.getAsLong();
+                    limit = Math.max(1, Math.min(limit, max) * DECREASE_FACTOR);
+                    EventStatsManager.increment(EventStatName.INFERENCE_DISPATCHER_LIMIT_DECREASES);
+                    log.debug("Decreased inference concurrency of model [{}] to [{}]", modelId, (int) limit);
+                }
+            } else {
+                // grows the limit by about one per round of successful calls
+                limit = Math.min(max, limit + 1 / Math.max(1, limit));
+            }
+        }
+    }
+
+    /**
+     * A call waiting for a free slot of its model. It captures the thread context of the submitting request, including
+     * its security user, and restores it when the call is started or rejected. The slot of a rejected call is freed again.
+     */
+    private class QueuedCall extends AbstractRunnable {
+        private final ModelLimiter limiter;
+        private final Runnable task;
+        private final Consumer<Exception> onRejected;
+        private final Supplier<ThreadContext.StoredContext> context;
+
+        QueuedCall(ModelLimiter limiter, Runnable task, Consumer<Exception> onRejected) {
+            ThreadPool pool = threadPool;
+            this.limiter = limiter;
+            this.task = task;
+            this.onRejected = onRejected;
+            this.context = pool == null ? null : pool.getThreadContext().newRestorableContext(false);
+        }
+
+        @Override
+        protected void doRun() {
+            try (ThreadContext.StoredContext ignored = restoreContext()) {
+                task.run();
+            }
+        }
+
+        @Override
+        public void onRejection(Exception e) {
+            limiter.releaseRejected();
+            onFailure(e);
+        }
+
+        @Override
+        public void onFailure(Exception e) {
+            try (ThreadContext.StoredContext ignored = restoreContext()) {
+                onRejected.accept(e);
+            }
+        }
+
+        private ThreadContext.StoredContext restoreContext() {
+            return context == null ? () -> {} : context.get();
+        }
+    }
+}
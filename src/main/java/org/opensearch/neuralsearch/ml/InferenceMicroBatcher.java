@@ -0,0 +1,270 @@
+/*
+ * Copyright OpenSearch Contributors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+package org.opensearch.neuralsearch.ml;
+
+import com.google.common.annotations.VisibleForTesting;
+import lombok.NonNull;
+import org.opensearch.core.action.ActionListener;
+import org.opensearch.neuralsearch.stats.events.EventStatName;
+import org.opensearch.neuralsearch.stats.events.EventStatsManager;
+
+import java.util.ArrayList;
+import java.util.Arrays;
+import java.util.List;
+import java.util.Locale;
+import java.util.concurrent.atomic.AtomicBoolean;
+import java.util.concurrent.atomic.AtomicInteger;
+import java.util.function.BiConsumer;
+import java.util.function.Consumer;
+
+/**
+ * Splits the texts of an ingest inference into micro-batches and dispatches them concurrently.
+ * Models pad every text of a request to the longest one, so one long text makes the whole request expensive.
+ * A micro-batch is closed once its padded size, i.e. its number of texts times the approximate token count of its
+ * longest text, would exceed the token budget, or once it holds the maximum number of texts. Texts sorted by length
+ * give the tightest micro-batches. Results are reassembled in the order of the texts.
+ * The number of micro-batches of one inference in flight at a time can be bounded.
+ */
+public class InferenceMicroBatcher {
+    // Rough number of characters per token of common tokenizers, only used to estimate the size of a request
+    private static final int APPROXIMATE_CHARS_PER_TOKEN = 4;
+
+    private static volatile InferenceMicroBatcher INSTANCE;
+
+    private volatile int maxTokensPerRequest;
+    private volatile int maxTextsPerRequest;
+    private volatile int maxConcurrentMicroBatches;
+
+    @VisibleForTesting
+    InferenceMicroBatcher(int maxTokensPerRequest, int maxTextsPerRequest, int maxConcurrentMicroBatches) {
+        this.maxTokensPerRequest = maxTokensPerRequest;
+        this.maxTextsPerRequest = maxTextsPerRequest;
+        this.maxConcurrentMicroBatches = maxConcurrentMicroBatches;
+    }
+
+    public static InferenceMicroBatcher getInstance() {
+        if (INSTANCE == null) {
+            synchronized (InferenceMicroBatcher.class) {
+                if (INSTANCE == null) {
+                    INSTANCE = new InferenceMicroBatcher(0, 0, 0);
+                }
+            }
+        }
+        return INSTANCE;
+    }
+
+    /**
+     * @param maxTokensPerRequest approximate padded token budget of one inference request, zero means unbounded
+     */
+    public void setMaxTokensPerRequest(int maxTokensPerRequest) {
+        this.maxTokensPerRequest = maxTokensPerRequest;
+    }
+
+    /**
+     * @param maxTextsPerRequest maximum number of texts of one inference request, zero means unbounded
+     */
+    public void setMaxTextsPerRequest(int maxTextsPerRequest) {
+        this.maxTextsPerRequest = maxTextsPerRequest;
+    }
+
+    /**
+     * @param maxConcurrentMicroBatches maximum number of micro-batches of one inference in flight at a time, zero means unbounded
+     */
+    public void setMaxConcurrentMicroBatches(int maxConcurrentMicroBatches) {
+        this.maxConcurrentMicroBatches = maxConcurrentMicroBatches;
+    }
+
+    /**
+     * Runs the inference of the texts in micro-batches. If the texts fit into one micro-batch, the inference is called
+     * once with all texts and its results are passed through unchanged.
+     *
+     * @param texts texts to infer, preferably sorted by length
+     * @param inference runs the inference of a micro-batch and completes the listener with one result per text
+     * @param onResponse receives one result per text in the order of the texts
+     * @param onFailure receives the first failure of any micro-batch
+     */
+    public void execute(
+        @NonNull List<String> texts,
+        @NonNull BiConsumer<List<String>, ActionListener<List<?>>> inference,
+        @NonNull Consumer<List<?>> onResponse,
+        @NonNull Consumer<Exception> onFailure
+    ) {
+        List<List<String>> microBatches = split(texts);
+        // guards the handlers, so a failure after the response was handled does not complete the inference twice
+        AtomicBoolean completed = new AtomicBoolean();
+        if (microBatches.size() <= 1) {
+            dispatch(texts, inference, new ActionListener<>() {
+                @Override
+                public void onResponse(List<?> results) {
+                    if (completed.compareAndSet(false, true)) {
+                        onResponse.accept(results);
+                    }
+                }
+
+                @Override
+                public void onFailure(Exception e) {
+                    if (completed.compareAndSet(false, true)) {
+                        onFailure.accept(e);
+                    }
+                }
+            });
+            return;
+        }
+        EventStatsManager.add(EventStatName.INGEST_INFERENCE_MICRO_BATCHES, microBatches.size());
+        new MicroBatchExecution(texts.size(), microBatches, inference, onResponse, onFailure, completed).start(maxConcurrentMicroBatches);
+    }
+
+    private static void dispatch(
+        List<String> texts,
+        BiConsumer<List<String>, ActionListener<List<?>>> inference,
+        ActionListener<List<?>> listener
+    ) {
+        try {
+            inference.accept(texts, listener);
+        } catch (Exception e) {
+            listener.onFailure(e);
+        }
+    }
+
+    /**
+     * Greedily splits texts into micro-batches in their order. The padded size of a micro-batch is its number of texts
+     * times the tokens of its longest text. A text that exceeds the budget on its own forms a micro-batch by itself.
+     */
+    @VisibleForTesting
+    List<List<String>> split(List<String> texts) {
+        int maxTokens = maxTokensPerRequest;
+        int maxTexts = maxTextsPerRequest;
+        if ((maxTokens <= 0 && maxTexts <= 0) || texts.size() <= 1) {
+            return List.of(texts);
+        }
+        List<List<String>> microBatches = new ArrayList<>();
+        int start = 0;
+        int batchMaxTokens = 0;
+        for (int i = 0; i < texts.size(); i++) {
+            int batchSize = i - start + 1;
+            int textTokens = approximateTokens(texts.get(i));
+            int paddedTokens = Math.max(batchMaxTokens, textTokens);
+            boolean exceedsTexts = maxTexts > 0 && batchSize > maxTexts;
+            boolean exceedsTokens = maxTokens > 0 && (long) batchSize * paddedTokens > maxTokens;
+            if (batchSize > 1 && (exceedsTexts || exceedsTokens)) {
+                microBatches.add(texts.subList(start, i));
+                start = i;
+                paddedTokens = textTokens;
+            }
+            batchMaxTokens = paddedTokens;
+        }
+        microBatches.add(texts.subList(start, texts.size()));
+        return microBatches;
+    }
+
+    private static int approximateTokens(String text) {
+        return Math.max(1, (text.length() + APPROXIMATE_CHARS_PER_TOKEN - 1) / APPROXIMATE_CHARS_PER_TOKEN);
+    }
+
+    /**
+     * Inference of texts split into several micro-batches. At most a window of micro-batches is in flight, the next
+     * one is sent when one completes, so a very long document, e.g. a book chunked into thousands of passages, does
+     * not flood the model with concurrent requests. The window bounds requests, not memory: the results of all texts
+     * are collected until the last micro-batch completes, as they are all written to the document.
+     */
+    private static class MicroBatchExecution {
+        private final List<List<String>> microBatches;
+        private final int[] offsets;
+        private final BiConsumer<List<String>, ActionListener<List<?>>> inference;
+        private final Consumer<List<?>> onResponse;
+        private final Consumer<Exception> onFailure;
+        private final AtomicBoolean completed;
+        private final Object[] results;
+        private final AtomicInteger pendingBatches;
+        private final AtomicInteger nextBatch = new AtomicInteger();
+        // number of requested dispatches, only the caller raising it from zero sends micro-batches
+        private final AtomicInteger dispatchRequests = new AtomicInteger();
+
+        MicroBatchExecution(
+            int textCount,
+            List<List<String>> microBatches,
+            BiConsumer<List<String>, ActionListener<List<?>>> inference,
+            Consumer<List<?>> onResponse,
+            Consumer<Exception> onFailure,
+            AtomicBoolean completed
+        ) {
+            this.microBatches = microBatches;
+            this.inference = inference;
+            this.onResponse = onResponse;
+            this.onFailure = onFailure;
+            this.completed = completed;
+            this.results = new Object[textCount];
+            this.pendingBatches = new AtomicInteger(microBatches.size());
+            this.offsets = new int[microBatches.size()];
+            for (int i = 1; i < offsets.length; i++) {
+                offsets[i] = offsets[i - 1] + microBatches.get(i - 1).size();
+            }
+        }
+
+        void start(int window) {
+            int initialBatches = window > 0 ? Math.min(window, microBatches.size()) : microBatches.size();
+            for (int i = 0; i < initialBatches; i++) {
+                dispatchNext();
+            }
+        }
+
+        /**
+         * Sends the next micro-batch. A micro-batch completing synchronously requests the next one from within this
+         * method, that request is served by the loop of the outer call instead of recursing once per micro-batch.
+         */
+        private void dispatchNext() {
+            if (dispatchRequests.getAndIncrement() != 0) {
+                return;
+            }
+            do {
+                int index = nextBatch.getAndIncrement();
+                if (index < microBatches.size() && completed.get() == false) {
+                    dispatch(microBatches.get(index), inference, listener(index));
+                }
+            } while (dispatchRequests.decrementAndGet() != 0);
+        }
+
+        private ActionListener<List<?>> listener(int index) {
+            List<String> microBatch = microBatches.get(index);
+            int batchOffset = offsets[index];
+            return new ActionListener<>() {
+                @Override
+                public void onResponse(List<?> batchResults) {
+                    if (batchResults == null || batchResults.size() < microBatch.size()) {
+                        onFailure(
+                            new IllegalStateException(
+                                String.format(
+                                    Locale.ROOT,
+                                    "expected [%d] inference results but got [%d]",
+                                    microBatch.size(),
+                                    batchResults == null ? 0 : batchResults.size()
+                                )
+                            )
+                        );
+                        return;
+                    }
+                    for (int i = 0; i < microBatch.size(); i++) {
+                        results[batchOffset + i] = batchResults.get(i);
+                    }
+                    // the decrement publishes the results of this micro-batch to the thread completing the last one
+                    if (pendingBatches.decrementAndGet() == 0) {
+                        if (completed.compareAndSet(false, true)) {
+                            MicroBatchExecution.this.onResponse.accept(Arrays.asList(results));
+                        }
+                        return;
+                    }
+                    dispatchNext();
+                }
+
+                @Override
+                public void onFailure(Exception e) {
+                    if (completed.compareAndSet(false, true)) {
+                        MicroBatchExecution.this.onFailure.accept(e);
+                    }
+                }
+            };
+        }
+    }
+}
@@ -0,0 +1,137 @@
+/*
+ * Copyright OpenSearch Contributors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+package org.opensearch.neuralsearch.ml;
+
+import com.google.common.annotations.VisibleForTesting;
+import com.google.common.hash.HashCode;
+import lombok.NonNull;
+import org.opensearch.action.support.ContextPreservingActionListener;
+import org.opensearch.common.util.concurrent.ThreadContext;
+import org.opensearch.core.action.ActionListener;
+import org.opensearch.neuralsearch.stats.events.EventStatName;
+import org.opensearch.neuralsearch.stats.events.EventStatsManager;
+import org.opensearch.threadpool.ThreadPool;
+
+import java.util.ArrayList;
+import java.util.List;
+import java.util.Map;
+import java.util.concurrent.ConcurrentHashMap;
+import java.util.function.Consumer;
+
+/**
+ * Single flight coalescing of concurrent identical query inferences. While an inference for a key is in flight,
+ * further requests for the same key do not call the model again, they are completed with the result or failure of
+ * the in-flight inference. This keeps bursts of identical queries from multiplying the load on the model.
+ * Keys are created per requesting user and tenant, and every listener is completed in the thread context it was
+ * registered in, not in the context of the request that started the inference.
+ */
+public class InferenceRequestCoalescer {
+    private static volatile InferenceRequestCoalescer INSTANCE;
+
+    private final Map<HashCode, InFlightInference> inFlightInferences = new ConcurrentHashMap<>();
+    private volatile ThreadContext threadContext;
+    private volatile boolean enabled = true;
+
+    @VisibleForTesting
+    InferenceRequestCoalescer() {}
+
+    public static InferenceRequestCoalescer getInstance() {
+        if (INSTANCE == null) {
+            synchronized (InferenceRequestCoalescer.class) {
+                if (INSTANCE == null) {
+                    INSTANCE = new InferenceRequestCoalescer();
+                }
+            }
+        }
+        return INSTANCE;
+    }
+
+    /**
+     * Initializes the thread context listeners are registered and completed in
+     * @param threadPool ThreadPool of the node
+     */
+    public void initialize(@NonNull ThreadPool threadPool) {
+        this.threadContext = threadPool.getThreadContext();
+    }
+
+    /**
+     * @param enabled whether identical in-flight inferences are shared
+     */
+    public void setEnabled(boolean enabled) {
+        this.enabled = enabled;
+    }
+
+    /**
+     * Runs the inference of a key unless an inference of the same key is already in flight, in which case the
+     * listener waits for that inference instead.
+     *
+     * @param key the key created by {@link InferenceResultCache#createKey}, which includes the requesting user and tenant
+     * @param listener listener of the inference result, completed in the thread context of the caller
+     * @param inference runs the inference and completes the given listener
+     * @param <T> type of the inference result
+     */
+    public <T> void execute(@NonNull HashCode key, @NonNull ActionListener<T> listener, @NonNull Consumer<ActionListener<T>> inference) {
+        if (!enabled) {
+            inference.accept(listener);
+            return;
+        }
+        final ThreadContext context = threadContext;
+        final ActionListener<T> contextPreservingListener = context == null
+            ? listener
+            : ContextPreservingActionListener.wrapPreservingContext(listener, context);
+        final InFlightInference newInference = new InFlightInference();
+        final InFlightInference inFlightInference = inFlightInferences.compute(key, (k, existing) -> {
+            InFlightInference target = existing == null ? newInference : existing;
+            target.listeners.add(contextPreservingListener);
+            return target;
+        });
+        if (inFlightInference != newInference) {
+            EventStatsManager.increment(EventStatName.INFERENCE_COALESCED_REQUESTS);
+            return;
+        }
+        try {
+            inference.accept(
+                ActionListener.wrap(
+                    result -> ActionListener.onResponse(complete(key, newInference), result),
+                    e -> ActionListener.onFailure(complete(key, newInference), e)
+                )
+            );
+        } catch (Exception e) {
+            ActionListener.onFailure(complete(key, newInference), e);
+        }
+    }
+
+    /**
+     * @return number of keys with an inference in flight
+     */
+    public int inFlightCount() {
+        return inFlightInferences.size();
+    }
+
+    /**
+     * Removes the in-flight inference of a key so that later requests start a new inference.
+     * Listeners can only join while the inference is registered, so the returned list is complete.
+     * Only the first completion returns the listeners, a later one must not complete a newer inference of the same key.
+     */
+    @SuppressWarnings("unchecked")
+    private <T> List<ActionListener<T>> complete(HashCode key, InFlightInference inFlightInference) {
+        if (!inFlightInferences.remove(key, inFlightInference)) {
+            return List.of();
+        }
+        List<ActionListener<T>> listeners = new ArrayList<>(inFlightInference.listeners.size());
+        for (ActionListener<?> listener : inFlightInference.listeners) {
+            listeners.add((ActionListener<T>) listener);
+        }
+        return listeners;
+    }
+
+    /**
+     * Listeners waiting for one in-flight inference. The list is only modified inside
+     * {@link ConcurrentHashMap#compute}, which serializes access per key.
+     */
+    private static class InFlightInference {
+        private final List<ActionListener<?>> listeners = new ArrayList<>();
+    }
+}
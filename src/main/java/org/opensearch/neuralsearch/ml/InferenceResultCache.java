@@ -0,0 +1,217 @@
+/*
+ * Copyright OpenSearch Contributors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+package org.opensearch.neuralsearch.ml;
+
+import com.google.common.annotations.VisibleForTesting;
+import com.google.common.cache.Cache;
+import com.google.common.cache.CacheBuilder;
+import com.google.common.hash.HashCode;
+import com.google.common.hash.Hasher;
+import com.google.common.hash.Hashing;
+import lombok.NonNull;
+import org.opensearch.common.unit.TimeValue;
+import org.opensearch.common.util.concurrent.ThreadContext;
+import org.opensearch.core.action.ActionListener;
+import org.opensearch.core.common.Strings;
+import org.opensearch.core.xcontent.MediaTypeRegistry;
+import org.opensearch.neuralsearch.processor.EmbeddingContentType;
+import org.opensearch.neuralsearch.processor.InferenceRequest;
+import org.opensearch.neuralsearch.stats.events.EventStatName;
+import org.opensearch.neuralsearch.stats.events.EventStatsManager;
+import org.opensearch.threadpool.ThreadPool;
+
+import java.nio.charset.StandardCharsets;
+import java.util.List;
+import java.util.Map;
+import java.util.TreeMap;
+import java.util.concurrent.TimeUnit;
+
+/**
+ * Node level, bounded cache of query embeddings with a time to live. It sits in front of the model inference of
+ * neural and neural_sparse queries, so the same query text or image is not embedded again by the same model
+ * while the entry is alive. Only requests with {@link EmbeddingContentType#QUERY} are cached, ingestion is never served
+ * from this cache. Entries are keyed by a SHA-256 digest of the model id, content type, response filters, algorithm
+ * parameters and input, so large inputs such as images are not retained in the key. The key also contains the
+ * requesting user and tenant, so a result is only served to requesters the model was already called for, and a user
+ * without access to a model never receives embeddings another user produced with it.
+ */
+public class InferenceResultCache {
+    // thread context transient of the security plugin holding the user name, backend roles, roles and requested tenant
+    static final String SECURITY_USER_INFO_TRANSIENT = "_opendistro_security_user_info";
+    // request header of ML Commons multi tenancy
+    static final String TENANT_ID_HEADER = "x-tenant-id";
+
+    private static volatile InferenceResultCache INSTANCE;
+
+    private volatile ThreadContext threadContext;
+    private volatile Cache<HashCode, Object> cache;
+    private volatile int maxEntries;
+    private volatile TimeValue ttl;
+
+    @VisibleForTesting
+    InferenceResultCache(int maxEntries, @NonNull TimeValue ttl) {
+        this.maxEntries = maxEntries;
+        this.ttl = ttl;
+        this.cache = buildCache(maxEntries, ttl);
+    }
+
+    public static InferenceResultCache getInstance() {
+        if (INSTANCE == null) {
+            synchronized (InferenceResultCache.class) {
+                if (INSTANCE == null) {
+                    INSTANCE = new InferenceResultCache(0, TimeValue.ZERO);
+                }
+            }
+        }
+        return INSTANCE;
+    }
+
+    /**
+     * Initializes the thread context the requesting user and tenant of a request are read from
+     * @param threadPool ThreadPool of the node
+     */
+    public void initialize(@NonNull ThreadPool threadPool) {
+        this.threadContext = threadPool.getThreadContext();
+    }
+
+    /**
+     * Updates the maximum number of entries. The cached entries are dropped. Zero disables the cache.
+     *
+     * @param maxEntries maximum number of cached embeddings
+     */
+    public synchronized void setMaxEntries(int maxEntries) {
+        this.maxEntries = maxEntries;
+        this.cache = buildCache(maxEntries, ttl);
+    }
+
+    /**
+     * Updates the time to live of new and existing entries. The cached entries are dropped. Zero disables the cache.
+     *
+     * @param ttl time to live of an entry after it is written
+     */
+    public synchronized void setTtl(@NonNull TimeValue ttl) {
+        this.ttl = ttl;
+        this.cache = buildCache(maxEntries, ttl);
+    }
+
+    /**
+     * @return true if the cache may hold entries
+     */
+    public boolean isEnabled() {
+        return maxEntries > 0 && ttl.millis() > 0;
+    }
+
+    /**
+     * Creates the key of a query inference request for the requesting user and tenant of the current thread context.
+     * The key identifies the inference result, so it is also used to share in-flight inferences.
+     *
+     * @param inferenceRequest the inference request
+     * @param input the input of the request, either a list of texts or a map of inputs
+     * @return the key, or null if the request is not a query inference
+     */
+    public HashCode createKey(@NonNull InferenceRequest inferenceRequest, Object input) {
+        if (inferenceRequest.getEmbeddingContentType() != EmbeddingContentType.QUERY || input == null) {
+            return null;
+        }
+        Hasher hasher = Hashing.sha256().newHasher();
+        ThreadContext context = threadContext;
+        putString(hasher, context == null ? "" : String.valueOf((Object) context.getTransient(SECURITY_USER_INFO_TRANSIENT)));
+        putString(hasher, context == null ? "" : String.valueOf(context.getHeader(TENANT_ID_HEADER)));
+        putString(hasher, inferenceRequest.getModelId());
+        putString(hasher, inferenceRequest.getEmbeddingContentType().name());
+        putString(hasher, String.valueOf(inferenceRequest.getTargetResponseFilters()));
+        putString(
+            hasher,
+            inferenceRequest.getMlAlgoParams() == null ? "" : Strings.toString(MediaTypeRegistry.JSON, inferenceRequest.getMlAlgoParams())
+        );
+        if (input instanceof Map<?, ?> inputMap) {
+            // sort the inputs so the key does not depend on the iteration order of the map
+            for (Map.Entry<?, ?> entry : new TreeMap<>(inputMap).entrySet()) {
+                putString(hasher, String.valueOf(entry.getKey()));
+                putString(hasher, String.valueOf(entry.getValue()));
+            }
+        } else if (input instanceof List<?> inputList) {
+            hasher.putInt(inputList.size());
+            for (Object item : inputList) {
+                putString(hasher, String.valueOf(item));
+            }
+        } else {
+            return null;
+        }
+        return hasher.hash();
+    }
+
+    /**
+     * Looks up the inference result of a key and records a cache hit or miss.
+     *
+     * @param key the key created by {@link #createKey(InferenceRequest, Object)}
+     * @return the cached result, or null on cache miss or if the cache is disabled
+     * @param <T> type of the inference result
+     */
+    @SuppressWarnings("unchecked")
+    public <T> T get(@NonNull HashCode key) {
+        if (!isEnabled()) {
+            return null;
+        }
+        Object result = cache.getIfPresent(key);
+        if (result == null) {
+            EventStatsManager.increment(EventStatName.INFERENCE_RESULT_CACHE_MISSES);
+            return null;
+        }
+        EventStatsManager.increment(EventStatName.INFERENCE_RESULT_CACHE_HITS);
+        return (T) result;
+    }
+
+    /**
+     * Wraps a listener so that a successful inference result is cached before it is handed to the listener.
+     *
+     * @param key the key created by {@link #createKey(InferenceRequest, Object)}
+     * @param listener the listener of the inference
+     * @return the caching listener, or the given listener if the cache is disabled
+     * @param <T> type of the inference result
+     */
+    public <T> ActionListener<T> cachingListener(@NonNull HashCode key, @NonNull ActionListener<T> listener) {
+        if (!isEnabled()) {
+            return listener;
+        }
+        return ActionListener.wrap(result -> {
+            if (result != null) {
+                cache.put(key, result);
+            }
+            listener.onResponse(result);
+        }, listener::onFailure);
+    }
+
+    /**
+     * Drops all cached entries.
+     *
+     * @return number of dropped entries
+     */
+    public long clear() {
+        Cache<HashCode, Object> current = cache;
+        long size = current.size();
+        current.invalidateAll();
+        return size;
+    }
+
+    /**
+     * @return number of cached entries
+     */
+    public long size() {
+        return cache.size();
+    }
+
+    private static void putString(Hasher hasher, String value) {
+        // prefix with the length so concatenated values can not collide
+        hasher.putInt(value.length()).putString(value, StandardCharsets.UTF_8);
+    }
+
+    private static Cache<HashCode, Object> buildCache(int maxEntries, TimeValue ttl) {
+        return CacheBuilder.newBuilder()
+            .maximumSize(Math.max(0, maxEntries))
+            .expireAfterWrite(Math.max(0, ttl.millis()), TimeUnit.MILLISECONDS)
+            .build();
+    }
+}
@@ -0,0 +1,358 @@
+/*
+ * Copyright OpenSearch Contributors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+package org.opensearch.neuralsearch.ml;
+
+import com.google.common.annotations.VisibleForTesting;
+import com.googlecode.concurrentlinkedhashmap.ConcurrentLinkedHashMap;
+import com.googlecode.concurrentlinkedhashmap.EntryWeigher;
+import lombok.NonNull;
+import org.apache.lucene.util.Accountable;
+import org.apache.lucene.util.BytesRef;
+import org.apache.lucene.util.RamUsageEstimator;
+import org.opensearch.common.hash.MurmurHash3;
+import org.opensearch.core.action.ActionListener;
+import org.opensearch.core.common.unit.ByteSizeValue;
+import org.opensearch.neuralsearch.common.FloatArrayList;
+import org.opensearch.neuralsearch.sparse.cache.CircuitBreakerManager;
+import org.opensearch.neuralsearch.stats.events.EventStatName;
+import org.opensearch.neuralsearch.stats.events.EventStatsManager;
+
+import java.util.ArrayList;
+import java.util.Arrays;
+import java.util.HashMap;
+import java.util.List;
+import java.util.Locale;
+import java.util.Map;
+import java.util.function.BiConsumer;
+import java.util.function.Consumer;
+
+/**
+ * Node level, byte bounded LRU cache of ingest inference results per text. Re-indexing and update heavy workloads
+ * embed the same texts over and over across bulk requests, the cache serves those texts without calling the model.
+ * Entries are keyed by the model id, a variant identifying the kind of result, e.g. dense or pruned sparse
+ * embeddings, and a 128 bit hash of the text, so the texts themselves are not held in memory.
+ * Memory of the entries is accounted in the neural circuit breaker. Results are handed out as copies, so processors
+ * may modify them like any fresh inference result.
+ */
+public class IngestInferenceCache {
+    /** Variant of dense embeddings of text embedding models */
+    public static final String DENSE_EMBEDDING_VARIANT = "dense";
+    /** Variant of unpruned sparse embeddings in the word format */
+    public static final String SPARSE_EMBEDDING_VARIANT = "sparse";
+    private static final String CIRCUIT_BREAKER_LABEL = "ingest_inference_cache";
+
+    private static volatile IngestInferenceCache INSTANCE;
+
+    private final ConcurrentLinkedHashMap<Key, Entry> cache;
+
+    @VisibleForTesting
+    IngestInferenceCache(long capacityInBytes) {
+        this.cache = new ConcurrentLinkedHashMap.Builder<Key, Entry>().maximumWeightedCapacity(capacityInBytes)
+            .weigher((EntryWeigher<Key, Entry>) (key, entry) -> (int) Math.min(Integer.MAX_VALUE, entryBytes(key, entry)))
+            .listener((key, entry) -> CircuitBreakerManager.releaseBytes(entryBytes(key, entry)))
+            .build();
+    }
+
+    public static IngestInferenceCache getInstance() {
+        if (INSTANCE == null) {
+            synchronized (IngestInferenceCache.class) {
+                if (INSTANCE == null) {
+                    INSTANCE = new IngestInferenceCache(0);
+                }
+            }
+        }
+        return INSTANCE;
+    }
+
+    /**
+     * Updates the capacity of the cache, evicting entries if needed. Zero disables the cache.
+     *
+     * @param capacity the new capacity
+     */
+    public void setCapacity(@NonNull ByteSizeValue capacity) {
+        cache.setCapacity(capacity.getBytes());
+    }
+
+    /**
+     * @return true if the cache may hold entries
+     */
+    public boolean isEnabled() {
+        return cache.capacity() > 0;
+    }
+
+    /**
+     * Drops all cached entries and releases their memory.
+     *
+     * @return number of dropped entries
+     */
+    public long clear() {
+        long clearedEntries = 0;
+        for (Key key : cache.keySet()) {
+            Entry entry = cache.remove(key);
+            if (entry != null) {
+                CircuitBreakerManager.releaseBytes(entryBytes(key, entry));
+                clearedEntries++;
+            }
+        }
+        return clearedEntries;
+    }
+
+    /**
+     * @return bytes currently held by the cache
+     */
+    public long ramBytesUsed() {
+        return cache.weightedSize();
+    }
+
+    /**
+     * Runs the inference of the texts missing in the cache and caches their results. If all texts are cached, the
+     * inference is not called at all. Results that are neither dense nor sparse embeddings are passed through uncached.
+     *
+     * @param modelId id of the model
+     * @param variant identifies the kind of result of the inference besides the model id, null if the results must not be cached
+     * @param texts texts to infer
+     * @param inference runs the inference of texts and completes the listener with one result per text
+     * @param onResponse receives one result per text in the order of the texts
+     * @param onFailure receives the failure of the inference
+     */
+    public void execute(
+        @NonNull String modelId,
+        String variant,
+        @NonNull List<String> texts,
+        @NonNull BiConsumer<List<String>, ActionListener<List<?>>> inference,
+        @NonNull Consumer<List<?>> onResponse,
+        @NonNull Consumer<Exception> onFailure
+    ) {
+        if (variant == null || isEnabled() == false) {
+            infer(texts, inference, new ActionListener<>() {
+                @Override
+                public void onResponse(List<?> results) {
+                    onResponse.accept(results);
+                }
+
+                @Override
+                public void onFailure(Exception e) {
+                    onFailure.accept(e);
+                }
+            });
+            return;
+        }
+        Object[] results = new Object[texts.size()];
+        Key[] keys = new Key[texts.size()];
+        List<Integer> missIndexes = new ArrayList<>();
+        List<String> missTexts = new ArrayList<>();
+        for (int i = 0; i < texts.size(); i++) {
+            String text = texts.get(i);
+            Entry entry = null;
+            if (text != null) {
+                keys[i] = new Key(modelId, variant, text);
+                entry = cache.get(keys[i]);
+            }
+            if (entry == null) {
+                missIndexes.add(i);
+                missTexts.add(text);
+            } else {
+                results[i] = entry.toResult();
+            }
+        }
+        int hits = texts.size() - missTexts.size();
+        if (hits > 0) {
+            EventStatsManager.add(EventStatName.INGEST_INFERENCE_CACHE_HITS, hits);
+        }
+        if (missTexts.isEmpty()) {
+            onResponse.accept(Arrays.asList(results));
+            return;
+        }
+        EventStatsManager.add(EventStatName.INGEST_INFERENCE_CACHE_MISSES, missTexts.size());
+        infer(missTexts, inference, new ActionListener<>() {
+            @Override
+            public void onResponse(List<?> missResults) {
+                if (missResults == null || missResults.size() < missTexts.size()) {
+                    onFailure(
+                        new IllegalStateException(
+                            String.format(
+                                Locale.ROOT,
+                                "expected [%d] inference results but got [%d]",
+                                missTexts.size(),
+                                missResults == null ? 0 : missResults.size()
+                            )
+                        )
+                    );
+                    return;
+                }
+                for (int i = 0; i < missIndexes.size(); i++) {
+                    int index = missIndexes.get(i);
+                    results[index] = missResults.get(i);
+                    if (keys[index] != null) {
+                        put(keys[index], missResults.get(i));
+                    }
+                }
+                onResponse.accept(Arrays.asList(results));
+            }
+
+            @Override
+            public void onFailure(Exception e) {
+                onFailure.accept(e);
+            }
+        });
+    }
+
+    private static void infer(
+        List<String> texts,
+        BiConsumer<List<String>, ActionListener<List<?>>> inference,
+        ActionListener<List<?>> listener
+    ) {
+        try {
+            inference.accept(texts, listener);
+        } catch (Exception e) {
+            listener.onFailure(e);
+        }
+    }
+
+    /**
+     * Caches the result of a text if the memory can be accounted in the circuit breaker
+     */
+    private void put(Key key, Object result) {
+        Entry entry = Entry.of(result);
+        if (entry == null) {
+            return;
+        }
+        long entryBytes = entryBytes(key, entry);
+        if (CircuitBreakerManager.addMemoryUsage(entryBytes, CIRCUIT_BREAKER_LABEL) == false) {
+            return;
+        }
+        if (cache.putIfAbsent(key, entry) != null) {
+            CircuitBreakerManager.releaseBytes(entryBytes);
+        }
+    }
+
+    private static long entryBytes(Key key, Entry entry) {
+        return key.ramBytesUsed() + entry.ramBytesUsed();
+    }
+
+    /**
+     * Identifies the result of one text. The model id and the variant are shared with the processors, only the
+     * reference is held by the key.
+     */
+    private static class Key implements Accountable {
+        private static final long BASE_RAM_BYTES_USED = RamUsageEstimator.shallowSizeOfInstance(Key.class);
+
+        private final String modelId;
+        private final String variant;
+        private final long textHash1;
+        private final long textHash2;
+
+        Key(String modelId, String variant, String text) {
+            BytesRef bytes = new BytesRef(text);
+            MurmurHash3.Hash128 hash = MurmurHash3.hash128(bytes.bytes, bytes.offset, bytes.length, 0, new MurmurHash3.Hash128());
+            this.modelId = modelId;
+            this.variant = variant;
+            this.textHash1 = hash.h1;
+            this.textHash2 = hash.h2;
+        }
+
+        @Override
+        public boolean equals(Object o) {
+            if (this == o) {
+                return true;
+            }
+            if (o == null || getClass() != o.getClass()) {
+                return false;
+            }
+            Key other = (Key) o;
+            return textHash1 == other.textHash1
+                && textHash2 == other.textHash2
+                && modelId.equals(other.modelId)
+                && variant.equals(other.variant);
+        }
+
+        @Override
+        public int hashCode() {
+            return Long.hashCode(textHash1);
+        }
+
+        @Override
+        public long ramBytesUsed() {
+            return BASE_RAM_BYTES_USED;
+        }
+    }
+
+    /**
+     * Result of one text stored as primitive arrays, either a dense embedding or the tokens and weights of a sparse embedding.
+     */
+    private static class Entry implements Accountable {
+        private static final long BASE_RAM_BYTES_USED = RamUsageEstimator.shallowSizeOfInstance(Entry.class);
+
+        private final float[] values;
+        // null for dense embeddings
+        private final String[] tokens;
+
+        private Entry(float[] values, String[] tokens) {
+            this.values = values;
+            this.tokens = tokens;
+        }
+
+        /**
+         * @param result inference result of one text
+         * @return the entry of the result, or null if the result is neither a dense nor a sparse embedding
+         */
+        static Entry of(Object result) {
+            if (result instanceof FloatArrayList floatArrayList) {
+                return new Entry(floatArrayList.toFloatArray(), null);
+            }
+            if (result instanceof List<?> list) {
+                float[] values = new float[list.size()];
+                for (int i = 0; i < values.length; i++) {
+                    if ((list.get(i) instanceof Number number) == false) {
+                        return null;
+                    }
+                    values[i] = number.floatValue();
+                }
+                return new Entry(values, null);
+            }
+            if (result instanceof Map<?, ?> map) {
+                float[] values = new float[map.size()];
+                String[] tokens = new String[map.size()];
+                int i = 0;
+                for (Map.Entry<?, ?> tokenWeight : map.entrySet()) {
+                    if ((tokenWeight.getKey() instanceof String token) == false
+                        || (tokenWeight.getValue() instanceof Number weight) == false) {
+                        return null;
+                    }
+                    tokens[i] = token;
+                    values[i++] = weight.floatValue();
+                }
+                return new Entry(values, tokens);
+            }
+            return null;
+        }
+
+        /**
+         * @return a copy of the result, a {@link FloatArrayList} for dense embeddings or a token weight map for sparse ones
+         */
+        Object toResult() {
+            if (tokens == null) {
+                return new FloatArrayList(values.clone());
+            }
+            Map<String, Float> tokenWeights = new HashMap<>(tokens.length * 4 / 3 + 1);
+            for (int i = 0; i < tokens.length; i++) {
+                tokenWeights.put(tokens[i], values[i]);
+            }
+            return tokenWeights;
+        }
+
+        @Override
+        public long ramBytesUsed() {
+            long bytes = BASE_RAM_BYTES_USED + RamUsageEstimator.sizeOf(values);
+            if (tokens != null) {
+                bytes += RamUsageEstimator.shallowSizeOf(tokens);
+                for (String token : tokens) {
+                    bytes += RamUsageEstimator.sizeOf(token);
+                }
+            }
+            return bytes;
+        }
+    }
+}
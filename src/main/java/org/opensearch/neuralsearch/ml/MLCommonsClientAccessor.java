@@ -49,6 +49,7 @@ import org.opensearch.ml.common.output.MLOutput;
 import org.opensearch.ml.common.output.model.ModelTensor;
 import org.opensearch.ml.common.output.model.ModelTensorOutput;
 import org.opensearch.ml.common.output.model.ModelTensors;
+import org.opensearch.neuralsearch.common.FloatArrayList;
 import org.opensearch.neuralsearch.ml.dto.AgentExecutionDTO;
 import org.opensearch.neuralsearch.ml.dto.AgentInfoDTO;
 
@@ -65,6 +66,7 @@ import java.util.HashMap;
 
 import com.google.common.cache.Cache;
 import com.google.common.cache.CacheBuilder;
+import com.google.common.hash.HashCode;
 
 import lombok.NonNull;
 import lombok.RequiredArgsConstructor;
@@ -84,6 +86,9 @@ public class MLCommonsClientAccessor {
 
     private final MachineLearningNodeClient mlClient;
     private final Cache<String, MLModel> modelCache = CacheBuilder.newBuilder().maximumSize(1000).build();
+    private final InferenceResultCache inferenceResultCache = InferenceResultCache.getInstance();
+    private final InferenceRequestCoalescer inferenceRequestCoalescer = InferenceRequestCoalescer.getInstance();
+    private final InferenceDispatcher inferenceDispatcher = InferenceDispatcher.getInstance();
 
     private static final Gson gson = new Gson();
 
@@ -128,15 +133,25 @@ public class MLCommonsClientAccessor {
         @NonNull final TextInferenceRequest inferenceRequest,
         @NonNull final ActionListener<List<Map<String, ?>>> listener
     ) {
-        checkModelAndThenPredict(inferenceRequest.getModelId(), listener::onFailure, model -> {
-            retryableInference(
-                inferenceRequest,
-                0,
-                () -> NeuralSearchMLInputBuilder.createTextEmbeddingInput(model, null, inferenceRequest.getInputTexts(), inferenceRequest),
-                this::buildMapResultFromResponse,
-                listener
-            );
-        });
+        cachedInference(
+            inferenceRequest,
+            inferenceRequest.getInputTexts(),
+            listener,
+            inferenceListener -> checkModelAndThenPredict(inferenceRequest.getModelId(), inferenceListener::onFailure, model -> {
+                retryableInference(
+                    inferenceRequest,
+                    0,
+                    () -> NeuralSearchMLInputBuilder.createTextEmbeddingInput(
+                        model,
+                        null,
+                        inferenceRequest.getInputTexts(),
+                        inferenceRequest
+                    ),
+                    this::buildMapResultFromResponse,
+                    inferenceListener
+                );
+            })
+        );
     }
 
     /**
@@ -148,20 +163,25 @@ public class MLCommonsClientAccessor {
      * @param listener         {@link ActionListener} which will be called when prediction is completed or errored out.
      */
     public void inferenceSentencesMap(@NonNull MapInferenceRequest inferenceRequest, @NonNull final ActionListener<List<Number>> listener) {
-        checkModelAndThenPredict(inferenceRequest.getModelId(), listener::onFailure, model -> {
-            retryableInference(
-                inferenceRequest,
-                0,
-                () -> NeuralSearchMLInputBuilder.createMultimodalInputFromMap(
-                    model,
-                    inferenceRequest.getTargetResponseFilters(),
-                    inferenceRequest.getInputObjects(),
-                    inferenceRequest
-                ),
-                this::buildSingleVectorFromResponse,
-                listener
-            );
-        });
+        cachedInference(
+            inferenceRequest,
+            inferenceRequest.getInputObjects(),
+            listener,
+            inferenceListener -> checkModelAndThenPredict(inferenceRequest.getModelId(), inferenceListener::onFailure, model -> {
+                retryableInference(
+                    inferenceRequest,
+                    0,
+                    () -> NeuralSearchMLInputBuilder.createMultimodalInputFromMap(
+                        model,
+                        inferenceRequest.getTargetResponseFilters(),
+                        inferenceRequest.getInputObjects(),
+                        inferenceRequest
+                    ),
+                    this::buildSingleVectorFromResponse,
+                    inferenceListener
+                );
+            })
+        );
     }
 
     /**
@@ -185,6 +205,39 @@ public class MLCommonsClientAccessor {
         );
     }
 
+    /**
+     * Serves a query inference from the {@link InferenceResultCache} if possible. Otherwise the inference is run,
+     * shared with concurrent identical query inferences through the {@link InferenceRequestCoalescer}, and its result is cached.
+     *
+     * @param inferenceRequest inference request
+     * @param input input of the inference request
+     * @param listener listener of the inference result
+     * @param inference runs the inference and completes the given listener
+     * @param <T> type of the inference result
+     */
+    private <T> void cachedInference(
+        final InferenceRequest inferenceRequest,
+        final Object input,
+        final ActionListener<T> listener,
+        final Consumer<ActionListener<T>> inference
+    ) {
+        final HashCode cacheKey = inferenceResultCache.createKey(inferenceRequest, input);
+        if (cacheKey == null) {
+            inference.accept(listener);
+            return;
+        }
+        final T cachedResult = inferenceResultCache.get(cacheKey);
+        if (cachedResult != null) {
+            listener.onResponse(cachedResult);
+            return;
+        }
+        inferenceRequestCoalescer.execute(
+            cacheKey,
+            listener,
+            sharedListener -> inference.accept(inferenceResultCache.cachingListener(cacheKey, sharedListener))
+        );
+    }
+
     /**
      * A generic function to make retryable inference request.
      * It allows caller to specify functions to vend their MLInput and process MLOutput.
@@ -204,17 +257,21 @@ public class MLCommonsClientAccessor {
         final ActionListener<T> listener
     ) {
         MLInput mlInput = mlInputSupplier.get();
-        mlClient.predict(inferenceRequest.getModelId(), mlInput, ActionListener.wrap(mlOutput -> {
-            final T result = mlOutputBuilder.apply(mlOutput);
-            listener.onResponse(result);
-        },
-            e -> RetryUtil.handleRetryOrFailure(
-                e,
-                retryTime,
-                () -> retryableInference(inferenceRequest, retryTime + 1, mlInputSupplier, mlOutputBuilder, listener),
-                listener
-            )
-        ));
+        inferenceDispatcher.<MLOutput>dispatch(
+            inferenceRequest.getModelId(),
+            ActionListener.wrap(mlOutput -> {
+                final T result = mlOutputBuilder.apply(mlOutput);
+                listener.onResponse(result);
+            },
+                e -> RetryUtil.handleRetryOrFailure(
+                    e,
+                    retryTime,
+                    () -> retryableInference(inferenceRequest, retryTime + 1, mlInputSupplier, mlOutputBuilder, listener),
+                    listener
+                )
+            ),
+            dispatchedListener -> mlClient.predict(inferenceRequest.getModelId(), mlInput, dispatchedListener)
+        );
     }
 
     private <T extends Number> List<List<T>> buildVectorFromResponse(MLOutput mlOutput) {
@@ -227,12 +284,8 @@ public class MLCommonsClientAccessor {
             for (final ModelTensor tensor : tensorsList) {
                 // Check if we have standard tensor data first (local models)
                 if (tensor.getData() != null) {
-                    if (tensor.getData().length > 0) {
-                        vector.add(Arrays.stream(tensor.getData()).map(value -> (T) value).collect(Collectors.toList()));
-                    } else {
-                        // Add empty list for empty tensor data
-                        vector.add(new ArrayList<>());
-                    }
+                    // Keep the embedding as primitive floats, an empty tensor yields an empty embedding
+                    vector.add((List<T>) (List<?>) FloatArrayList.fromNumbers(tensor.getData()));
                 } else {
                     // Remote model: extract from dataAsMap with "response" key
                     List<List<T>> remoteVectors = extractVectorsFromRemoteEmbeddingResponse(tensor);
@@ -303,7 +356,7 @@ public class MLCommonsClientAccessor {
                         + "{\"response\": [[float, float, ...], ...]}"
                 );
             }
-            vectors.add(embeddingList.stream().map(v -> (T) v).collect(Collectors.toList()));
+            vectors.add((List<T>) (List<?>) FloatArrayList.fromNumbers(embeddingList));
         }
         return vectors;
     }
@@ -10,11 +10,13 @@ import static org.opensearch.neuralsearch.settings.NeuralSearchSettings.RERANKER
 import static org.opensearch.neuralsearch.settings.NeuralSearchSettings.NEURAL_STATS_ENABLED;
 import static org.opensearch.neuralsearch.settings.NeuralSearchSettings.SEMANTIC_INGEST_BATCH_SIZE;
 
+import java.io.IOException;
 import java.util.Arrays;
 import java.util.Collection;
 import java.util.Collections;
 import java.util.List;
 import java.util.Map;
+import java.util.Objects;
 import java.util.Optional;
 import java.util.function.Supplier;
 
@@ -23,6 +25,7 @@ import org.opensearch.core.common.unit.ByteSizeValue;
 import org.opensearch.index.IndexModule;
 import org.opensearch.index.IndexSettings;
 import org.opensearch.index.codec.CodecServiceFactory;
+import org.opensearch.index.analysis.AnalysisRegistry;
 import org.opensearch.index.mapper.Mapper;
 import org.opensearch.indices.breaker.BreakerSettings;
 import org.opensearch.ml.client.MachineLearningNodeClient;
@@ -67,6 +70,8 @@ import org.opensearch.neuralsearch.sparse.SparseIndexEventListener;
 import org.opensearch.neuralsearch.sparse.SparseSettings;
 import org.opensearch.neuralsearch.sparse.cache.CircuitBreakerManager;
 import org.opensearch.neuralsearch.sparse.cache.MemoryUsageManager;
+import org.opensearch.neuralsearch.sparse.cache.SparseMemoryBudgetManager;
+import org.opensearch.neuralsearch.sparse.cache.SparseQueryResultCache;
 import org.opensearch.neuralsearch.sparse.codec.SparseCodecService;
 import org.opensearch.neuralsearch.stats.events.EventStatsManager;
 import org.opensearch.neuralsearch.stats.info.InfoStatsManager;
@@ -98,6 +103,11 @@ import org.opensearch.indices.breaker.BreakerSettings;
 import org.opensearch.ingest.Processor;
 import org.opensearch.neuralsearch.executors.HybridQueryExecutor;
 import org.opensearch.neuralsearch.highlight.SemanticHighlighter;
+import org.opensearch.neuralsearch.ml.InferenceDispatcher;
+import org.opensearch.neuralsearch.ml.InferenceMicroBatcher;
+import org.opensearch.neuralsearch.ml.IngestInferenceCache;
+import org.opensearch.neuralsearch.ml.InferenceRequestCoalescer;
+import org.opensearch.neuralsearch.ml.InferenceResultCache;
 import org.opensearch.neuralsearch.ml.MLCommonsClientAccessor;
 import org.opensearch.neuralsearch.processor.AgenticQueryTranslatorProcessor;
 import org.opensearch.neuralsearch.processor.AgenticContextResponseProcessor;
@@ -119,6 +129,7 @@ import org.opensearch.neuralsearch.processor.factory.RRFProcessorFactory;
 import org.opensearch.neuralsearch.highlight.batch.processor.SemanticHighlightingFactory;
 import org.opensearch.neuralsearch.highlight.SemanticHighlightingConstants;
 import org.opensearch.neuralsearch.processor.factory.TextChunkingProcessorFactory;
+import org.opensearch.neuralsearch.processor.chunker.TokenizerAnalyzerCache;
 import org.opensearch.neuralsearch.processor.factory.RerankProcessorFactory;
 import org.opensearch.neuralsearch.processor.factory.SparseEncodingProcessorFactory;
 import org.opensearch.neuralsearch.processor.factory.TextEmbeddingProcessorFactory;
@@ -129,9 +140,12 @@ import org.opensearch.neuralsearch.processor.rerank.RerankProcessor;
 import org.opensearch.neuralsearch.query.ext.RerankSearchExtBuilder;
 import org.opensearch.neuralsearch.query.ext.AgentStepsSearchExtBuilder;
 import org.opensearch.neuralsearch.rest.RestNeuralStatsAction;
+import org.opensearch.neuralsearch.rest.RestNeuralInferenceCacheClearHandler;
+import org.opensearch.neuralsearch.rest.RestNeuralSparseMemoryStatsHandler;
 import org.opensearch.neuralsearch.settings.NeuralSearchSettings;
 import org.opensearch.neuralsearch.sparse.SparseIndexEventListener;
 import org.opensearch.neuralsearch.sparse.SparseSettings;
+import org.opensearch.neuralsearch.sparse.WarmCacheManifestManager;
 import org.opensearch.neuralsearch.sparse.algorithm.ClusterTrainingExecutor;
 import org.opensearch.neuralsearch.sparse.common.SparseConstants;
 import org.opensearch.neuralsearch.sparse.mapper.SparseVectorFieldMapper;
@@ -141,9 +155,14 @@ import org.opensearch.neuralsearch.transport.NeuralSparseClearCacheAction;
 import org.opensearch.neuralsearch.transport.NeuralSparseClearCacheTransportAction;
 import org.opensearch.neuralsearch.transport.NeuralSparseWarmupAction;
 import org.opensearch.neuralsearch.transport.NeuralSparseWarmupTransportAction;
+import org.opensearch.neuralsearch.transport.NeuralInferenceCacheClearAction;
+import org.opensearch.neuralsearch.transport.NeuralInferenceCacheClearTransportAction;
+import org.opensearch.neuralsearch.transport.NeuralSparseMemoryStatsAction;
+import org.opensearch.neuralsearch.transport.NeuralSparseMemoryStatsTransportAction;
 
 import org.opensearch.neuralsearch.util.NeuralSearchClusterUtil;
 import org.opensearch.neuralsearch.util.PipelineServiceUtil;
+import org.opensearch.neuralsearch.util.RetryUtil;
 import org.opensearch.neuralsearch.search.HybridQuerySearchRequestFilter;
 import org.opensearch.action.support.ActionFilter;
 import org.opensearch.plugins.ActionPlugin;
@@ -194,6 +213,7 @@ public class NeuralSearch extends Plugin
     private PipelineServiceUtil pipelineServiceUtil;
     private InfoStatsManager infoStatsManager;
     private ClusterService clusterService;
+    private TokenizerAnalyzerCache tokenizerAnalyzerCache;
     private final SemanticHighlighter semanticHighlighter;
     private final ScoreNormalizationFactory scoreNormalizationFactory = new ScoreNormalizationFactory();
     private final ScoreCombinationFactory scoreCombinationFactory = new ScoreCombinationFactory();
@@ -226,6 +246,9 @@ public class NeuralSearch extends Plugin
         NeuralQueryBuilder.initialize(clientAccessor);
         NeuralSparseQueryBuilder.initialize(clientAccessor);
         HybridQueryExecutor.initialize(threadPool);
+        HybridQueryExecutor.setParallelSubQueryScoringEnabled(
+            NeuralSearchSettings.HYBRID_PARALLEL_SUB_QUERY_SCORING_ENABLED.get(environment.settings())
+        );
         normalizationProcessorWorkflow = new NormalizationProcessorWorkflow(new ScoreNormalizer(), new ScoreCombiner());
         settingsAccessor = new NeuralSearchSettingsAccessor(clusterService, environment.settings());
         pipelineServiceUtil = new PipelineServiceUtil(clusterService);
@@ -233,6 +256,30 @@ public class NeuralSearch extends Plugin
         EventStatsManager.instance().initialize(settingsAccessor);
         this.xContentRegistry = xContentRegistry;
         ClusterTrainingExecutor.getInstance().initialize(threadPool);
+        WarmCacheManifestManager.getInstance()
+            .initialize(threadPool, NeuralSearchSettings.SPARSE_WARM_CACHE_MANIFEST_INTERVAL.get(environment.settings()));
+        SparseQueryResultCache.getInstance().setCapacity(NeuralSearchSettings.SPARSE_QUERY_RESULT_CACHE_SIZE.get(environment.settings()));
+        InferenceResultCache.getInstance().initialize(threadPool);
+        InferenceResultCache.getInstance()
+            .setMaxEntries(NeuralSearchSettings.INFERENCE_RESULT_CACHE_MAX_ENTRIES.get(environment.settings()));
+        InferenceResultCache.getInstance().setTtl(NeuralSearchSettings.INFERENCE_RESULT_CACHE_TTL.get(environment.settings()));
+        InferenceRequestCoalescer.getInstance().initialize(threadPool);
+        InferenceRequestCoalescer.getInstance().setEnabled(NeuralSearchSettings.INFERENCE_COALESCING_ENABLED.get(environment.settings()));
+        RetryUtil.initialize(threadPool, NeuralSearchSettings.ML_INFERENCE_RETRY_BUDGET.get(environment.settings()));
+        InferenceMicroBatcher.getInstance()
+            .setMaxTokensPerRequest(NeuralSearchSettings.INGEST_INFERENCE_MAX_TOKENS_PER_REQUEST.get(environment.settings()));
+        InferenceMicroBatcher.getInstance()
+            .setMaxTextsPerRequest(NeuralSearchSettings.INGEST_INFERENCE_MAX_TEXTS_PER_REQUEST.get(environment.settings()));
+        InferenceMicroBatcher.getInstance()
+            .setMaxConcurrentMicroBatches(NeuralSearchSettings.INGEST_INFERENCE_MAX_CONCURRENT_MICRO_BATCHES.get(environment.settings()));
+        IngestInferenceCache.getInstance().setCapacity(NeuralSearchSettings.INGEST_INFERENCE_CACHE_SIZE.get(environment.settings()));
+        InferenceDispatcher.getInstance().initialize(threadPool);
+        InferenceDispatcher.getInstance()
+            .setMaxQueueSize(NeuralSearchSettings.INFERENCE_DISPATCHER_MAX_QUEUE_SIZE.get(environment.settings()));
+        InferenceDispatcher.getInstance()
+            .setAdaptive(NeuralSearchSettings.INFERENCE_DISPATCHER_ADAPTIVE_CONCURRENCY.get(environment.settings()));
+        InferenceDispatcher.getInstance()
+            .setMaxInFlight(NeuralSearchSettings.INFERENCE_DISPATCHER_MAX_IN_FLIGHT.get(environment.settings()));
 
         // Initialize SemanticHighlighterEngine for legacy non-batch highlighting
         QueryTextExtractorRegistry queryTextExtractorRegistry = new QueryTextExtractorRegistry();
@@ -280,7 +327,15 @@ public class NeuralSearch extends Plugin
             NeuralSearchClusterUtil.instance().getClusterService(),
             indexNameExpressionResolver
         );
-        return ImmutableList.of(restNeuralStatsAction, restNeuralSparseWarmupCacheHandler, restNeuralSparseClearCacheHandler);
+        RestNeuralSparseMemoryStatsHandler restNeuralSparseMemoryStatsHandler = new RestNeuralSparseMemoryStatsHandler();
+        RestNeuralInferenceCacheClearHandler restNeuralInferenceCacheClearHandler = new RestNeuralInferenceCacheClearHandler();
+        return ImmutableList.of(
+            restNeuralStatsAction,
+            restNeuralSparseWarmupCacheHandler,
+            restNeuralSparseClearCacheHandler,
+            restNeuralSparseMemoryStatsHandler,
+            restNeuralInferenceCacheClearHandler
+        );
     }
 
     @Override
@@ -288,7 +343,9 @@ public class NeuralSearch extends Plugin
         return Arrays.asList(
             new ActionHandler<>(NeuralStatsAction.INSTANCE, NeuralStatsTransportAction.class),
             new ActionHandler<>(NeuralSparseWarmupAction.INSTANCE, NeuralSparseWarmupTransportAction.class),
-            new ActionHandler<>(NeuralSparseClearCacheAction.INSTANCE, NeuralSparseClearCacheTransportAction.class)
+            new ActionHandler<>(NeuralSparseClearCacheAction.INSTANCE, NeuralSparseClearCacheTransportAction.class),
+            new ActionHandler<>(NeuralSparseMemoryStatsAction.INSTANCE, NeuralSparseMemoryStatsTransportAction.class),
+            new ActionHandler<>(NeuralInferenceCacheClearAction.INSTANCE, NeuralInferenceCacheClearTransportAction.class)
         );
     }
 
@@ -337,7 +394,11 @@ public class NeuralSearch extends Plugin
                 parameters.ingestService.getClusterService()
             ),
             TextChunkingProcessor.TYPE,
-            new TextChunkingProcessorFactory(parameters.env, parameters.ingestService.getClusterService(), parameters.analysisRegistry)
+            new TextChunkingProcessorFactory(
+                parameters.env,
+                parameters.ingestService.getClusterService(),
+                getTokenizerAnalyzerCache(parameters.analysisRegistry)
+            )
         );
     }
 
@@ -366,9 +427,26 @@ public class NeuralSearch extends Plugin
             SEMANTIC_INGEST_BATCH_SIZE,
             HYBRID_COLLAPSE_DOCS_PER_GROUP_PER_SUBQUERY,
             SparseSettings.IS_SPARSE_INDEX_SETTING,
+            SparseSettings.SPARSE_MEMORY_BUDGET_SETTING,
+            SparseSettings.SPARSE_FIELD_MEMORY_BUDGET_SETTING,
             NeuralSearchSettings.SPARSE_ALGO_PARAM_INDEX_THREAD_QTY_SETTING,
             NEURAL_CIRCUIT_BREAKER_LIMIT,
-            NEURAL_CIRCUIT_BREAKER_OVERHEAD
+            NEURAL_CIRCUIT_BREAKER_OVERHEAD,
+            NeuralSearchSettings.SPARSE_WARM_CACHE_MANIFEST_INTERVAL,
+            NeuralSearchSettings.SPARSE_QUERY_RESULT_CACHE_SIZE,
+            NeuralSearchSettings.INFERENCE_RESULT_CACHE_MAX_ENTRIES,
+            NeuralSearchSettings.INFERENCE_RESULT_CACHE_TTL,
+            NeuralSearchSettings.INFERENCE_COALESCING_ENABLED,
+            NeuralSearchSettings.ML_INFERENCE_RETRY_BUDGET,
+            NeuralSearchSettings.INGEST_INFERENCE_MAX_TOKENS_PER_REQUEST,
+            NeuralSearchSettings.INGEST_INFERENCE_MAX_TEXTS_PER_REQUEST,
+            NeuralSearchSettings.INFERENCE_DISPATCHER_MAX_IN_FLIGHT,
+            NeuralSearchSettings.INFERENCE_DISPATCHER_MAX_QUEUE_SIZE,
+            NeuralSearchSettings.INFERENCE_DISPATCHER_ADAPTIVE_CONCURRENCY,
+            NeuralSearchSettings.INGEST_INFERENCE_MAX_CONCURRENT_MICRO_BATCHES,
+            NeuralSearchSettings.INGEST_INFERENCE_CACHE_SIZE,
+            NeuralSearchSettings.HYBRID_QUERY_REQUEST_CACHE_ENABLED,
+            NeuralSearchSettings.HYBRID_PARALLEL_SUB_QUERY_SCORING_ENABLED
         );
     }
 
@@ -474,15 +552,36 @@ public class NeuralSearch extends Plugin
                 clientAccessor,
                 parameters.env,
                 parameters.ingestService.getClusterService(),
-                parameters.analysisRegistry,
+                getTokenizerAnalyzerCache(parameters.analysisRegistry),
                 parameters.client
             )
         );
     }
 
+    /**
+     * Analyzers of the text chunking tokenizers are shared by all chunking processors of the node and built from the
+     * analysis registry of the node, they are closed when the plugin is closed.
+     */
+    private synchronized TokenizerAnalyzerCache getTokenizerAnalyzerCache(final AnalysisRegistry analysisRegistry) {
+        if (tokenizerAnalyzerCache == null) {
+            tokenizerAnalyzerCache = new TokenizerAnalyzerCache(analysisRegistry);
+        }
+        return tokenizerAnalyzerCache;
+    }
+
     public void onIndexModule(IndexModule indexModule) {
         if (SparseSettings.IS_SPARSE_INDEX_SETTING.get(indexModule.getSettings())) {
             indexModule.addIndexEventListener(new SparseIndexEventListener());
+            String indexName = indexModule.getIndex().getName();
+            SparseMemoryBudgetManager budgetManager = SparseMemoryBudgetManager.getInstance();
+            indexModule.addSettingsUpdateConsumer(
+                SparseSettings.SPARSE_MEMORY_BUDGET_SETTING,
+                budget -> budgetManager.updateIndexBudget(indexName, budget)
+            );
+            indexModule.addSettingsUpdateConsumer(
+                SparseSettings.SPARSE_FIELD_MEMORY_BUDGET_SETTING,
+                fieldBudgets -> budgetManager.updateFieldBudgets(indexName, fieldBudgets)
+            );
         }
     }
 
@@ -513,6 +612,19 @@ public class NeuralSearch extends Plugin
      */
     @Override
     public List<ActionFilter> getActionFilters() {
-        return List.of(new HybridQuerySearchRequestFilter());
+        // settings accessor is created with the components, the filter reads it on every request
+        return List.of(
+            new HybridQuerySearchRequestFilter(
+                () -> Objects.nonNull(settingsAccessor) && settingsAccessor.isHybridQueryRequestCacheEnabled(),
+                searchRequest -> NeuralSearchClusterUtil.instance().getIndexMetadataList(searchRequest)
+            )
+        );
+    }
+
+    @Override
+    public synchronized void close() throws IOException {
+        if (tokenizerAnalyzerCache != null) {
+            tokenizerAnalyzerCache.close();
+        }
     }
 }
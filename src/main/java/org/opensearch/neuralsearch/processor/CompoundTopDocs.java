@@ -100,45 +100,45 @@ public class CompoundTopDocs {
             initialize(topDocs.totalHits, new ArrayList<>(), isSortEnabled, searchShard);
             return;
         }
-        // skipping first two elements, it's a start-stop element and delimiter for first series
+        // skipping first two elements, it's a start-stop element and delimiter for first series. Results of every sub-query
+        // are copied as one slice of the array, so parsing does not create intermediate lists
         List<TopDocs> topDocsList = new ArrayList<>();
-        List<ScoreDoc> scoreDocList = new ArrayList<>();
-        List<Object> collapseValueList = new ArrayList<>();
+        int subQueryStart = 2;
         for (int index = 2; index < scoreDocs.length; index++) {
-            // getting first element of score's series
             ScoreDoc scoreDoc = scoreDocs[index];
             if (isHybridQueryDelimiterElement(scoreDoc) || isHybridQueryStartStopElement(scoreDoc)) {
-                ScoreDoc[] subQueryScores = scoreDocList.toArray(new ScoreDoc[0]);
-                TotalHits totalHits = new TotalHits(subQueryScores.length, TotalHits.Relation.EQUAL_TO);
-                TopDocs subQueryTopDocs;
-                if (isCollapseEnabled) {
-                    CollapseTopFieldDocs collapseTopFieldDocs = (CollapseTopFieldDocs) topDocs;
-                    subQueryTopDocs = new CollapseTopFieldDocs(
-                        collapseTopFieldDocs.field,
-                        totalHits,
-                        subQueryScores,
-                        collapseTopFieldDocs.fields,
-                        collapseValueList.toArray(new Object[0])
-                    );
-                    collapseValueList.clear();
-                } else if (isSortEnabled) {
-                    subQueryTopDocs = new TopFieldDocs(totalHits, subQueryScores, ((TopFieldDocs) topDocs).fields);
-                } else {
-                    subQueryTopDocs = new TopDocs(totalHits, subQueryScores);
-                }
-                topDocsList.add(subQueryTopDocs);
-                scoreDocList.clear();
-            } else {
-                scoreDocList.add(scoreDoc);
-                if (isCollapseEnabled) {
-                    CollapseTopFieldDocs collapseTopFieldDocs = (CollapseTopFieldDocs) topDocs;
-                    collapseValueList.add(collapseTopFieldDocs.collapseValues[index]);
-                }
+                topDocsList.add(createSubQueryTopDocs(topDocs, subQueryStart, index, isSortEnabled, isCollapseEnabled));
+                subQueryStart = index + 1;
             }
         }
         initialize(topDocs.totalHits, topDocsList, isSortEnabled, searchShard);
     }
 
+    private static TopDocs createSubQueryTopDocs(
+        final TopDocs topDocs,
+        final int from,
+        final int to,
+        final boolean isSortEnabled,
+        final boolean isCollapseEnabled
+    ) {
+        ScoreDoc[] subQueryScores = Arrays.copyOfRange(topDocs.scoreDocs, from, to);
+        TotalHits totalHits = new TotalHits(subQueryScores.length, TotalHits.Relation.EQUAL_TO);
+        if (isCollapseEnabled) {
+            CollapseTopFieldDocs collapseTopFieldDocs = (CollapseTopFieldDocs) topDocs;
+            return new CollapseTopFieldDocs(
+                collapseTopFieldDocs.field,
+                totalHits,
+                subQueryScores,
+                collapseTopFieldDocs.fields,
+                Arrays.copyOfRange(collapseTopFieldDocs.collapseValues, from, to)
+            );
+        }
+        if (isSortEnabled) {
+            return new TopFieldDocs(totalHits, subQueryScores, ((TopFieldDocs) topDocs).fields);
+        }
+        return new TopDocs(totalHits, subQueryScores);
+    }
+
     private List<ScoreDoc> cloneLargestScoreDocs(final List<TopDocs> docs, boolean isSortEnabled) {
         if (docs == null) {
             return null;
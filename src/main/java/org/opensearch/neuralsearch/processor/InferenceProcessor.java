@@ -26,8 +26,13 @@ import org.opensearch.ingest.AbstractBatchingProcessor;
 import org.opensearch.ingest.IngestDocument;
 import org.opensearch.ingest.IngestDocumentWrapper;
 import org.opensearch.ml.common.input.parameter.MLAlgoParams;
+import org.opensearch.neuralsearch.common.FloatArrayList;
+import org.opensearch.neuralsearch.ml.InferenceMicroBatcher;
+import org.opensearch.neuralsearch.ml.IngestInferenceCache;
 import org.opensearch.neuralsearch.ml.MLCommonsClientAccessor;
 import org.opensearch.neuralsearch.processor.optimization.InferenceFilter;
+import org.opensearch.neuralsearch.stats.events.EventStatName;
+import org.opensearch.neuralsearch.stats.events.EventStatsManager;
 import org.opensearch.neuralsearch.util.ProcessorDocumentUtils;
 import org.opensearch.neuralsearch.util.TokenWeightUtil;
 import org.opensearch.neuralsearch.util.prune.PruneType;
@@ -181,6 +186,15 @@ public abstract class InferenceProcessor extends AbstractBatchingProcessor {
      */
     abstract void doBatchExecute(List<String> inferenceList, Consumer<List<?>> handler, Consumer<Exception> onException);
 
+    /**
+     * Identifies the results of {@link #doBatchExecute} in the {@link IngestInferenceCache} besides the model id, e.g. the
+     * kind of embedding and its post-processing.
+     * @return the cache variant, null if the results must not be cached
+     */
+    protected String getInferenceCacheVariant() {
+        return null;
+    }
+
     /**
      * This is the function which does actual inference work for subBatchExecute interface.
      * @param ingestDocumentWrappers a list of IngestDocuments in a batch.
@@ -218,16 +232,35 @@ public abstract class InferenceProcessor extends AbstractBatchingProcessor {
         List<DataForInference> dataForInferences,
         Consumer<List<IngestDocumentWrapper>> handler
     ) {
-        Tuple<List<String>, Map<Integer, Integer>> sortedResult = sortByLengthAndReturnOriginalOrder(inferenceList);
+        Tuple<List<String>, int[]> sortedResult = dedupeAndSortByLength(inferenceList);
         inferenceList = sortedResult.v1();
-        Map<Integer, Integer> originalOrder = sortedResult.v2();
-        doBatchExecute(inferenceList, results -> {
-            batchExecuteHandler(results, dataForInferences, originalOrder);
-            handler.accept(ingestDocumentWrappers);
-        }, exception -> { updateWithExceptions(ingestDocumentWrappers, handler, exception); });
+        int[] originalOrder = sortedResult.v2();
+        // texts missing in the cache stay sorted by length for the micro-batcher
+        IngestInferenceCache.getInstance()
+            .execute(
+                modelId,
+                getInferenceCacheVariant(),
+                inferenceList,
+                (texts, listener) -> InferenceMicroBatcher.getInstance()
+                    .execute(
+                        texts,
+                        (microBatch, microBatchListener) -> doBatchExecute(
+                            microBatch,
+                            microBatchListener::onResponse,
+                            microBatchListener::onFailure
+                        ),
+                        listener::onResponse,
+                        listener::onFailure
+                    ),
+                results -> {
+                    batchExecuteHandler(results, dataForInferences, originalOrder);
+                    handler.accept(ingestDocumentWrappers);
+                },
+                exception -> { updateWithExceptions(ingestDocumentWrappers, handler, exception); }
+            );
     }
 
-    protected void batchExecuteHandler(List<?> results, List<DataForInference> dataForInferences, Map<Integer, Integer> originalOrder) {
+    protected void batchExecuteHandler(List<?> results, List<DataForInference> dataForInferences, int[] originalOrder) {
         int startIndex = 0;
         results = restoreToOriginalOrder(results, originalOrder);
         for (DataForInference dataForInference : dataForInferences) {
@@ -245,28 +278,71 @@ public abstract class InferenceProcessor extends AbstractBatchingProcessor {
         }
     }
 
-    protected Tuple<List<String>, Map<Integer, Integer>> sortByLengthAndReturnOriginalOrder(List<String> inferenceList) {
-        List<Tuple<Integer, String>> docsWithIndex = new ArrayList<>();
+    /**
+     * Removes duplicate texts of a batch and sorts the unique texts by length, so every distinct text is sent to the
+     * model once, e.g. boilerplate shared by many documents or re-ingested documents.
+     * @param inferenceList texts of the batch in document order
+     * @return the unique texts sorted by length, and for every text of the batch the index of its unique text
+     */
+    protected Tuple<List<String>, int[]> dedupeAndSortByLength(List<String> inferenceList) {
+        Map<String, Integer> uniqueIndexByText = new HashMap<>();
+        List<String> uniqueTexts = new ArrayList<>();
+        int[] uniqueIndexes = new int[inferenceList.size()];
         for (int i = 0; i < inferenceList.size(); ++i) {
-            docsWithIndex.add(Tuple.tuple(i, inferenceList.get(i)));
+            String text = inferenceList.get(i);
+            Integer uniqueIndex = uniqueIndexByText.putIfAbsent(text, uniqueTexts.size());
+            if (uniqueIndex == null) {
+                uniqueIndex = uniqueTexts.size();
+                uniqueTexts.add(text);
+            }
+            uniqueIndexes[i] = uniqueIndex;
         }
-        docsWithIndex.sort(Comparator.comparingInt(t -> t.v2().length()));
-        List<String> sortedInferenceList = docsWithIndex.stream().map(Tuple::v2).collect(Collectors.toList());
-        Map<Integer, Integer> originalOrderMap = new HashMap<>();
-        for (int i = 0; i < docsWithIndex.size(); ++i) {
-            originalOrderMap.put(i, docsWithIndex.get(i).v1());
+        EventStatsManager.add(EventStatName.INGEST_INFERENCE_TEXTS, inferenceList.size());
+        EventStatsManager.add(EventStatName.INGEST_INFERENCE_DEDUPLICATED_TEXTS, inferenceList.size() - uniqueTexts.size());
+
+        Integer[] sortedUniqueIndexes = new Integer[uniqueTexts.size()];
+        for (int i = 0; i < sortedUniqueIndexes.length; ++i) {
+            sortedUniqueIndexes[i] = i;
         }
-        return Tuple.tuple(sortedInferenceList, originalOrderMap);
+        Arrays.sort(sortedUniqueIndexes, Comparator.comparingInt(i -> uniqueTexts.get(i).length()));
+        List<String> sortedInferenceList = new ArrayList<>(sortedUniqueIndexes.length);
+        int[] sortedPositions = new int[sortedUniqueIndexes.length];
+        for (int i = 0; i < sortedUniqueIndexes.length; ++i) {
+            sortedInferenceList.add(uniqueTexts.get(sortedUniqueIndexes[i]));
+            sortedPositions[sortedUniqueIndexes[i]] = i;
+        }
+        for (int i = 0; i < uniqueIndexes.length; ++i) {
+            uniqueIndexes[i] = sortedPositions[uniqueIndexes[i]];
+        }
+        return Tuple.tuple(sortedInferenceList, uniqueIndexes);
     }
 
-    private List<?> restoreToOriginalOrder(List<?> results, Map<Integer, Integer> originalOrder) {
-        List<Object> sortedResults = Arrays.asList(results.toArray());
-        for (int i = 0; i < results.size(); ++i) {
-            if (!originalOrder.containsKey(i)) continue;
-            int oldIndex = originalOrder.get(i);
-            sortedResults.set(oldIndex, results.get(i));
+    /**
+     * Fans the results of the unique texts back out to every text of the batch. A text that occurs more than once
+     * gets its own copy of the result, so later processors can modify the field of one document without affecting another.
+     */
+    private List<?> restoreToOriginalOrder(List<?> results, int[] originalOrder) {
+        List<Object> restoredResults = new ArrayList<>(originalOrder.length);
+        boolean[] used = new boolean[results.size()];
+        for (int sortedIndex : originalOrder) {
+            Object result = results.get(sortedIndex);
+            restoredResults.add(used[sortedIndex] ? copyResult(result) : result);
+            used[sortedIndex] = true;
         }
-        return sortedResults;
+        return restoredResults;
+    }
+
+    private static Object copyResult(Object result) {
+        if (result instanceof FloatArrayList floatArrayList) {
+            return new FloatArrayList(floatArrayList.toFloatArray());
+        }
+        if (result instanceof List<?> list) {
+            return new ArrayList<>(list);
+        }
+        if (result instanceof Map<?, ?> map) {
+            return new LinkedHashMap<>(map);
+        }
+        return result;
     }
 
     protected List<String> constructInferenceTexts(List<DataForInference> dataForInferences) {
@@ -680,7 +756,19 @@ public abstract class InferenceProcessor extends AbstractBatchingProcessor {
         BiConsumer<IngestDocument, Exception> handler,
         InferenceFilter inferenceFilter
     ) {
-        final Map<String, Object> existingDocument = response.getSourceAsMap();
+        reuseOrGenerateEmbedding(response.getSourceAsMap(), ingestDocument, processMap, inferenceList, handler, inferenceFilter);
+    }
+
+    // This method validates and filters given inferenceList and processMap by comparing the ingest document with an existing version
+    // of it, e.g. the indexed document or the embeddings the ingest document carries.
+    protected void reuseOrGenerateEmbedding(
+        Map<String, Object> existingDocument,
+        IngestDocument ingestDocument,
+        Map<String, Object> processMap,
+        List<String> inferenceList,
+        BiConsumer<IngestDocument, Exception> handler,
+        InferenceFilter inferenceFilter
+    ) {
         if (existingDocument == null || existingDocument.isEmpty()) {
             generateAndSetInference(ingestDocument, processMap, inferenceList, handler);
             return;
@@ -784,17 +872,26 @@ public abstract class InferenceProcessor extends AbstractBatchingProcessor {
         // For asymmetric models: MLCommonsClientAccessor will use this to create AsymmetricTextEmbeddingParameters
         // For symmetric models: MLCommonsClientAccessor will ignore this and pass null parameters
         // This avoids an extra model lookup here since MLCommonsClientAccessor caches model asymmetry status
-        mlCommonsClientAccessor.inferenceSentences(
-            TextInferenceRequest.builder()
-                .modelId(this.modelId)
-                .inputTexts(inferenceList)
-                .embeddingContentType(EmbeddingContentType.PASSAGE)
-                .build(),
-            ActionListener.wrap(vectors -> {
-                setVectorFieldsToDocument(ingestDocument, processMap, vectors);
-                handler.accept(ingestDocument, null);
-            }, e -> { handler.accept(null, e); })
-        );
+        ActionListener<List<?>> listener = ActionListener.wrap(vectors -> {
+            setVectorFieldsToDocument(ingestDocument, processMap, vectors);
+            handler.accept(ingestDocument, null);
+        }, e -> { handler.accept(null, e); });
+        IngestInferenceCache.getInstance()
+            .execute(
+                modelId,
+                getInferenceCacheVariant(),
+                inferenceList,
+                (texts, textsListener) -> mlCommonsClientAccessor.inferenceSentences(
+                    TextInferenceRequest.builder()
+                        .modelId(this.modelId)
+                        .inputTexts(texts)
+                        .embeddingContentType(EmbeddingContentType.PASSAGE)
+                        .build(),
+                    ActionListener.wrap(textsListener::onResponse, textsListener::onFailure)
+                ),
+                listener::onResponse,
+                listener::onFailure
+            );
     }
 
     /**
@@ -805,6 +902,8 @@ public abstract class InferenceProcessor extends AbstractBatchingProcessor {
      * @param inferenceList list of texts to be model inference
      * @param pruneType    The type of prune strategy to use
      * @param pruneRatio   The ratio or threshold for prune
+     * @param mlAlgoParams parameters of the inference
+     * @param inferenceCacheVariant identifies the pruned embeddings in the {@link IngestInferenceCache}, null if they must not be cached
      * @param handler handler for accepting IngestionDocument
      *
      */
@@ -815,24 +914,36 @@ public abstract class InferenceProcessor extends AbstractBatchingProcessor {
         PruneType pruneType,
         float pruneRatio,
         MLAlgoParams mlAlgoParams,
+        String inferenceCacheVariant,
         BiConsumer<IngestDocument, Exception> handler
     ) {
-        mlCommonsClientAccessor.inferenceSentencesWithMapResult(
-            TextInferenceRequest.builder()
-                .modelId(this.modelId)
-                .inputTexts(inferenceList)
-                .mlAlgoParams(mlAlgoParams)
-                .embeddingContentType(PASSAGE)
-                .build(),
-            ActionListener.wrap(resultMaps -> {
-                List<Map<String, Float>> sparseVectors = TokenWeightUtil.fetchListOfTokenWeightMap(resultMaps)
-                    .stream()
-                    .map(vector -> PruneUtils.pruneSparseVector(pruneType, pruneRatio, vector))
-                    .toList();
-                setVectorFieldsToDocument(ingestDocument, processMap, sparseVectors);
-                handler.accept(ingestDocument, null);
-            }, e -> { handler.accept(null, e); })
-        );
+        ActionListener<List<?>> listener = ActionListener.wrap(sparseVectors -> {
+            setVectorFieldsToDocument(ingestDocument, processMap, sparseVectors);
+            handler.accept(ingestDocument, null);
+        }, e -> { handler.accept(null, e); });
+        IngestInferenceCache.getInstance()
+            .execute(
+                modelId,
+                inferenceCacheVariant,
+                inferenceList,
+                (texts, textsListener) -> mlCommonsClientAccessor.inferenceSentencesWithMapResult(
+                    TextInferenceRequest.builder()
+                        .modelId(this.modelId)
+                        .inputTexts(texts)
+                        .mlAlgoParams(mlAlgoParams)
+                        .embeddingContentType(PASSAGE)
+                        .build(),
+                    ActionListener.wrap(resultMaps -> {
+                        List<Map<String, Float>> sparseVectors = TokenWeightUtil.fetchListOfTokenWeightMap(resultMaps)
+                            .stream()
+                            .map(vector -> PruneUtils.pruneSparseVector(pruneType, pruneRatio, vector))
+                            .toList();
+                        textsListener.onResponse(sparseVectors);
+                    }, textsListener::onFailure)
+                ),
+                listener::onResponse,
+                listener::onFailure
+            );
     }
 
     @Override
@@ -19,6 +19,8 @@ import org.opensearch.ingest.IngestDocument;
 import org.opensearch.ingest.IngestDocumentWrapper;
 import org.opensearch.ml.common.input.parameter.textembedding.AsymmetricTextEmbeddingParameters;
 import org.opensearch.ml.common.input.parameter.textembedding.SparseEmbeddingFormat;
+import org.opensearch.neuralsearch.ml.InferenceMicroBatcher;
+import org.opensearch.neuralsearch.ml.IngestInferenceCache;
 import org.opensearch.neuralsearch.ml.MLCommonsClientAccessor;
 import org.opensearch.neuralsearch.processor.optimization.TextEmbeddingInferenceFilter;
 import org.opensearch.neuralsearch.sparse.common.SparseFieldUtils;
@@ -197,26 +199,68 @@ public final class SparseEncodingProcessor extends InferenceProcessor {
         SparseEmbeddingFormat format,
         BiConsumer<List<DataForInference>, Exception> handler
     ) {
-        Tuple<List<String>, Map<Integer, Integer>> sortedResult = sortByLengthAndReturnOriginalOrder(inferenceList);
+        Tuple<List<String>, int[]> sortedResult = dedupeAndSortByLength(inferenceList);
         List<String> sortedInferenceList = sortedResult.v1();
-        Map<Integer, Integer> originalOrder = sortedResult.v2();
+        int[] originalOrder = sortedResult.v2();
         final AsymmetricTextEmbeddingParameters parameters = format == SparseEmbeddingFormat.TOKEN_ID ? TOKEN_ID_PARAMETER : null;
-        mlCommonsClientAccessor.inferenceSentencesWithMapResult(
-            TextInferenceRequest.builder()
-                .modelId(this.modelId)
-                .inputTexts(sortedInferenceList)
-                .mlAlgoParams(parameters)
-                .embeddingContentType(PASSAGE)
-                .build(),
-            ActionListener.wrap(resultMaps -> {
-                List<Map<String, Float>> sparseVectors = TokenWeightUtil.fetchListOfTokenWeightMap(resultMaps)
-                    .stream()
-                    .map(vector -> PruneUtils.pruneSparseVector(pruneType, pruneRatio, vector))
-                    .toList();
-                batchExecuteHandler(sparseVectors, dataForInferences, originalOrder);
-                handler.accept(dataForInferences, null);
-            }, exception -> { handler.accept(dataForInferences, exception); })
-        );
+        // texts missing in the cache stay sorted by length for the micro-batcher
+        IngestInferenceCache.getInstance()
+            .execute(
+                modelId,
+                getInferenceCacheVariant(format),
+                sortedInferenceList,
+                (texts, listener) -> InferenceMicroBatcher.getInstance()
+                    .execute(
+                        texts,
+                        (microBatch, microBatchListener) -> mlCommonsClientAccessor.inferenceSentencesWithMapResult(
+                            TextInferenceRequest.builder()
+                                .modelId(this.modelId)
+                                .inputTexts(microBatch)
+                                .mlAlgoParams(parameters)
+                                .embeddingContentType(PASSAGE)
+                                .build(),
+                            ActionListener.wrap(
+                                resultMaps -> microBatchListener.onResponse(toPrunedSparseVectors(resultMaps)),
+                                microBatchListener::onFailure
+                            )
+                        ),
+                        listener::onResponse,
+                        listener::onFailure
+                    ),
+                sparseVectors -> {
+                    try {
+                        batchExecuteHandler(sparseVectors, dataForInferences, originalOrder);
+                    } catch (Exception e) {
+                        handler.accept(dataForInferences, e);
+                        return;
+                    }
+                    handler.accept(dataForInferences, null);
+                },
+                exception -> { handler.accept(dataForInferences, exception); }
+            );
+    }
+
+    /**
+     * Extracts the token weights of each text from the model response and prunes them. The model response of a remote
+     * model holds the token weights of all texts, so this is applied to the response of every request.
+     */
+    private List<Map<String, Float>> toPrunedSparseVectors(List<Map<String, ?>> resultMaps) {
+        return TokenWeightUtil.fetchListOfTokenWeightMap(resultMaps)
+            .stream()
+            .map(vector -> PruneUtils.pruneSparseVector(pruneType, pruneRatio, vector))
+            .toList();
+    }
+
+    @Override
+    protected String getInferenceCacheVariant() {
+        return getInferenceCacheVariant(SparseEmbeddingFormat.WORD);
+    }
+
+    /**
+     * Sparse embeddings are cached after pruning, so the prune settings are part of the variant
+     */
+    private String getInferenceCacheVariant(SparseEmbeddingFormat format) {
+        return String.format(Locale.ROOT, "sparse_%s_%s_%s", format.name().toLowerCase(Locale.ROOT), pruneType.getValue(), pruneRatio);
     }
 
     private SplitDataResponse splitData(List<DataForInference> dataForInferences, Set<String> sparseAnnFields, long maxDepth) {
@@ -324,13 +368,7 @@ public final class SparseEncodingProcessor extends InferenceProcessor {
     public void doBatchExecute(List<String> inferenceList, Consumer<List<?>> handler, Consumer<Exception> onException) {
         mlCommonsClientAccessor.inferenceSentencesWithMapResult(
             TextInferenceRequest.builder().modelId(this.modelId).inputTexts(inferenceList).embeddingContentType(PASSAGE).build(),
-            ActionListener.wrap(resultMaps -> {
-                List<Map<String, Float>> sparseVectors = TokenWeightUtil.fetchListOfTokenWeightMap(resultMaps)
-                    .stream()
-                    .map(vector -> PruneUtils.pruneSparseVector(pruneType, pruneRatio, vector))
-                    .toList();
-                handler.accept(sparseVectors);
-            }, onException)
+            ActionListener.wrap(resultMaps -> handler.accept(toPrunedSparseVectors(resultMaps)), onException)
         );
     }
 
@@ -395,7 +433,16 @@ public final class SparseEncodingProcessor extends InferenceProcessor {
         splitProcessMap(processMap, sparseAnnFields, "", tokenIdProcessMap, wordProcessMap, 1, maxDepth);
         AtomicInteger counter = new AtomicInteger(0);
         if (tokenIdProcessMap.isEmpty()) {
-            generateAndSetMapInference(ingestDocument, processMap, inferenceList, pruneType, pruneRatio, null, handler);
+            generateAndSetMapInference(
+                ingestDocument,
+                processMap,
+                inferenceList,
+                pruneType,
+                pruneRatio,
+                null,
+                getInferenceCacheVariant(),
+                handler
+            );
             return;
         } else {
             counter.incrementAndGet();
@@ -418,6 +465,7 @@ public final class SparseEncodingProcessor extends InferenceProcessor {
                 pruneType,
                 pruneRatio,
                 TOKEN_ID_PARAMETER,
+                getInferenceCacheVariant(SparseEmbeddingFormat.TOKEN_ID),
                 getCountDownHandler(counter, exceptions, handler)
             );
         }
@@ -430,6 +478,7 @@ public final class SparseEncodingProcessor extends InferenceProcessor {
                 pruneType,
                 pruneRatio,
                 null,
+                getInferenceCacheVariant(),
                 getCountDownHandler(counter, exceptions, handler)
             );
         }
@@ -16,7 +16,6 @@ import java.util.Optional;
 import org.apache.commons.lang3.StringUtils;
 import org.opensearch.env.Environment;
 import org.opensearch.cluster.service.ClusterService;
-import org.opensearch.index.analysis.AnalysisRegistry;
 import org.opensearch.ingest.AbstractProcessor;
 import org.opensearch.ingest.IngestDocument;
 import org.opensearch.neuralsearch.processor.chunker.Chunker;
@@ -25,6 +24,7 @@ import org.opensearch.neuralsearch.processor.chunker.ChunkerFactory;
 import org.opensearch.neuralsearch.processor.chunker.DelimiterChunker;
 import org.opensearch.neuralsearch.processor.chunker.FixedCharLengthChunker;
 import org.opensearch.neuralsearch.processor.chunker.FixedTokenLengthChunker;
+import org.opensearch.neuralsearch.processor.chunker.TokenizerAnalyzerCache;
 import org.opensearch.neuralsearch.processor.util.ProcessorUtils;
 import org.opensearch.neuralsearch.stats.events.EventStatName;
 import org.opensearch.neuralsearch.stats.events.EventStatsManager;
@@ -68,7 +68,7 @@ public final class TextChunkingProcessor extends AbstractProcessor {
     private final Map<String, Object> fieldMap;
     private final boolean ignoreMissing;
     private final ClusterService clusterService;
-    private final AnalysisRegistry analysisRegistry;
+    private final TokenizerAnalyzerCache analyzerCache;
     private final Environment environment;
 
     public TextChunkingProcessor(
@@ -79,14 +79,14 @@ public final class TextChunkingProcessor extends AbstractProcessor {
         final boolean ignoreMissing,
         final Environment environment,
         final ClusterService clusterService,
-        final AnalysisRegistry analysisRegistry
+        final TokenizerAnalyzerCache analyzerCache
     ) {
         super(tag, description);
         this.fieldMap = fieldMap;
         this.ignoreMissing = ignoreMissing;
         this.environment = environment;
         this.clusterService = clusterService;
-        this.analysisRegistry = analysisRegistry;
+        this.analyzerCache = analyzerCache;
         parseAlgorithmMap(algorithmMap);
     }
 
@@ -151,8 +151,8 @@ public final class TextChunkingProcessor extends AbstractProcessor {
                 )
             );
         }
-        // fixed token length algorithm needs analysis registry for tokenization
-        chunkerParameters.put(FixedTokenLengthChunker.ANALYSIS_REGISTRY_FIELD, analysisRegistry);
+        // fixed token length algorithm needs the tokenizer analyzers for tokenization
+        chunkerParameters.put(FixedTokenLengthChunker.ANALYZER_CACHE_FIELD, analyzerCache);
         this.chunker = ChunkerFactory.create(algorithmKey, chunkerParameters);
     }
 
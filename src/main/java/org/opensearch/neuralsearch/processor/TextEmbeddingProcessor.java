@@ -4,9 +4,13 @@
  */
 package org.opensearch.neuralsearch.processor;
 
+import java.util.ArrayList;
+import java.util.Collections;
+import java.util.IdentityHashMap;
 import java.util.List;
 import java.util.Map;
 import java.util.Objects;
+import java.util.Set;
 import java.util.function.BiConsumer;
 import java.util.function.Consumer;
 
@@ -19,9 +23,11 @@ import org.opensearch.core.common.util.CollectionUtils;
 import org.opensearch.env.Environment;
 import org.opensearch.ingest.IngestDocument;
 import org.opensearch.ingest.IngestDocumentWrapper;
+import org.opensearch.neuralsearch.ml.IngestInferenceCache;
 import org.opensearch.neuralsearch.ml.MLCommonsClientAccessor;
 
 import lombok.extern.log4j.Log4j2;
+import org.opensearch.neuralsearch.processor.optimization.ContentHash;
 import org.opensearch.neuralsearch.processor.optimization.TextEmbeddingInferenceFilter;
 import org.opensearch.transport.client.OpenSearchClient;
 import org.opensearch.neuralsearch.stats.events.EventStatsManager;
@@ -39,9 +45,19 @@ public final class TextEmbeddingProcessor extends InferenceProcessor {
 
     public static final String TYPE = "text_embedding";
     public static final String LIST_TYPE_NESTED_MAP_KEY = "knn";
+    /**
+     * Optional field storing the hash of the embedded texts. A document arriving with a hash that matches its texts
+     * reuses the embeddings it carries without fetching the indexed document. Only this processor stores and checks
+     * the hash, sparse_encoding, text_image_embedding and semantic fields keep re-inferring or fetching as before.
+     * The hash is written to the document source, so without an explicit mapping it is dynamically mapped as text
+     * with a keyword sub-field. Map it as a keyword with "index": false and "doc_values": false, it is never searched.
+     */
+    public static final String CONTENT_HASH_FIELD = "content_hash_field";
     private final OpenSearchClient openSearchClient;
     private final boolean skipExisting;
     private final TextEmbeddingInferenceFilter textEmbeddingInferenceFilter;
+    // field storing the hash of the embedded texts, null if no hash is stored
+    private final String contentHashField;
 
     public TextEmbeddingProcessor(
         String tag,
@@ -51,6 +67,7 @@ public final class TextEmbeddingProcessor extends InferenceProcessor {
         Map<String, Object> fieldMap,
         boolean skipExisting,
         TextEmbeddingInferenceFilter textEmbeddingInferenceFilter,
+        String contentHashField,
         OpenSearchClient openSearchClient,
         MLCommonsClientAccessor clientAccessor,
         Environment environment,
@@ -59,6 +76,7 @@ public final class TextEmbeddingProcessor extends InferenceProcessor {
         super(tag, description, batchSize, TYPE, LIST_TYPE_NESTED_MAP_KEY, modelId, fieldMap, clientAccessor, environment, clusterService);
         this.skipExisting = skipExisting;
         this.textEmbeddingInferenceFilter = textEmbeddingInferenceFilter;
+        this.contentHashField = contentHashField;
         this.openSearchClient = openSearchClient;
     }
 
@@ -70,6 +88,39 @@ public final class TextEmbeddingProcessor extends InferenceProcessor {
         BiConsumer<IngestDocument, Exception> handler
     ) {
         EventStatsManager.increment(EventStatName.TEXT_EMBEDDING_PROCESSOR_EXECUTIONS);
+        if (contentHashField == null) {
+            executeWithSkipExisting(ingestDocument, processMap, inferenceList, handler);
+            return;
+        }
+        final String contentHash = ContentHash.of(modelId, inferenceList);
+        final BiConsumer<IngestDocument, Exception> contentHashHandler = (document, exception) -> {
+            if (exception == null && document != null) {
+                document.setFieldValue(contentHashField, contentHash);
+            }
+            handler.accept(document, exception);
+        };
+        if (hasContentHash(ingestDocument, contentHash)) {
+            // the embeddings the document carries belong to its texts, only missing embeddings are generated
+            EventStatsManager.increment(EventStatName.SKIP_EXISTING_CONTENT_HASH_MATCHES);
+            reuseOrGenerateEmbedding(
+                IngestDocument.deepCopyMap(ingestDocument.getSourceAndMetadata()),
+                ingestDocument,
+                processMap,
+                inferenceList,
+                contentHashHandler,
+                textEmbeddingInferenceFilter
+            );
+            return;
+        }
+        executeWithSkipExisting(ingestDocument, processMap, inferenceList, contentHashHandler);
+    }
+
+    private void executeWithSkipExisting(
+        IngestDocument ingestDocument,
+        Map<String, Object> processMap,
+        List<String> inferenceList,
+        BiConsumer<IngestDocument, Exception> handler
+    ) {
         // skip existing flag is turned off. Call model inference without filtering
         if (skipExisting == false) {
             generateAndSetInference(ingestDocument, processMap, inferenceList, handler);
@@ -118,6 +169,11 @@ public final class TextEmbeddingProcessor extends InferenceProcessor {
         );
     }
 
+    @Override
+    protected String getInferenceCacheVariant() {
+        return IngestInferenceCache.DENSE_EMBEDDING_VARIANT;
+    }
+
     @Override
     public void subBatchExecute(List<IngestDocumentWrapper> ingestDocumentWrappers, Consumer<List<IngestDocumentWrapper>> handler) {
         try {
@@ -127,34 +183,46 @@ public final class TextEmbeddingProcessor extends InferenceProcessor {
                 return;
             }
             List<DataForInference> dataForInferences = getDataForInference(ingestDocumentWrappers);
+            // documents whose stored content hash matched need neither the existing document nor inference for carried embeddings
+            Set<DataForInference> reusedDataForInferences = Collections.newSetFromMap(new IdentityHashMap<>());
+            if (contentHashField != null) {
+                Map<IngestDocumentWrapper, String> contentHashes = new IdentityHashMap<>();
+                dataForInferences = reuseCarriedEmbeddings(dataForInferences, contentHashes, reusedDataForInferences);
+                handler = setContentHashes(contentHashes, handler);
+            }
             List<String> inferenceList = constructInferenceTexts(dataForInferences);
             if (inferenceList.isEmpty()) {
                 handler.accept(ingestDocumentWrappers);
                 return;
             }
+            List<DataForInference> dataForInferencesToFetch = dataForInferences.stream()
+                .filter(dataForInference -> reusedDataForInferences.contains(dataForInference) == false)
+                .toList();
             // skip existing flag is turned off. Call doSubBatchExecute without filtering
-            if (skipExisting == false) {
+            if (skipExisting == false || dataForInferencesToFetch.isEmpty()) {
                 doSubBatchExecute(ingestDocumentWrappers, inferenceList, dataForInferences, handler);
                 return;
             }
             // skipExisting flag is turned on, eligible inference texts in dataForInferences will be compared and filtered after embeddings
             // are copied
             EventStatsManager.increment(EventStatName.SKIP_EXISTING_EXECUTIONS);
+            final List<DataForInference> allDataForInferences = dataForInferences;
+            final Consumer<List<IngestDocumentWrapper>> batchHandler = handler;
             openSearchClient.execute(
                 MultiGetAction.INSTANCE,
-                buildMultiGetRequest(dataForInferences),
+                buildMultiGetRequest(dataForInferencesToFetch),
                 ActionListener.wrap(
                     response -> reuseOrGenerateEmbedding(
                         response,
                         ingestDocumentWrappers,
                         inferenceList,
-                        dataForInferences,
-                        handler,
+                        allDataForInferences,
+                        batchHandler,
                         textEmbeddingInferenceFilter
                     ),
                     e -> {
                         // When exception is thrown in for MultiGetAction, set exception to all ingestDocumentWrappers
-                        updateWithExceptions(getIngestDocumentWrappers(dataForInferences), handler, e);
+                        updateWithExceptions(getIngestDocumentWrappers(allDataForInferences), batchHandler, e);
                     }
                 )
             );
@@ -162,4 +230,72 @@ public final class TextEmbeddingProcessor extends InferenceProcessor {
             updateWithExceptions(ingestDocumentWrappers, handler, e);
         }
     }
+
+    private boolean hasContentHash(IngestDocument ingestDocument, String contentHash) {
+        return ingestDocument.hasField(contentHashField)
+            && contentHash.equals(ingestDocument.getFieldValue(contentHashField, Object.class));
+    }
+
+    /**
+     * Filters out the texts of documents whose stored content hash matches their texts and that carry the embeddings
+     * of those texts, e.g. documents reindexed or updated with their embeddings.
+     *
+     * @param dataForInferences data for inference of the batch
+     * @param contentHashes receives the content hash of every document to process
+     * @param reusedDataForInferences receives the data for inference of documents whose content hash matched
+     * @return data for inference of the batch, filtered for documents whose content hash matched
+     */
+    private List<DataForInference> reuseCarriedEmbeddings(
+        List<DataForInference> dataForInferences,
+        Map<IngestDocumentWrapper, String> contentHashes,
+        Set<DataForInference> reusedDataForInferences
+    ) {
+        List<DataForInference> result = new ArrayList<>(dataForInferences.size());
+        for (DataForInference dataForInference : dataForInferences) {
+            IngestDocumentWrapper ingestDocumentWrapper = dataForInference.getIngestDocumentWrapper();
+            if (ingestDocumentWrapper.getException() != null || CollectionUtils.isEmpty(dataForInference.getInferenceList())) {
+                result.add(dataForInference);
+                continue;
+            }
+            IngestDocument ingestDocument = ingestDocumentWrapper.getIngestDocument();
+            String contentHash = ContentHash.of(modelId, dataForInference.getInferenceList());
+            contentHashes.put(ingestDocumentWrapper, contentHash);
+            if (hasContentHash(ingestDocument, contentHash) == false) {
+                result.add(dataForInference);
+                continue;
+            }
+            EventStatsManager.increment(EventStatName.SKIP_EXISTING_CONTENT_HASH_MATCHES);
+            Map<String, Object> filteredProcessMap = textEmbeddingInferenceFilter.filterAndCopyExistingEmbeddings(
+                IngestDocument.deepCopyMap(ingestDocument.getSourceAndMetadata()),
+                ingestDocument.getSourceAndMetadata(),
+                dataForInference.getProcessMap()
+            );
+            DataForInference filteredDataForInference = new DataForInference(
+                ingestDocumentWrapper,
+                filteredProcessMap,
+                createInferenceList(filteredProcessMap)
+            );
+            reusedDataForInferences.add(filteredDataForInference);
+            result.add(filteredDataForInference);
+        }
+        return result;
+    }
+
+    /**
+     * Stores the content hash in every document of the batch that was processed successfully
+     */
+    private Consumer<List<IngestDocumentWrapper>> setContentHashes(
+        Map<IngestDocumentWrapper, String> contentHashes,
+        Consumer<List<IngestDocumentWrapper>> handler
+    ) {
+        return ingestDocumentWrappers -> {
+            for (Map.Entry<IngestDocumentWrapper, String> entry : contentHashes.entrySet()) {
+                IngestDocumentWrapper ingestDocumentWrapper = entry.getKey();
+                if (ingestDocumentWrapper.getException() == null && ingestDocumentWrapper.getIngestDocument() != null) {
+                    ingestDocumentWrapper.getIngestDocument().setFieldValue(contentHashField, entry.getValue());
+                }
+            }
+            handler.accept(ingestDocumentWrappers);
+        };
+    }
 }
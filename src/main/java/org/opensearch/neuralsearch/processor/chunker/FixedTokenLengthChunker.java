@@ -4,18 +4,19 @@
  */
 package org.opensearch.neuralsearch.processor.chunker;
 
+import java.util.Arrays;
 import java.util.Locale;
 import java.util.Map;
 import java.util.List;
+import java.util.Objects;
 import java.util.Set;
 import java.util.ArrayList;
 
 import lombok.AccessLevel;
 import lombok.NoArgsConstructor;
-import org.opensearch.index.analysis.AnalysisRegistry;
-import org.opensearch.action.admin.indices.analyze.AnalyzeAction;
-import org.opensearch.action.admin.indices.analyze.AnalyzeAction.AnalyzeToken;
-import static org.opensearch.action.admin.indices.analyze.TransportAnalyzeAction.analyze;
+import org.apache.lucene.analysis.Analyzer;
+import org.apache.lucene.analysis.TokenStream;
+import org.apache.lucene.analysis.tokenattributes.OffsetAttribute;
 import static org.opensearch.neuralsearch.processor.chunker.ChunkerParameterParser.parseInteger;
 import static org.opensearch.neuralsearch.processor.chunker.ChunkerParameterParser.parseStringWithDefault;
 import static org.opensearch.neuralsearch.processor.chunker.ChunkerParameterParser.parseDoubleWithDefault;
@@ -30,8 +31,8 @@ public final class FixedTokenLengthChunker extends Chunker {
     /** The identifier for the fixed token length chunking algorithm. */
     public static final String ALGORITHM_NAME = "fixed_token_length";
 
-    /** Field name for the analysis registry configuration parameter. */
-    public static final String ANALYSIS_REGISTRY_FIELD = "analysis_registry";
+    /** Field name for the tokenizer analyzer cache configuration parameter. */
+    public static final String ANALYZER_CACHE_FIELD = "analyzer_cache";
 
     /** Field name for specifying the maximum number of tokens per chunk. */
     public static final String TOKEN_LIMIT_FIELD = "token_limit";
@@ -67,15 +68,19 @@ public final class FixedTokenLengthChunker extends Chunker {
     private int tokenLimit;
     private String tokenizer;
     private double overlapRate;
-    private final AnalysisRegistry analysisRegistry;
+    private final TokenizerAnalyzerCache analyzerCache;
 
     /**
      * Constructor that initializes the fixed token length chunker with the specified parameters.
-     * @param parameters a map with non-runtime parameters to be parsed
+     * @param parameters a map with non-runtime parameters to be parsed, must hold the tokenizer analyzer cache
      */
     public FixedTokenLengthChunker(final Map<String, Object> parameters) {
         parse(parameters);
-        this.analysisRegistry = (AnalysisRegistry) parameters.get(ANALYSIS_REGISTRY_FIELD);
+        // fail when the processor is created rather than when the first document is chunked
+        this.analyzerCache = Objects.requireNonNull(
+            (TokenizerAnalyzerCache) parameters.get(ANALYZER_CACHE_FIELD),
+            String.format(Locale.ROOT, "Parameter [%s] is required to create the %s chunker", ANALYZER_CACHE_FIELD, ALGORITHM_NAME)
+        );
     }
 
     /**
@@ -121,33 +126,33 @@ public final class FixedTokenLengthChunker extends Chunker {
         int runtimeMaxChunkLimit = parseInteger(runtimeParameters, MAX_CHUNK_LIMIT_FIELD);
         int chunkStringCount = parseInteger(runtimeParameters, CHUNK_STRING_COUNT_FIELD);
 
-        List<AnalyzeToken> tokens = tokenize(content, tokenizer, maxTokenCount);
+        int[] tokenStartOffsets = tokenize(content, tokenizer, maxTokenCount);
         List<String> chunkResult = new ArrayList<>();
 
         int startTokenIndex = 0;
         int startContentPosition, endContentPosition;
         int overlapTokenNumber = (int) Math.floor(tokenLimit * overlapRate);
 
-        while (startTokenIndex < tokens.size()) {
+        while (startTokenIndex < tokenStartOffsets.length) {
             if (startTokenIndex == 0) {
                 // include all characters till the start if no previous passage
                 startContentPosition = 0;
             } else {
-                startContentPosition = tokens.get(startTokenIndex).getStartOffset();
+                startContentPosition = tokenStartOffsets[startTokenIndex];
             }
             if (Chunker.checkRunTimeMaxChunkLimit(chunkResult.size(), runtimeMaxChunkLimit, chunkStringCount)) {
                 // include all characters till the end if exceeds max chunk limit
                 chunkResult.add(content.substring(startContentPosition));
                 break;
             }
-            if (startTokenIndex + tokenLimit >= tokens.size()) {
+            if (startTokenIndex + tokenLimit >= tokenStartOffsets.length) {
                 // include all characters till the end if no next passage
                 endContentPosition = content.length();
                 chunkResult.add(content.substring(startContentPosition, endContentPosition));
                 break;
             } else {
                 // include gap characters between two passages
-                endContentPosition = tokens.get(startTokenIndex + tokenLimit).getStartOffset();
+                endContentPosition = tokenStartOffsets[startTokenIndex + tokenLimit];
                 chunkResult.add(content.substring(startContentPosition, endContentPosition));
             }
             startTokenIndex += tokenLimit - overlapTokenNumber;
@@ -155,13 +160,35 @@ public final class FixedTokenLengthChunker extends Chunker {
         return chunkResult;
     }
 
-    private List<AnalyzeToken> tokenize(final String content, final String tokenizer, final int maxTokenCount) {
-        AnalyzeAction.Request analyzeRequest = new AnalyzeAction.Request();
-        analyzeRequest.text(content);
-        analyzeRequest.tokenizer(tokenizer);
+    /**
+     * Tokenizes the content and returns the start offset of every token. Only offsets are needed to find chunk
+     * boundaries, so no token objects are created.
+     */
+    private int[] tokenize(final String content, final String tokenizer, final int maxTokenCount) {
         try {
-            AnalyzeAction.Response analyzeResponse = analyze(analyzeRequest, analysisRegistry, null, maxTokenCount);
-            return analyzeResponse.getTokens();
+            Analyzer analyzer = analyzerCache.getAnalyzer(tokenizer);
+            int[] startOffsets = new int[Math.max(16, Math.min(content.length() / 4, maxTokenCount))];
+            int tokenCount = 0;
+            try (TokenStream stream = analyzer.tokenStream("", content)) {
+                OffsetAttribute offsetAttribute = stream.addAttribute(OffsetAttribute.class);
+                stream.reset();
+                while (stream.incrementToken()) {
+                    if (++tokenCount > maxTokenCount) {
+                        throw new IllegalStateException(
+                            "The number of tokens produced by calling _analyze has exceeded the allowed maximum of ["
+                                + maxTokenCount
+                                + "]."
+                                + " This limit can be set by changing the [index.analyze.max_token_count] index level setting."
+                        );
+                    }
+                    if (tokenCount > startOffsets.length) {
+                        startOffsets = Arrays.copyOf(startOffsets, startOffsets.length * 2);
+                    }
+                    startOffsets[tokenCount - 1] = offsetAttribute.startOffset();
+                }
+                stream.end();
+            }
+            return tokenCount == startOffsets.length ? startOffsets : Arrays.copyOf(startOffsets, tokenCount);
         } catch (Exception e) {
             throw new IllegalStateException(String.format(Locale.ROOT, "analyzer %s throws exception: %s", tokenizer, e.getMessage()), e);
         }
@@ -0,0 +1,69 @@
+/*
+ * Copyright OpenSearch Contributors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+package org.opensearch.neuralsearch.processor.chunker;
+
+import java.io.Closeable;
+import java.io.IOException;
+import java.io.UncheckedIOException;
+import java.util.ArrayList;
+import java.util.List;
+import java.util.Map;
+import java.util.concurrent.ConcurrentHashMap;
+
+import lombok.NonNull;
+import org.apache.lucene.analysis.Analyzer;
+import org.opensearch.common.util.io.IOUtils;
+import org.opensearch.index.analysis.AnalysisRegistry;
+import org.opensearch.index.analysis.NameOrDefinition;
+
+/**
+ * Analyzers of the tokenizers used by {@link FixedTokenLengthChunker}, built once from the analysis registry of the node
+ * the same way the _analyze API builds them for a tokenizer name. An analyzer reuses its token stream per thread, so all
+ * chunkers of the processors sharing this cache reuse them. The owner of the cache closes it together with the registry,
+ * which closes all built analyzers.
+ */
+public final class TokenizerAnalyzerCache implements Closeable {
+    private final AnalysisRegistry analysisRegistry;
+    private final Map<String, Analyzer> analyzers = new ConcurrentHashMap<>();
+    private volatile boolean closed;
+
+    public TokenizerAnalyzerCache(final AnalysisRegistry analysisRegistry) {
+        this.analysisRegistry = analysisRegistry;
+    }
+
+    /**
+     * Returns the analyzer of a tokenizer, building it on first use
+     *
+     * @param tokenizer name of the tokenizer
+     * @return analyzer of the tokenizer
+     */
+    public Analyzer getAnalyzer(@NonNull final String tokenizer) {
+        if (closed) {
+            throw new IllegalStateException("tokenizer analyzer cache is closed");
+        }
+        return analyzers.computeIfAbsent(tokenizer, name -> {
+            try {
+                return analysisRegistry.buildCustomAnalyzer(null, false, new NameOrDefinition(name), List.of(), List.of());
+            } catch (IOException e) {
+                throw new UncheckedIOException(e);
+            }
+        });
+    }
+
+    /**
+     * @return number of built analyzers
+     */
+    int size() {
+        return analyzers.size();
+    }
+
+    @Override
+    public void close() throws IOException {
+        closed = true;
+        List<Analyzer> builtAnalyzers = new ArrayList<>(analyzers.values());
+        analyzers.clear();
+        IOUtils.close(builtAnalyzers);
+    }
+}
@@ -0,0 +1,243 @@
+/*
+ * Copyright OpenSearch Contributors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+package org.opensearch.neuralsearch.processor.combination;
+
+import java.util.Arrays;
+import java.util.List;
+
+import org.apache.lucene.search.ScoreDoc;
+import org.apache.lucene.search.TopDocs;
+import org.apache.lucene.util.IntroSelector;
+import org.apache.lucene.util.IntroSorter;
+
+/**
+ * Normalized scores per subquery and combined scores of the documents of one shard. Doc ids are mapped to dense
+ * indexes by an open addressing table of primitive ints, and the scores of all documents are held in one float array
+ * with a row per document, so collecting, combining and ranking the scores neither boxes doc ids nor scores.
+ * Documents are ranked by combined score descending, ties are broken by doc id ascending.
+ */
+final class DocScoresTable {
+    private static final int EMPTY_SLOT = -1;
+
+    private final int numberOfSubQueries;
+    // index of the document in docIds for every slot of the hash table, EMPTY_SLOT for free slots
+    private final int[] slots;
+    private final int slotMask;
+    private final int slotShift;
+    private final int[] docIds;
+    // normalized score of document i for subquery j at i * numberOfSubQueries + j
+    private final float[] scores;
+    private final float[] combinedScores;
+    // false for documents filtered out by the min score
+    private final boolean[] matching;
+    private int size;
+    private int matchingSize;
+
+    private DocScoresTable(int numberOfSubQueries, int maxDocuments) {
+        this.numberOfSubQueries = numberOfSubQueries;
+        int tableSize = Integer.highestOneBit(Math.max(2, maxDocuments * 2 - 1)) << 1;
+        this.slots = new int[tableSize];
+        Arrays.fill(slots, EMPTY_SLOT);
+        this.slotMask = tableSize - 1;
+        this.slotShift = Integer.numberOfLeadingZeros(slotMask);
+        this.docIds = new int[maxDocuments];
+        this.scores = new float[maxDocuments * numberOfSubQueries];
+        this.combinedScores = new float[maxDocuments];
+        this.matching = new boolean[maxDocuments];
+    }
+
+    /**
+     * @param topDocsPerSubQuery normalized results of every subquery of one shard
+     * @return table of the normalized scores of every document, zero for subqueries that did not match the document
+     */
+    static DocScoresTable of(final List<TopDocs> topDocsPerSubQuery) {
+        int maxDocuments = 0;
+        for (TopDocs topDocs : topDocsPerSubQuery) {
+            maxDocuments += topDocs.scoreDocs.length;
+        }
+        DocScoresTable table = new DocScoresTable(topDocsPerSubQuery.size(), maxDocuments);
+        for (int subQueryIndex = 0; subQueryIndex < topDocsPerSubQuery.size(); subQueryIndex++) {
+            for (ScoreDoc scoreDoc : topDocsPerSubQuery.get(subQueryIndex).scoreDocs) {
+                table.scores[table.indexOrAdd(scoreDoc.doc) * table.numberOfSubQueries + subQueryIndex] = scoreDoc.score;
+            }
+        }
+        return table;
+    }
+
+    /**
+     * Combines the scores of every document and marks the documents reaching the min score as matching
+     *
+     * @param scoreCombinationTechnique technique combining the scores of a document
+     * @param minScore min combined score of matching documents, null if all documents match
+     */
+    void combine(final ScoreCombinationTechnique scoreCombinationTechnique, final Float minScore) {
+        float[] documentScores = new float[numberOfSubQueries];
+        matchingSize = 0;
+        for (int index = 0; index < size; index++) {
+            System.arraycopy(scores, index * numberOfSubQueries, documentScores, 0, numberOfSubQueries);
+            float combinedScore = scoreCombinationTechnique.combine(documentScores);
+            combinedScores[index] = combinedScore;
+            matching[index] = minScore == null || combinedScore >= minScore;
+            if (matching[index]) {
+                matchingSize++;
+            }
+        }
+    }
+
+    /**
+     * @return number of documents
+     */
+    int size() {
+        return size;
+    }
+
+    /**
+     * @return number of documents reaching the min score
+     */
+    int matchingSize() {
+        return matchingSize;
+    }
+
+    /**
+     * @param docId id of a document
+     * @return true if the document is in the results and reaches the min score
+     */
+    boolean isMatching(int docId) {
+        int index = indexOf(docId);
+        return index != EMPTY_SLOT && matching[index];
+    }
+
+    /**
+     * @param docId id of a document of the results
+     * @return combined score of the document
+     */
+    float getCombinedScore(int docId) {
+        int index = indexOf(docId);
+        if (index == EMPTY_SLOT) {
+            throw new IllegalArgumentException("document [" + docId + "] is not in the results of the shard");
+        }
+        return combinedScores[index];
+    }
+
+    /**
+     * Selects the best matching documents by combined score without sorting the others
+     *
+     * @param maxDocuments maximum number of documents
+     * @return ids of the best matching documents, sorted by combined score descending and doc id ascending
+     */
+    int[] getTopDocIds(long maxDocuments) {
+        int[] indexes = new int[matchingSize];
+        int count = 0;
+        for (int index = 0; index < size; index++) {
+            if (matching[index]) {
+                indexes[count++] = index;
+            }
+        }
+        int topCount = (int) Math.min(maxDocuments, count);
+        if (topCount < count) {
+            new IndexSelector(indexes).select(0, count, topCount);
+        }
+        new IndexSorter(indexes).sort(0, topCount);
+        int[] topDocIds = new int[topCount];
+        for (int i = 0; i < topCount; i++) {
+            topDocIds[i] = docIds[indexes[i]];
+        }
+        return topDocIds;
+    }
+
+    /**
+     * @param docId id of a document
+     * @return dense index of the document, EMPTY_SLOT if the document is not in the results
+     */
+    int indexOf(int docId) {
+        for (int slot = slotOf(docId);; slot = (slot + 1) & slotMask) {
+            int index = slots[slot];
+            if (index == EMPTY_SLOT || docIds[index] == docId) {
+                return index;
+            }
+        }
+    }
+
+    private int indexOrAdd(int docId) {
+        for (int slot = slotOf(docId);; slot = (slot + 1) & slotMask) {
+            int index = slots[slot];
+            if (index == EMPTY_SLOT) {
+                docIds[size] = docId;
+                slots[slot] = size;
+                return size++;
+            }
+            if (docIds[index] == docId) {
+                return index;
+            }
+        }
+    }
+
+    private int slotOf(int docId) {
+        // Fibonacci hashing spreads the mostly sequential doc ids over the table
+        return (docId * 0x9E3779B9) >>> slotShift;
+    }
+
+    private int compareIndexes(int index1, int index2) {
+        int scoreComparison = Float.compare(combinedScores[index2], combinedScores[index1]);
+        return scoreComparison != 0 ? scoreComparison : Integer.compare(docIds[index1], docIds[index2]);
+    }
+
+    private final class IndexSelector extends IntroSelector {
+        private final int[] indexes;
+        private int pivot;
+
+        IndexSelector(int[] indexes) {
+            this.indexes = indexes;
+        }
+
+        @Override
+        protected void swap(int i, int j) {
+            int index = indexes[i];
+            indexes[i] = indexes[j];
+            indexes[j] = index;
+        }
+
+        @Override
+        protected void setPivot(int i) {
+            pivot = indexes[i];
+        }
+
+        @Override
+        protected int comparePivot(int j) {
+            return compareIndexes(pivot, indexes[j]);
+        }
+    }
+
+    private final class IndexSorter extends IntroSorter {
+        private final int[] indexes;
+        private int pivot;
+
+        IndexSorter(int[] indexes) {
+            this.indexes = indexes;
+        }
+
+        @Override
+        protected void swap(int i, int j) {
+            int index = indexes[i];
+            indexes[i] = indexes[j];
+            indexes[j] = index;
+        }
+
+        @Override
+        protected int compare(int i, int j) {
+            return compareIndexes(indexes[i], indexes[j]);
+        }
+
+        @Override
+        protected void setPivot(int i) {
+            pivot = indexes[i];
+        }
+
+        @Override
+        protected int comparePivot(int j) {
+            return compareIndexes(pivot, indexes[j]);
+        }
+    }
+}
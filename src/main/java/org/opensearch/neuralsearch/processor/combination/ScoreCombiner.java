@@ -6,18 +6,14 @@ package org.opensearch.neuralsearch.processor.combination;
 
 import java.util.ArrayList;
 import java.util.Arrays;
-import java.util.Collection;
 import java.util.HashMap;
 import java.util.List;
 import java.util.Locale;
 import java.util.Map;
-import java.util.Set;
 import java.util.Objects;
 import java.util.Comparator;
-import java.util.LinkedHashSet;
 
-import java.util.function.Predicate;
-import java.util.stream.Collectors;
+import java.util.function.IntPredicate;
 
 import org.apache.commons.lang3.tuple.Pair;
 import org.apache.lucene.search.TopDocs;
@@ -60,12 +56,12 @@ public class ScoreCombiner {
     /**
      * Performs score combination based on input combination technique. Mutates input object by updating combined scores
      * Main steps we're doing for combination:
-     * - create map of normalized scores per doc id
-     * - using normalized scores create another map of combined scores per doc id
+     * - create table of normalized scores per doc id
+     * - using normalized scores compute combined scores per doc id
      * - count max number of hits among sub-queries
-     * - sort documents by scores and take first "max number" of docs
+     * - select the first "max number" of docs by scores
      * - update query search results with normalized scores
-     * Different score combination techniques are different in step 2, where we create map of "doc id" - "combined score",
+     * Different score combination techniques are different in step 2, where we compute the "combined score" of a "doc id",
      * other steps are same for all techniques.
      *
      * @param combineScoresDTO   contains details of query top docs, score combination technique and sort is enabled or disabled.
@@ -95,38 +91,29 @@ public class ScoreCombiner {
         }
         List<TopDocs> topDocsPerSubQuery = compoundQueryTopDocs.getTopDocs();
 
-        // - create map of normalized scores results returned from the single shard
-        Map<Integer, float[]> normalizedScoresPerDoc = getNormalizedScoresPerDocument(topDocsPerSubQuery);
+        // - create table of normalized scores results returned from the single shard and combine them per doc id
+        DocScoresTable docScoresTable = getCombinedScoresTable(topDocsPerSubQuery, scoreCombinationTechnique, minScore, sort);
 
-        // - create map of combined scores per doc id
-        Map<Integer, Float> combinedNormalizedScoresByDocId = combineScoresAndGetCombinedNormalizedScoresPerDocument(
-            normalizedScoresPerDoc,
-            scoreCombinationTechnique,
-            minScore,
-            sort
-        );
-
-        // - sort documents by scores and take first "max number" of docs
-        // create a collection of doc ids that are sorted by their combined scores
-        Collection<Integer> sortedDocsIds = getSortedDocsIds(compoundQueryTopDocs, sort, combinedNormalizedScoresByDocId, minScore);
+        // - select documents by scores and take first "max number" of docs
+        // create an array of doc ids that are sorted by their combined scores
+        long maxHits = compoundQueryTopDocs.getTotalHits().value();
+        int[] sortedDocsIds = getSortedDocsIds(compoundQueryTopDocs, sort, docScoresTable, minScore, maxHits);
 
         // - get new total hits
-        long maxHits = compoundQueryTopDocs.getTotalHits().value();
         TotalHits existingTotalHits = getTotalHits(topDocsPerSubQuery, maxHits);
         TotalHits newTotalHits = getTotalHits(
             existingTotalHits,
-            normalizedScoresPerDoc.size(),
-            sortedDocsIds.size(),
+            docScoresTable.size(),
+            docScoresTable.matchingSize(),
             isMinScoreAvailable(minScore, sort)
         );
 
         // - update query search results with combined scores
         updateQueryTopDocsWithCombinedScores(
             compoundQueryTopDocs,
-            topDocsPerSubQuery,
-            combinedNormalizedScoresByDocId,
+            docScoresTable,
             sortedDocsIds,
-            getDocIdSortFieldsMap(compoundQueryTopDocs, combinedNormalizedScoresByDocId, sort),
+            getDocIdSortFieldsMap(compoundQueryTopDocs, docScoresTable, sort),
             sort,
             isSingleShard,
             newTotalHits
@@ -185,7 +172,7 @@ public class ScoreCombiner {
     private List<TopFieldDocs> getTopFieldDocs(
         final Sort sort,
         final List<TopDocs> topDocsPerSubQuery,
-        final Predicate<Integer> docIdFilter
+        final IntPredicate docIdFilter
     ) {
         if (sort == null) {
             return null;
@@ -218,13 +205,13 @@ public class ScoreCombiner {
 
     /**
      * @param compoundTopDocs top docs that represent on shard
-     * @param combinedNormalizedScoresByDocId docId to normalized scores map
+     * @param docScoresTable combined scores per docId
      * @param sort sort criteria
      * @return map of docId and sort fields if sorting is enabled.
      */
     private Map<Integer, Object[]> getDocIdSortFieldsMap(
         final CompoundTopDocs compoundTopDocs,
-        final Map<Integer, Float> combinedNormalizedScoresByDocId,
+        final DocScoresTable docScoresTable,
         final Sort sort
     ) {
         // If sort is null then no sort fields present therefore return null.
@@ -247,7 +234,7 @@ public class ScoreCombiner {
                     Object[] sortFields;
 
                     if (isSortByScore) {
-                        sortFields = new Object[] { combinedNormalizedScoresByDocId.get(fieldDoc.doc) };
+                        sortFields = new Object[] { docScoresTable.getCombinedScore(fieldDoc.doc) };
                     } else {
                         sortFields = fieldDoc.fields;
                     }
@@ -271,14 +258,12 @@ public class ScoreCombiner {
         return result;
     }
 
-    private List<Integer> getSortedDocIds(final Map<Integer, Float> combinedNormalizedScoresByDocId) {
-        // we're merging docs with normalized and combined scores. we need to have only maxHits results
-        List<Integer> sortedDocsIds = new ArrayList<>(combinedNormalizedScoresByDocId.keySet());
-        sortedDocsIds.sort((a, b) -> Float.compare(combinedNormalizedScoresByDocId.get(b), combinedNormalizedScoresByDocId.get(a)));
-        return sortedDocsIds;
-    }
-
-    private Set<Integer> getSortedDocIdsBySortCriteria(final List<TopFieldDocs> topFieldDocs, final Sort sort) {
+    private int[] getSortedDocIdsBySortCriteria(
+        final List<TopFieldDocs> topFieldDocs,
+        final Sort sort,
+        final DocScoresTable docScoresTable,
+        final long maxDocs
+    ) {
         if (Objects.isNull(topFieldDocs)) {
             throw new IllegalArgumentException("topFieldDocs cannot be null when sorting is enabled.");
         }
@@ -303,17 +288,26 @@ public class ScoreCombiner {
         final TopDocs sortedTopDocs = TopDocs.merge(sort, 0, size, topFieldDocs.toArray(new TopFieldDocs[0]), SORTING_TIE_BREAKER);
 
         // Remove duplicates from the sorted top docs.
-        Set<Integer> uniqueDocIds = new LinkedHashSet<>();
+        boolean[] seen = new boolean[docScoresTable.size()];
+        int[] uniqueDocIds = new int[(int) Math.min(maxDocs, docScoresTable.size())];
+        int uniqueDocCount = 0;
         for (ScoreDoc scoreDoc : sortedTopDocs.scoreDocs) {
-            uniqueDocIds.add(scoreDoc.doc);
+            if (uniqueDocCount == uniqueDocIds.length) {
+                break;
+            }
+            int index = docScoresTable.indexOf(scoreDoc.doc);
+            if (seen[index] == false) {
+                seen[index] = true;
+                uniqueDocIds[uniqueDocCount++] = scoreDoc.doc;
+            }
         }
-        return uniqueDocIds;
+        return uniqueDocCount == uniqueDocIds.length ? uniqueDocIds : Arrays.copyOf(uniqueDocIds, uniqueDocCount);
     }
 
     private List<ScoreDoc> getCombinedScoreDocs(
         final CompoundTopDocs compoundQueryTopDocs,
-        final Map<Integer, Float> combinedNormalizedScoresByDocId,
-        final Collection<Integer> sortedScores,
+        final DocScoresTable docScoresTable,
+        final int[] sortedScores,
         final long maxHits,
         final Map<Integer, Object[]> docIdSortFieldMap,
         final Sort sort,
@@ -326,14 +320,10 @@ public class ScoreCombiner {
         if (!compoundQueryTopDocs.getScoreDocs().isEmpty()) {
             shardId = compoundQueryTopDocs.getScoreDocs().get(0).shardIndex;
         }
-        List<ScoreDoc> scoreDocs = new ArrayList<>();
-        int hitCount = 0;
-        for (Integer docId : sortedScores) {
-            if (hitCount == maxHits) {
-                break;
-            }
-            scoreDocs.add(getScoreDoc(sort, docId, shardId, combinedNormalizedScoresByDocId, docIdSortFieldMap, isSingleShard));
-            hitCount++;
+        int hitCount = (int) Math.min(maxHits, sortedScores.length);
+        List<ScoreDoc> scoreDocs = new ArrayList<>(hitCount);
+        for (int i = 0; i < hitCount; i++) {
+            scoreDocs.add(getScoreDoc(sort, sortedScores[i], shardId, docScoresTable, docIdSortFieldMap, isSingleShard));
         }
         return scoreDocs;
     }
@@ -342,7 +332,7 @@ public class ScoreCombiner {
         final Sort sort,
         final int docId,
         final int shardId,
-        final Map<Integer, Float> combinedNormalizedScoresByDocId,
+        final DocScoresTable docScoresTable,
         final Map<Integer, Object[]> docIdSortFieldMap,
         final boolean isSingleShard
     ) {
@@ -353,52 +343,29 @@ public class ScoreCombiner {
             return new FieldDoc(docId, Float.NaN, docIdSortFieldMap.get(docId), shardId);
         }
         if (isSortEnabled && docIdSortFieldMap != null) {
-            return new FieldDoc(docId, combinedNormalizedScoresByDocId.get(docId), docIdSortFieldMap.get(docId), shardId);
-        }
-        return new ScoreDoc(docId, combinedNormalizedScoresByDocId.get(docId), shardId);
-    }
-
-    public Map<Integer, float[]> getNormalizedScoresPerDocument(final List<TopDocs> topDocsPerSubQuery) {
-        Map<Integer, float[]> normalizedScoresPerDoc = new HashMap<>();
-        for (int j = 0; j < topDocsPerSubQuery.size(); j++) {
-            TopDocs topDocs = topDocsPerSubQuery.get(j);
-            for (ScoreDoc scoreDoc : topDocs.scoreDocs) {
-                normalizedScoresPerDoc.computeIfAbsent(scoreDoc.doc, key -> {
-                    float[] scores = new float[topDocsPerSubQuery.size()];
-                    // we initialize with -1.0, as after normalization it's possible that score is 0.0
-                    return scores;
-                });
-                normalizedScoresPerDoc.get(scoreDoc.doc)[j] = scoreDoc.score;
-            }
+            return new FieldDoc(docId, docScoresTable.getCombinedScore(docId), docIdSortFieldMap.get(docId), shardId);
         }
-        return normalizedScoresPerDoc;
+        return new ScoreDoc(docId, docScoresTable.getCombinedScore(docId), shardId);
     }
 
-    private Map<Integer, Float> combineScoresAndGetCombinedNormalizedScoresPerDocument(
-        final Map<Integer, float[]> normalizedScoresPerDocument,
+    /**
+     * @return table of the normalized scores of the documents of one shard, combined and filtered by the min score
+     */
+    private DocScoresTable getCombinedScoresTable(
+        final List<TopDocs> topDocsPerSubQuery,
         final ScoreCombinationTechnique scoreCombinationTechnique,
         final Float minScore,
         final Sort sort
     ) {
-        // 1. Prepare the stream
-        var stream = normalizedScoresPerDocument.entrySet().stream();
-
-        // 2. If minScore is available, combine AND filter in one pass
-        if (isMinScoreAvailable(minScore, sort)) {
-            return stream.map(e -> Map.entry(e.getKey(), scoreCombinationTechnique.combine(e.getValue())))
-                .filter(e -> e.getValue() >= minScore)
-                .collect(Collectors.toMap(Map.Entry::getKey, Map.Entry::getValue));
-        }
-
-        // 3. If minScore is NOT available, just combine and collect
-        return stream.collect(Collectors.toMap(Map.Entry::getKey, e -> scoreCombinationTechnique.combine(e.getValue())));
+        DocScoresTable docScoresTable = DocScoresTable.of(topDocsPerSubQuery);
+        docScoresTable.combine(scoreCombinationTechnique, isMinScoreAvailable(minScore, sort) ? minScore : null);
+        return docScoresTable;
     }
 
     private void updateQueryTopDocsWithCombinedScores(
         final CompoundTopDocs compoundQueryTopDocs,
-        final List<TopDocs> topDocsPerSubQuery,
-        final Map<Integer, Float> combinedNormalizedScoresByDocId,
-        final Collection<Integer> sortedScores,
+        final DocScoresTable docScoresTable,
+        final int[] sortedScores,
         Map<Integer, Object[]> docIdSortFieldMap,
         final Sort sort,
         final boolean isSingleShard,
@@ -408,15 +375,7 @@ public class ScoreCombiner {
         long maxHits = compoundQueryTopDocs.getTotalHits().value();
         // - update query search results with normalized scores
         compoundQueryTopDocs.setScoreDocs(
-            getCombinedScoreDocs(
-                compoundQueryTopDocs,
-                combinedNormalizedScoresByDocId,
-                sortedScores,
-                maxHits,
-                docIdSortFieldMap,
-                sort,
-                isSingleShard
-            )
+            getCombinedScoreDocs(compoundQueryTopDocs, docScoresTable, sortedScores, maxHits, docIdSortFieldMap, sort, isSingleShard)
         );
         compoundQueryTopDocs.setTotalHits(newTotalHits);
     }
@@ -462,18 +421,16 @@ public class ScoreCombiner {
         if (Objects.isNull(compoundQueryTopDocs) || compoundQueryTopDocs.getTotalHits().value() == 0) {
             return List.of();
         }
-        // create map of normalized scores results returned from the single shard
-        Map<Integer, float[]> normalizedScoresPerDoc = getNormalizedScoresPerDocument(compoundQueryTopDocs.getTopDocs());
-        // combine scores
-        Map<Integer, Float> combinedNormalizedScoresByDocId = combineScoresAndGetCombinedNormalizedScoresPerDocument(
-            normalizedScoresPerDoc,
+        // create table of normalized scores results returned from the single shard and combine scores
+        DocScoresTable docScoresTable = getCombinedScoresTable(
+            compoundQueryTopDocs.getTopDocs(),
             scoreCombinationTechnique,
             minScore,
             sort
         );
 
         // sort combined scores as per sorting criteria - either score desc or field sorting
-        Collection<Integer> sortedDocsIds = getSortedDocsIds(compoundQueryTopDocs, sort, combinedNormalizedScoresByDocId, minScore);
+        int[] sortedDocsIds = getSortedDocsIds(compoundQueryTopDocs, sort, docScoresTable, minScore, Long.MAX_VALUE);
 
         List<ExplanationDetails> listOfExplanations = new ArrayList<>();
         String combinationDescription = String.format(
@@ -485,27 +442,25 @@ public class ScoreCombiner {
         for (int docId : sortedDocsIds) {
             ExplanationDetails explanation = new ExplanationDetails(
                 docId,
-                List.of(Pair.of(combinedNormalizedScoresByDocId.get(docId), combinationDescription))
+                List.of(Pair.of(docScoresTable.getCombinedScore(docId), combinationDescription))
             );
             listOfExplanations.add(explanation);
         }
         return listOfExplanations;
     }
 
-    private Collection<Integer> getSortedDocsIds(
+    private int[] getSortedDocsIds(
         final CompoundTopDocs compoundQueryTopDocs,
         final Sort sort,
-        final Map<Integer, Float> combinedNormalizedScoresByDocId,
-        final Float minScore
+        final DocScoresTable docScoresTable,
+        final Float minScore,
+        final long maxDocs
     ) {
-        Collection<Integer> sortedDocsIds;
         if (sort != null) {
             List<TopDocs> topDocsPerSubQuery = compoundQueryTopDocs.getTopDocs();
-            Predicate<Integer> docIdFilter = isMinScoreAvailable(minScore, sort) ? combinedNormalizedScoresByDocId::containsKey : null;
-            sortedDocsIds = getSortedDocIdsBySortCriteria(getTopFieldDocs(sort, topDocsPerSubQuery, docIdFilter), sort);
-        } else {
-            sortedDocsIds = getSortedDocIds(combinedNormalizedScoresByDocId);
+            IntPredicate docIdFilter = isMinScoreAvailable(minScore, sort) ? docScoresTable::isMatching : null;
+            return getSortedDocIdsBySortCriteria(getTopFieldDocs(sort, topDocsPerSubQuery, docIdFilter), sort, docScoresTable, maxDocs);
         }
-        return sortedDocsIds;
+        return docScoresTable.getTopDocIds(maxDocs);
     }
 }
@@ -7,12 +7,12 @@ package org.opensearch.neuralsearch.processor.dto;
 import lombok.Builder;
 import lombok.Data;
 import lombok.NonNull;
-import org.opensearch.index.analysis.AnalysisRegistry;
 import org.opensearch.neuralsearch.mapper.dto.ChunkingConfig;
 import org.opensearch.neuralsearch.mapper.dto.SparseEncodingConfig;
 import org.opensearch.neuralsearch.processor.chunker.Chunker;
 import org.opensearch.neuralsearch.processor.chunker.ChunkerFactory;
 import org.opensearch.neuralsearch.processor.chunker.FixedTokenLengthChunker;
+import org.opensearch.neuralsearch.processor.chunker.TokenizerAnalyzerCache;
 
 import java.util.ArrayList;
 import java.util.HashMap;
@@ -135,7 +135,7 @@ public class SemanticFieldInfo {
         return new StringBuilder().append(semanticInfoFullPathInDoc).append(PATH_SEPARATOR).append(MODEL_FIELD_NAME).toString();
     }
 
-    public void setChunkingConfig(final ChunkingConfig chunkingConfig, @NonNull final AnalysisRegistry analysisRegistry) {
+    public void setChunkingConfig(final ChunkingConfig chunkingConfig, @NonNull final TokenizerAnalyzerCache analyzerCache) {
         if (chunkingConfig == null) {
             chunkingEnabled = false;
             return;
@@ -150,7 +150,7 @@ public class SemanticFieldInfo {
                     ? new HashMap<>()
                     : new HashMap<>((Map<String, Object>) paramObject);
                 if (FixedTokenLengthChunker.ALGORITHM_NAME.equals(algorithm)) {
-                    parameters.put(FixedTokenLengthChunker.ANALYSIS_REGISTRY_FIELD, analysisRegistry);
+                    parameters.put(FixedTokenLengthChunker.ANALYZER_CACHE_FIELD, analyzerCache);
                 }
                 chunkers.add(ChunkerFactory.create(algorithm, parameters));
             }
@@ -7,11 +7,11 @@ package org.opensearch.neuralsearch.processor.factory;
 import org.opensearch.cluster.service.ClusterService;
 import org.opensearch.common.settings.Settings;
 import org.opensearch.env.Environment;
-import org.opensearch.index.analysis.AnalysisRegistry;
 import org.opensearch.ingest.AbstractBatchingSystemProcessor;
 import org.opensearch.neuralsearch.processor.chunker.Chunker;
 import org.opensearch.neuralsearch.processor.chunker.ChunkerFactory;
 import org.opensearch.neuralsearch.processor.chunker.FixedTokenLengthChunker;
+import org.opensearch.neuralsearch.processor.chunker.TokenizerAnalyzerCache;
 import org.opensearch.neuralsearch.util.SemanticMappingUtils;
 import org.opensearch.neuralsearch.ml.MLCommonsClientAccessor;
 import org.opensearch.neuralsearch.processor.semantic.SemanticFieldProcessor;
@@ -48,21 +48,21 @@ public final class SemanticFieldProcessorFactory extends AbstractBatchingSystemP
     private final Environment environment;
 
     private final ClusterService clusterService;
-    private final AnalysisRegistry analysisRegistry;
+    private final TokenizerAnalyzerCache analyzerCache;
     private final OpenSearchClient openSearchClient;
 
     public SemanticFieldProcessorFactory(
         final MLCommonsClientAccessor mlClientAccessor,
         final Environment environment,
         final ClusterService clusterService,
-        final AnalysisRegistry analysisRegistry,
+        final TokenizerAnalyzerCache analyzerCache,
         final OpenSearchClient openSearchClient
     ) {
         super(PROCESSOR_FACTORY_TYPE);
         this.mlClientAccessor = mlClientAccessor;
         this.environment = environment;
         this.clusterService = clusterService;
-        this.analysisRegistry = analysisRegistry;
+        this.analyzerCache = analyzerCache;
         this.openSearchClient = openSearchClient;
     }
 
@@ -131,7 +131,7 @@ public final class SemanticFieldProcessorFactory extends AbstractBatchingSystemP
             environment,
             clusterService,
             createDefaultTextChunker(),
-            analysisRegistry,
+            analyzerCache,
             openSearchClient
         );
     }
@@ -142,7 +142,7 @@ public final class SemanticFieldProcessorFactory extends AbstractBatchingSystemP
      */
     private Chunker createDefaultTextChunker() {
         final Map<String, Object> chunkerParameters = new HashMap<>();
-        chunkerParameters.put(FixedTokenLengthChunker.ANALYSIS_REGISTRY_FIELD, analysisRegistry);
+        chunkerParameters.put(FixedTokenLengthChunker.ANALYZER_CACHE_FIELD, analyzerCache);
         return ChunkerFactory.create(FixedTokenLengthChunker.ALGORITHM_NAME, chunkerParameters);
     }
 }
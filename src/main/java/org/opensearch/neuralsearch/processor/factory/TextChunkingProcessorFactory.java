@@ -8,9 +8,9 @@ import java.util.Map;
 
 import org.opensearch.cluster.service.ClusterService;
 import org.opensearch.env.Environment;
-import org.opensearch.index.analysis.AnalysisRegistry;
 import org.opensearch.ingest.Processor;
 import org.opensearch.neuralsearch.processor.TextChunkingProcessor;
+import org.opensearch.neuralsearch.processor.chunker.TokenizerAnalyzerCache;
 import static org.opensearch.neuralsearch.processor.TextChunkingProcessor.TYPE;
 import static org.opensearch.neuralsearch.processor.TextChunkingProcessor.FIELD_MAP_FIELD;
 import static org.opensearch.neuralsearch.processor.TextChunkingProcessor.ALGORITHM_FIELD;
@@ -31,12 +31,12 @@ public class TextChunkingProcessorFactory implements Processor.Factory {
 
     private final ClusterService clusterService;
 
-    private final AnalysisRegistry analysisRegistry;
+    private final TokenizerAnalyzerCache analyzerCache;
 
-    public TextChunkingProcessorFactory(Environment environment, ClusterService clusterService, AnalysisRegistry analysisRegistry) {
+    public TextChunkingProcessorFactory(Environment environment, ClusterService clusterService, TokenizerAnalyzerCache analyzerCache) {
         this.environment = environment;
         this.clusterService = clusterService;
-        this.analysisRegistry = analysisRegistry;
+        this.analyzerCache = analyzerCache;
     }
 
     @Override
@@ -57,7 +57,7 @@ public class TextChunkingProcessorFactory implements Processor.Factory {
             ignoreMissing,
             environment,
             clusterService,
-            analysisRegistry
+            analyzerCache
         );
     }
 }
@@ -6,7 +6,9 @@ package org.opensearch.neuralsearch.processor.factory;
 
 import static org.opensearch.ingest.ConfigurationUtils.readBooleanProperty;
 import static org.opensearch.ingest.ConfigurationUtils.readMap;
+import static org.opensearch.ingest.ConfigurationUtils.readOptionalStringProperty;
 import static org.opensearch.ingest.ConfigurationUtils.readStringProperty;
+import static org.opensearch.neuralsearch.processor.TextEmbeddingProcessor.CONTENT_HASH_FIELD;
 import static org.opensearch.neuralsearch.processor.TextEmbeddingProcessor.SKIP_EXISTING;
 import static org.opensearch.neuralsearch.processor.TextEmbeddingProcessor.DEFAULT_SKIP_EXISTING;
 import static org.opensearch.neuralsearch.processor.TextEmbeddingProcessor.TYPE;
@@ -54,6 +56,7 @@ public final class TextEmbeddingProcessorFactory extends AbstractBatchingProcess
         String modelId = readStringProperty(TYPE, tag, config, MODEL_ID_FIELD);
         Map<String, Object> fieldMap = readMap(TYPE, tag, config, FIELD_MAP_FIELD);
         boolean skipExisting = readBooleanProperty(TYPE, tag, config, SKIP_EXISTING, DEFAULT_SKIP_EXISTING);
+        String contentHashField = readOptionalStringProperty(TYPE, tag, config, CONTENT_HASH_FIELD);
         return new TextEmbeddingProcessor(
             tag,
             description,
@@ -61,7 +64,8 @@ public final class TextEmbeddingProcessorFactory extends AbstractBatchingProcess
             modelId,
             fieldMap,
             skipExisting,
-            skipExisting ? new TextEmbeddingInferenceFilter(fieldMap) : null,
+            skipExisting || contentHashField != null ? new TextEmbeddingInferenceFilter(fieldMap) : null,
+            contentHashField,
             openSearchClient,
             clientAccessor,
             environment,
@@ -4,7 +4,7 @@
  */
 package org.opensearch.neuralsearch.processor.normalization;
 
-import java.util.ArrayList;
+import java.util.Arrays;
 import java.util.HashMap;
 import java.util.List;
 import java.util.Locale;
@@ -24,7 +24,6 @@ import org.opensearch.neuralsearch.processor.explain.ExplanationDetails;
 import org.opensearch.neuralsearch.processor.explain.ExplainableTechnique;
 
 import static org.opensearch.neuralsearch.processor.explain.ExplanationUtils.getDocIdAtQueryForNormalization;
-import static org.opensearch.neuralsearch.processor.util.ProcessorUtils.getNumOfSubqueries;
 
 /**
  * Abstracts normalization of scores based on L2 method
@@ -53,22 +52,8 @@ public class L2ScoreNormalizationTechnique implements ScoreNormalizationTechniqu
     @Override
     public void normalize(final NormalizeScoresDTO normalizeScoresDTO) {
         List<CompoundTopDocs> queryTopDocs = normalizeScoresDTO.getQueryTopDocs();
-        // get l2 norms for each sub-query
-        List<Float> normsPerSubquery = getL2Norm(queryTopDocs);
-
         // do normalization using actual score and l2 norm
-        for (CompoundTopDocs compoundQueryTopDocs : queryTopDocs) {
-            if (Objects.isNull(compoundQueryTopDocs)) {
-                continue;
-            }
-            List<TopDocs> topDocsPerSubQuery = compoundQueryTopDocs.getTopDocs();
-            for (int j = 0; j < topDocsPerSubQuery.size(); j++) {
-                TopDocs subQueryTopDoc = topDocsPerSubQuery.get(j);
-                for (ScoreDoc scoreDoc : subQueryTopDoc.scoreDocs) {
-                    scoreDoc.score = normalizeSingleScore(scoreDoc.score, normsPerSubquery.get(j));
-                }
-            }
-        }
+        normalizeScores(SubQueryScores.of(queryTopDocs)).writeBack(queryTopDocs);
     }
 
     @Override
@@ -84,9 +69,9 @@ public class L2ScoreNormalizationTechnique implements ScoreNormalizationTechniqu
     @Override
     public Map<DocIdAtSearchShard, ExplanationDetails> explain(final ExplainDTO explainDTO) {
         List<CompoundTopDocs> queryTopDocs = explainDTO.getQueryTopDocs();
-        Map<DocIdAtSearchShard, List<Float>> normalizedScores = new HashMap<>();
-        List<Float> normsPerSubquery = getL2Norm(queryTopDocs);
+        normalizeScores(SubQueryScores.of(queryTopDocs)).writeBack(queryTopDocs);
 
+        Map<DocIdAtSearchShard, List<Float>> normalizedScores = new HashMap<>();
         for (CompoundTopDocs compoundQueryTopDocs : queryTopDocs) {
             if (Objects.isNull(compoundQueryTopDocs)) {
                 continue;
@@ -97,50 +82,34 @@ public class L2ScoreNormalizationTechnique implements ScoreNormalizationTechniqu
                 TopDocs subQueryTopDoc = topDocsPerSubQuery.get(subQueryIndex);
                 for (ScoreDoc scoreDoc : subQueryTopDoc.scoreDocs) {
                     DocIdAtSearchShard docIdAtSearchShard = new DocIdAtSearchShard(scoreDoc.doc, compoundQueryTopDocs.getSearchShard());
-                    float normalizedScore = normalizeSingleScore(scoreDoc.score, normsPerSubquery.get(subQueryIndex));
                     ScoreNormalizationUtil.setNormalizedScore(
                         normalizedScores,
                         docIdAtSearchShard,
                         subQueryIndex,
                         numberOfSubQueries,
-                        normalizedScore
+                        scoreDoc.score
                     );
-                    scoreDoc.score = normalizedScore;
                 }
             }
         }
         return getDocIdAtQueryForNormalization(normalizedScores, this);
     }
 
-    private List<Float> getL2Norm(final List<CompoundTopDocs> queryTopDocs) {
-        // find any non-empty compound top docs, it's either empty if shard does not have any results for all of sub-queries,
-        // or it has results for all the sub-queries. In edge case of shard having results only for one sub-query, there will be TopDocs for
-        // rest of sub-queries with zero total hits
-        int numOfSubqueries = getNumOfSubqueries(queryTopDocs);
-        float[] l2Norms = new float[numOfSubqueries];
-        for (CompoundTopDocs compoundQueryTopDocs : queryTopDocs) {
-            if (Objects.isNull(compoundQueryTopDocs)) {
+    /**
+     * Divides the scores of every sub query by the l2 norm of the sub query, in place
+     */
+    private SubQueryScores normalizeScores(final SubQueryScores subQueryScores) {
+        for (int subQueryIndex = 0; subQueryIndex < subQueryScores.getNumberOfSubQueries(); subQueryIndex++) {
+            float[] scores = subQueryScores.getScores(subQueryIndex);
+            float l2Norm = subQueryScores.getStatistics(subQueryIndex).getL2Norm();
+            if (l2Norm == 0) {
+                Arrays.fill(scores, MIN_SCORE);
                 continue;
             }
-            List<TopDocs> topDocsPerSubQuery = compoundQueryTopDocs.getTopDocs();
-            int bound = topDocsPerSubQuery.size();
-            for (int index = 0; index < bound; index++) {
-                for (ScoreDoc scoreDocs : topDocsPerSubQuery.get(index).scoreDocs) {
-                    l2Norms[index] += scoreDocs.score * scoreDocs.score;
-                }
+            for (int i = 0; i < scores.length; i++) {
+                scores[i] = scores[i] / l2Norm;
             }
         }
-        for (int index = 0; index < l2Norms.length; index++) {
-            l2Norms[index] = (float) Math.sqrt(l2Norms[index]);
-        }
-        List<Float> l2NormList = new ArrayList<>();
-        for (int index = 0; index < numOfSubqueries; index++) {
-            l2NormList.add(l2Norms[index]);
-        }
-        return l2NormList;
-    }
-
-    private float normalizeSingleScore(final float score, final float l2Norm) {
-        return l2Norm == 0 ? MIN_SCORE : score / l2Norm;
+        return subQueryScores;
     }
 }
@@ -4,7 +4,6 @@
  */
 package org.opensearch.neuralsearch.processor.normalization;
 
-import java.util.Arrays;
 import java.util.HashMap;
 import java.util.List;
 import java.util.Locale;
@@ -14,8 +13,6 @@ import java.util.Optional;
 import java.util.Set;
 import java.util.stream.Collectors;
 
-import lombok.AllArgsConstructor;
-import lombok.Getter;
 import org.apache.commons.lang3.Validate;
 import org.apache.lucene.search.ScoreDoc;
 import org.apache.lucene.search.TopDocs;
@@ -37,7 +34,6 @@ import org.opensearch.neuralsearch.processor.normalization.bounds.UpperBound;
 import static org.opensearch.neuralsearch.processor.explain.ExplanationUtils.getDocIdAtQueryForNormalization;
 import static org.opensearch.neuralsearch.processor.normalization.bounds.ScoreBound.MAX_BOUND_SCORE;
 import static org.opensearch.neuralsearch.processor.normalization.bounds.ScoreBound.MIN_BOUND_SCORE;
-import static org.opensearch.neuralsearch.processor.util.ProcessorUtils.getNumOfSubqueries;
 import static org.opensearch.neuralsearch.query.HybridQueryBuilder.MAX_NUMBER_OF_SUB_QUERIES;
 
 /**
@@ -87,8 +83,12 @@ public class MinMaxScoreNormalizationTechnique implements ScoreNormalizationTech
     @Override
     public void normalize(final NormalizeScoresDTO normalizeScoresDTO) {
         final List<CompoundTopDocs> queryTopDocs = normalizeScoresDTO.getQueryTopDocs();
-        MinMaxScores minMaxScores = getMinMaxScoresResult(queryTopDocs);
+        validateBoundsCount(queryTopDocs);
         // do normalization using actual score and min and max scores for corresponding sub query
+        normalizeScores(SubQueryScores.of(queryTopDocs)).writeBack(queryTopDocs);
+    }
+
+    private void validateBoundsCount(final List<CompoundTopDocs> queryTopDocs) {
         for (CompoundTopDocs compoundQueryTopDocs : queryTopDocs) {
             if (Objects.isNull(compoundQueryTopDocs)) {
                 continue;
@@ -103,21 +103,25 @@ public class MinMaxScoreNormalizationTechnique implements ScoreNormalizationTech
                     )
                 );
             }
-            for (int j = 0; j < topDocsPerSubQuery.size(); j++) {
-                TopDocs subQueryTopDoc = topDocsPerSubQuery.get(j);
-                LowerBound lowerBound = getLowerBound(j);
-                UpperBound upperBound = getUpperBound(j);
-                for (ScoreDoc scoreDoc : subQueryTopDoc.scoreDocs) {
-                    scoreDoc.score = normalizeSingleScore(
-                        scoreDoc.score,
-                        minMaxScores.getMinScoresPerSubquery()[j],
-                        minMaxScores.getMaxScoresPerSubquery()[j],
-                        lowerBound,
-                        upperBound
-                    );
-                }
+        }
+    }
+
+    /**
+     * Normalizes the scores of every sub query in place using min and max scores gathered with the scores
+     */
+    private SubQueryScores normalizeScores(final SubQueryScores subQueryScores) {
+        for (int subQueryIndex = 0; subQueryIndex < subQueryScores.getNumberOfSubQueries(); subQueryIndex++) {
+            float[] scores = subQueryScores.getScores(subQueryIndex);
+            ScoreStatistics statistics = subQueryScores.getStatistics(subQueryIndex);
+            float minScore = Math.min(Float.MAX_VALUE, statistics.getMin());
+            float maxScore = Math.max(Float.MIN_VALUE, statistics.getMax());
+            LowerBound lowerBound = getLowerBound(subQueryIndex);
+            UpperBound upperBound = getUpperBound(subQueryIndex);
+            for (int i = 0; i < scores.length; i++) {
+                scores[i] = normalizeSingleScore(scores[i], minScore, maxScore, lowerBound, upperBound);
             }
         }
+        return subQueryScores;
     }
 
     private boolean isBoundsAndSubQueriesCountMismatched(List<TopDocs> topDocsPerSubQuery) {
@@ -138,15 +142,6 @@ public class MinMaxScoreNormalizationTechnique implements ScoreNormalizationTech
         return upperBoundsParamsOptional.map(bounds -> bounds.get(subQueryIndex)).map(UpperBound::new).orElseGet(UpperBound::new);
     }
 
-    private MinMaxScores getMinMaxScoresResult(final List<CompoundTopDocs> queryTopDocs) {
-        int numOfSubqueries = getNumOfSubqueries(queryTopDocs);
-        // get min scores for each sub query
-        float[] minScoresPerSubquery = getMinScores(queryTopDocs, numOfSubqueries);
-        // get max scores for each sub query
-        float[] maxScoresPerSubquery = getMaxScores(queryTopDocs, numOfSubqueries);
-        return new MinMaxScores(minScoresPerSubquery, maxScoresPerSubquery);
-    }
-
     @Override
     public String techniqueName() {
         return TECHNIQUE_NAME;
@@ -179,7 +174,7 @@ public class MinMaxScoreNormalizationTechnique implements ScoreNormalizationTech
     @Override
     public Map<DocIdAtSearchShard, ExplanationDetails> explain(final ExplainDTO explainDTO) {
         final List<CompoundTopDocs> queryTopDocs = explainDTO.getQueryTopDocs();
-        MinMaxScores minMaxScores = getMinMaxScoresResult(queryTopDocs);
+        normalizeScores(SubQueryScores.of(queryTopDocs)).writeBack(queryTopDocs);
 
         Map<DocIdAtSearchShard, List<Float>> normalizedScores = new HashMap<>();
         for (CompoundTopDocs compoundQueryTopDocs : queryTopDocs) {
@@ -192,71 +187,19 @@ public class MinMaxScoreNormalizationTechnique implements ScoreNormalizationTech
                 TopDocs subQueryTopDoc = topDocsPerSubQuery.get(subQueryIndex);
                 for (ScoreDoc scoreDoc : subQueryTopDoc.scoreDocs) {
                     DocIdAtSearchShard docIdAtSearchShard = new DocIdAtSearchShard(scoreDoc.doc, compoundQueryTopDocs.getSearchShard());
-                    LowerBound lowerBound = getLowerBound(subQueryIndex);
-                    UpperBound upperBound = getUpperBound(subQueryIndex);
-                    float normalizedScore = normalizeSingleScore(
-                        scoreDoc.score,
-                        minMaxScores.getMinScoresPerSubquery()[subQueryIndex],
-                        minMaxScores.getMaxScoresPerSubquery()[subQueryIndex],
-                        lowerBound,
-                        upperBound
-                    );
                     ScoreNormalizationUtil.setNormalizedScore(
                         normalizedScores,
                         docIdAtSearchShard,
                         subQueryIndex,
                         numberOfSubQueries,
-                        normalizedScore
+                        scoreDoc.score
                     );
-                    scoreDoc.score = normalizedScore;
                 }
             }
         }
         return getDocIdAtQueryForNormalization(normalizedScores, this);
     }
 
-    private float[] getMaxScores(final List<CompoundTopDocs> queryTopDocs, final int numOfSubqueries) {
-        float[] maxScores = new float[numOfSubqueries];
-        Arrays.fill(maxScores, Float.MIN_VALUE);
-        for (CompoundTopDocs compoundQueryTopDocs : queryTopDocs) {
-            if (Objects.isNull(compoundQueryTopDocs)) {
-                continue;
-            }
-            List<TopDocs> topDocsPerSubQuery = compoundQueryTopDocs.getTopDocs();
-            for (int j = 0; j < topDocsPerSubQuery.size(); j++) {
-                maxScores[j] = Math.max(
-                    maxScores[j],
-                    Arrays.stream(topDocsPerSubQuery.get(j).scoreDocs)
-                        .map(scoreDoc -> scoreDoc.score)
-                        .max(Float::compare)
-                        .orElse(Float.MIN_VALUE)
-                );
-            }
-        }
-        return maxScores;
-    }
-
-    private float[] getMinScores(final List<CompoundTopDocs> queryTopDocs, final int numOfScores) {
-        float[] minScores = new float[numOfScores];
-        Arrays.fill(minScores, Float.MAX_VALUE);
-        for (CompoundTopDocs compoundQueryTopDocs : queryTopDocs) {
-            if (Objects.isNull(compoundQueryTopDocs)) {
-                continue;
-            }
-            List<TopDocs> topDocsPerSubQuery = compoundQueryTopDocs.getTopDocs();
-            for (int j = 0; j < topDocsPerSubQuery.size(); j++) {
-                minScores[j] = Math.min(
-                    minScores[j],
-                    Arrays.stream(topDocsPerSubQuery.get(j).scoreDocs)
-                        .map(scoreDoc -> scoreDoc.score)
-                        .min(Float::compare)
-                        .orElse(Float.MAX_VALUE)
-                );
-            }
-        }
-        return minScores;
-    }
-
     private float normalizeSingleScore(
         final float score,
         final float minScore,
@@ -375,14 +318,4 @@ public class MinMaxScoreNormalizationTechnique implements ScoreNormalizationTech
             );
         }
     }
-
-    /**
-     * Result class to hold min and max scores for each sub query
-     */
-    @AllArgsConstructor
-    @Getter
-    private static class MinMaxScores {
-        float[] minScoresPerSubquery;
-        float[] maxScoresPerSubquery;
-    }
 }
@@ -4,15 +4,13 @@
  */
 package org.opensearch.neuralsearch.processor.normalization;
 
-import java.math.BigDecimal;
-import java.math.RoundingMode;
+import java.util.Arrays;
 import java.util.Comparator;
 import java.util.HashMap;
 import java.util.List;
 import java.util.Map;
 import java.util.Objects;
 import java.util.Locale;
-import java.util.PriorityQueue;
 import java.util.Set;
 
 import lombok.NonNull;
@@ -51,11 +49,8 @@ public class RRFNormalizationTechnique implements ScoreNormalizationTechnique, E
     private static final Range<Integer> RANK_CONSTANT_RANGE = Range.of(MIN_RANK_CONSTANT, MAX_RANK_CONSTANT);
     @ToString.Include
     private final int rankConstant;
-    // Comparator to compare ShardResultPerSubQuery
-    private static final Comparator<ShardResultPerSubQuery> comparator = Comparator.comparing(
-        (ShardResultPerSubQuery sr) -> sr.scoreDoc,
-        ScoreDoc.COMPARATOR
-    ).thenComparingInt(sr -> sr.referenceShardId);
+    // normalized score of every rank, grown on demand and shared by all requests using this technique
+    private volatile float[] rankScores = new float[0];
 
     public RRFNormalizationTechnique(final Map<String, Object> params, final ScoreNormalizationUtil scoreNormalizationUtil) {
         scoreNormalizationUtil.validateParameters(params, SUPPORTED_PARAMS, Map.of());
@@ -77,60 +72,57 @@ public class RRFNormalizationTechnique implements ScoreNormalizationTechnique, E
     public void normalize(final NormalizeScoresDTO normalizeScoresDTO) {
         final List<CompoundTopDocs> queryTopDocs = normalizeScoresDTO.getQueryTopDocs();
 
-        Map<Integer, Map<String, Integer>> sortedDocIdsPerSubqueryByGlobalRank = normalizeScoresDTO.isSingleShard()
-            ? Map.of()
-            : sortDocumentsAsPerGlobalRankInIndividualQuery(queryTopDocs);
+        int[][][] globalRanks = normalizeScoresDTO.isSingleShard() ? null : rankDocumentsAcrossShards(queryTopDocs);
+        float[] rankScores = getRankScores(queryTopDocs);
 
         for (int referenceShardId = 0; referenceShardId < queryTopDocs.size(); referenceShardId++) {
             processTopDocs(
                 queryTopDocs.get(referenceShardId),
                 (docId, score, subQueryIndex) -> {},
-                sortedDocIdsPerSubqueryByGlobalRank,
-                referenceShardId
+                Objects.isNull(globalRanks) ? null : globalRanks[referenceShardId],
+                rankScores
             );
         }
     }
 
-    private Map<Integer, Map<String, Integer>> sortDocumentsAsPerGlobalRankInIndividualQuery(
-        @NonNull final List<CompoundTopDocs> queryTopDocs
-    ) {
-        // Map: subQueryIndex -> PQ that contains ScoreDocs from all shards
-        Map<Integer, PriorityQueue<ShardResultPerSubQuery>> scoreDocsPerSubquery = new HashMap<>();
-        for (int referenceShardId = 0; referenceShardId < queryTopDocs.size(); referenceShardId++) {
+    /**
+     * Ranks the documents of every subquery across all shards. Results of a subquery are already sorted per shard,
+     * so they are k-way merged with a heap of shards instead of sorting the documents of all shards.
+     *
+     * @param queryTopDocs results of all shards
+     * @return for every shard and subquery the global rank of the document at each position, null for missing shards
+     */
+    private static int[][][] rankDocumentsAcrossShards(@NonNull final List<CompoundTopDocs> queryTopDocs) {
+        final int numberOfShards = queryTopDocs.size();
+        final int[][][] globalRanks = new int[numberOfShards][][];
+        int numberOfSubQueries = 0;
+        for (int referenceShardId = 0; referenceShardId < numberOfShards; referenceShardId++) {
             CompoundTopDocs compoundTopDocs = queryTopDocs.get(referenceShardId);
-            if (Objects.isNull(compoundTopDocs)) {
-                continue;
-            }
-            // List of subquery results
-            List<TopDocs> topDocs = compoundTopDocs.getTopDocs();
-            for (int topDocIndex = 0; topDocIndex < topDocs.size(); topDocIndex++) {
-                TopDocs topDoc = topDocs.get(topDocIndex);
-                scoreDocsPerSubquery.putIfAbsent(topDocIndex, new PriorityQueue<>(comparator));
-                ScoreDoc[] scoreDocs = topDoc.scoreDocs;
-                // Insert all the scoreDocs in priority queue that holds results across all shards for the subquery
-                for (int scoreDocIndex = 0; scoreDocIndex < scoreDocs.length; scoreDocIndex++) {
-                    scoreDocsPerSubquery.get(topDocIndex).add(new ShardResultPerSubQuery(scoreDocs[scoreDocIndex], referenceShardId));
-                }
+            if (Objects.nonNull(compoundTopDocs)) {
+                globalRanks[referenceShardId] = new int[compoundTopDocs.getTopDocs().size()][];
+                numberOfSubQueries = Math.max(numberOfSubQueries, globalRanks[referenceShardId].length);
             }
         }
 
-        Map<Integer, Map<String, Integer>> globallySortedDocIdMap = new HashMap<>();
-        // Traverse all scoreDocs per subquery and add it in the map with docId-shardId order.
-        // We created docId-shardId format because docId can be same across different shards but the combination is unique.
-        for (Map.Entry<Integer, PriorityQueue<ShardResultPerSubQuery>> entry : scoreDocsPerSubquery.entrySet()) {
-            int subQueryNumber = entry.getKey();
-            globallySortedDocIdMap.putIfAbsent(subQueryNumber, new HashMap<>());
-
-            PriorityQueue<ShardResultPerSubQuery> sortedScoreDocsAcrossAllShards = entry.getValue();
-            // first rank
+        final ShardMerge shardMerge = new ShardMerge(numberOfShards);
+        for (int subQueryIndex = 0; subQueryIndex < numberOfSubQueries; subQueryIndex++) {
+            shardMerge.reset();
+            for (int referenceShardId = 0; referenceShardId < numberOfShards; referenceShardId++) {
+                int[][] shardRanks = globalRanks[referenceShardId];
+                if (Objects.isNull(shardRanks) || subQueryIndex >= shardRanks.length) {
+                    continue;
+                }
+                ScoreDoc[] scoreDocs = queryTopDocs.get(referenceShardId).getTopDocs().get(subQueryIndex).scoreDocs;
+                shardRanks[subQueryIndex] = new int[scoreDocs.length];
+                shardMerge.add(referenceShardId, scoreDocs);
+            }
             int rank = 0;
-            while (!sortedScoreDocsAcrossAllShards.isEmpty()) {
-                ShardResultPerSubQuery shardResultPerSubQuery = sortedScoreDocsAcrossAllShards.poll();
-                globallySortedDocIdMap.get(subQueryNumber)
-                    .put(shardResultPerSubQuery.scoreDoc.doc + "_" + shardResultPerSubQuery.referenceShardId, rank++);
+            while (shardMerge.isEmpty() == false) {
+                int referenceShardId = shardMerge.topShard();
+                globalRanks[referenceShardId][subQueryIndex][shardMerge.popPosition()] = rank++;
             }
         }
-        return globallySortedDocIdMap;
+        return globalRanks;
     }
 
     @Override
@@ -147,9 +139,8 @@ public class RRFNormalizationTechnique implements ScoreNormalizationTechnique, E
     public Map<DocIdAtSearchShard, ExplanationDetails> explain(final ExplainDTO explainDTO) {
         final List<CompoundTopDocs> queryTopDocs = explainDTO.getQueryTopDocs();
         Map<DocIdAtSearchShard, List<Float>> normalizedScores = new HashMap<>();
-        Map<Integer, Map<String, Integer>> sortedDocIdsPerSubqueryByGlobalRank = explainDTO.isSingleShard()
-            ? Map.of()
-            : sortDocumentsAsPerGlobalRankInIndividualQuery(queryTopDocs);
+        int[][][] globalRanks = explainDTO.isSingleShard() ? null : rankDocumentsAcrossShards(queryTopDocs);
+        float[] rankScores = getRankScores(queryTopDocs);
         for (int referenceShardId = 0; referenceShardId < queryTopDocs.size(); referenceShardId++) {
             CompoundTopDocs compoundQueryTopDocs = queryTopDocs.get(referenceShardId);
             if (Objects.isNull(compoundQueryTopDocs)) {
@@ -166,8 +157,8 @@ public class RRFNormalizationTechnique implements ScoreNormalizationTechnique, E
                     numberOfSubQueries,
                     score
                 ),
-                sortedDocIdsPerSubqueryByGlobalRank,
-                referenceShardId
+                Objects.isNull(globalRanks) ? null : globalRanks[referenceShardId],
+                rankScores
             );
         }
 
@@ -177,8 +168,8 @@ public class RRFNormalizationTechnique implements ScoreNormalizationTechnique, E
     private void processTopDocs(
         CompoundTopDocs compoundQueryTopDocs,
         TriConsumer<DocIdAtSearchShard, Float, Integer> scoreProcessor,
-        Map<Integer, Map<String, Integer>> sortedDocIdMapPerSubqueryByGlobalRank,
-        int referenceShardId
+        int[][] globalRanksPerSubQuery,
+        float[] rankScores
     ) {
         if (Objects.isNull(compoundQueryTopDocs)) {
             return;
@@ -188,10 +179,8 @@ public class RRFNormalizationTechnique implements ScoreNormalizationTechnique, E
         SearchShard searchShard = compoundQueryTopDocs.getSearchShard();
 
         for (int topDocsIndex = 0; topDocsIndex < topDocsList.size(); topDocsIndex++) {
-            Map<String, Integer> docIdToRankMap = sortedDocIdMapPerSubqueryByGlobalRank.isEmpty()
-                ? Map.of()
-                : sortedDocIdMapPerSubqueryByGlobalRank.get(topDocsIndex);
-            processTopDocsEntry(topDocsList.get(topDocsIndex), searchShard, topDocsIndex, scoreProcessor, docIdToRankMap, referenceShardId);
+            int[] globalRanks = Objects.isNull(globalRanksPerSubQuery) ? null : globalRanksPerSubQuery[topDocsIndex];
+            processTopDocsEntry(topDocsList.get(topDocsIndex), searchShard, topDocsIndex, scoreProcessor, globalRanks, rankScores);
         }
     }
 
@@ -200,26 +189,48 @@ public class RRFNormalizationTechnique implements ScoreNormalizationTechnique, E
         SearchShard searchShard,
         int topDocsIndex,
         TriConsumer<DocIdAtSearchShard, Float, Integer> scoreProcessor,
-        Map<String, Integer> docIdToRankMap,
-        int referenceShardId
+        int[] globalRanks,
+        float[] rankScores
     ) {
         for (int position = 0; position < topDocs.scoreDocs.length; position++) {
             ScoreDoc scoreDoc = topDocs.scoreDocs[position];
-            Integer rank = docIdToRankMap.isEmpty() ? position : docIdToRankMap.get(scoreDoc.doc + "_" + referenceShardId);
-            if (Objects.isNull(rank) || rank < 0) {
-                throw new IllegalStateException(
-                    "Document not found in global ranking map: doc=" + scoreDoc.doc + ", shard=" + referenceShardId
-                );
-            }
-            float normalizedScore = calculateNormalizedScore(rank);
+            int rank = Objects.isNull(globalRanks) ? position : globalRanks[position];
+            float normalizedScore = rankScores[rank];
             DocIdAtSearchShard docIdAtSearchShard = new DocIdAtSearchShard(scoreDoc.doc, searchShard);
             scoreProcessor.apply(docIdAtSearchShard, normalizedScore, topDocsIndex);
             scoreDoc.score = normalizedScore;
         }
     }
 
-    private float calculateNormalizedScore(int position) {
-        return BigDecimal.ONE.divide(BigDecimal.valueOf(rankConstant + position + 1), 10, RoundingMode.HALF_UP).floatValue();
+    /**
+     * @return normalized scores of all ranks the documents of the results can get, at most the total number of
+     * documents of a subquery across shards
+     */
+    private float[] getRankScores(final List<CompoundTopDocs> queryTopDocs) {
+        int maxRanks = 0;
+        int[] documentsPerSubQuery = new int[0];
+        for (CompoundTopDocs compoundTopDocs : queryTopDocs) {
+            if (Objects.isNull(compoundTopDocs)) {
+                continue;
+            }
+            List<TopDocs> topDocsList = compoundTopDocs.getTopDocs();
+            if (topDocsList.size() > documentsPerSubQuery.length) {
+                documentsPerSubQuery = Arrays.copyOf(documentsPerSubQuery, topDocsList.size());
+            }
+            for (int subQueryIndex = 0; subQueryIndex < topDocsList.size(); subQueryIndex++) {
+                documentsPerSubQuery[subQueryIndex] += topDocsList.get(subQueryIndex).scoreDocs.length;
+                maxRanks = Math.max(maxRanks, documentsPerSubQuery[subQueryIndex]);
+            }
+        }
+        float[] scores = rankScores;
+        if (scores.length < maxRanks) {
+            scores = new float[Math.max(maxRanks, scores.length * 2)];
+            for (int rank = 0; rank < scores.length; rank++) {
+                scores[rank] = (float) (1.0d / (rankConstant + rank + 1));
+            }
+            rankScores = scores;
+        }
+        return scores;
     }
 
     private int getRankConstant(final Map<String, Object> params) {
@@ -252,10 +263,117 @@ public class RRFNormalizationTechnique implements ScoreNormalizationTechnique, E
     }
 
     /**
-     * Record to store shard results per subquery
-     * @param scoreDoc scoreDoc result
-     * @param referenceShardId reference shard Id for identifying scoreDoc
+     * Heap of shards ordered by the next document of their results of a subquery, ties are broken by the shard id.
+     * Results that are not sorted, which collectors do not produce, are merged in sorted order of their positions.
      */
-    private record ShardResultPerSubQuery(ScoreDoc scoreDoc, int referenceShardId) {
+    private static final class ShardMerge {
+        private final int[] heap;
+        private final ScoreDoc[][] scoreDocs;
+        // positions of the results of a shard in sorted order, null if the results are sorted
+        private final int[][] sortedPositions;
+        private final int[] cursors;
+        private int size;
+
+        ShardMerge(int numberOfShards) {
+            this.heap = new int[numberOfShards];
+            this.scoreDocs = new ScoreDoc[numberOfShards][];
+            this.sortedPositions = new int[numberOfShards][];
+            this.cursors = new int[numberOfShards];
+        }
+
+        void reset() {
+            size = 0;
+        }
+
+        boolean isEmpty() {
+            return size == 0;
+        }
+
+        void add(int shard, ScoreDoc[] shardScoreDocs) {
+            if (shardScoreDocs.length == 0) {
+                return;
+            }
+            scoreDocs[shard] = shardScoreDocs;
+            sortedPositions[shard] = sortedPositionsIfUnsorted(shardScoreDocs);
+            cursors[shard] = 0;
+            int index = size++;
+            heap[index] = shard;
+            while (index > 0) {
+                int parent = (index - 1) >>> 1;
+                if (compare(heap[parent], heap[index]) <= 0) {
+                    break;
+                }
+                swap(parent, index);
+                index = parent;
+            }
+        }
+
+        int topShard() {
+            return heap[0];
+        }
+
+        /**
+         * Removes the next document of the top shard
+         *
+         * @return position of the document in the results of the top shard
+         */
+        int popPosition() {
+            int shard = heap[0];
+            int position = position(shard);
+            if (++cursors[shard] == scoreDocs[shard].length) {
+                heap[0] = heap[--size];
+            }
+            siftDown();
+            return position;
+        }
+
+        private int position(int shard) {
+            return Objects.isNull(sortedPositions[shard]) ? cursors[shard] : sortedPositions[shard][cursors[shard]];
+        }
+
+        private void siftDown() {
+            int index = 0;
+            while (true) {
+                int smallest = index;
+                int left = 2 * index + 1;
+                int right = left + 1;
+                if (left < size && compare(heap[left], heap[smallest]) < 0) {
+                    smallest = left;
+                }
+                if (right < size && compare(heap[right], heap[smallest]) < 0) {
+                    smallest = right;
+                }
+                if (smallest == index) {
+                    return;
+                }
+                swap(index, smallest);
+                index = smallest;
+            }
+        }
+
+        private int compare(int shard1, int shard2) {
+            int result = ScoreDoc.COMPARATOR.compare(scoreDocs[shard1][position(shard1)], scoreDocs[shard2][position(shard2)]);
+            return result != 0 ? result : Integer.compare(shard1, shard2);
+        }
+
+        private void swap(int index1, int index2) {
+            int shard = heap[index1];
+            heap[index1] = heap[index2];
+            heap[index2] = shard;
+        }
+
+        private static int[] sortedPositionsIfUnsorted(ScoreDoc[] shardScoreDocs) {
+            for (int position = 1; position < shardScoreDocs.length; position++) {
+                if (ScoreDoc.COMPARATOR.compare(shardScoreDocs[position - 1], shardScoreDocs[position]) > 0) {
+                    Integer[] positions = new Integer[shardScoreDocs.length];
+                    for (int i = 0; i < positions.length; i++) {
+                        positions[i] = i;
+                    }
+                    Arrays.sort(positions, Comparator.comparing((Integer i) -> shardScoreDocs[i], ScoreDoc.COMPARATOR));
+                    return Arrays.stream(positions).mapToInt(Integer::intValue).toArray();
+                }
+            }
+            return null;
+        }
     }
 }
@@ -0,0 +1,115 @@
+/*
+ * Copyright OpenSearch Contributors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+package org.opensearch.neuralsearch.processor.normalization;
+
+/**
+ * Statistics of the scores of one sub query: count, min, max, sum of squares, mean and sum of squared differences from
+ * the mean. Statistics of every shard are computed in one pass over the scores of the shard and folded into the
+ * statistics of all shards as the shard results are gathered, so no pass over the scores of all shards is needed.
+ */
+final class ScoreStatistics {
+    private long count;
+    private float min = Float.POSITIVE_INFINITY;
+    private float max = Float.NEGATIVE_INFINITY;
+    private double sumOfSquares;
+    private double mean;
+    // sum of squared differences from the mean
+    private double m2;
+
+    /**
+     * Adds a range of scores, e.g. the scores of a sub query of one shard
+     *
+     * @param scores array holding the scores
+     * @param from index of the first score, inclusive
+     * @param to index of the last score, exclusive
+     */
+    void add(final float[] scores, final int from, final int to) {
+        int rangeCount = to - from;
+        if (rangeCount <= 0) {
+            return;
+        }
+        // mean and variance of the range are accumulated relative to its first score, which keeps the single pass
+        // variance stable for scores with a large mean and a small spread
+        float shift = scores[from];
+        float rangeMin = Float.POSITIVE_INFINITY;
+        float rangeMax = Float.NEGATIVE_INFINITY;
+        double rangeSumOfSquares = 0;
+        double shiftedSum = 0;
+        double shiftedSumOfSquares = 0;
+        for (int i = from; i < to; i++) {
+            float score = scores[i];
+            double shifted = (double) score - shift;
+            rangeMin = Math.min(rangeMin, score);
+            rangeMax = Math.max(rangeMax, score);
+            rangeSumOfSquares += (double) score * score;
+            shiftedSum += shifted;
+            shiftedSumOfSquares += shifted * shifted;
+        }
+        double rangeMean = shift + shiftedSum / rangeCount;
+        double rangeM2 = Math.max(0, shiftedSumOfSquares - shiftedSum * shiftedSum / rangeCount);
+        fold(rangeCount, rangeMin, rangeMax, rangeSumOfSquares, rangeMean, rangeM2);
+    }
+
+    private void fold(long otherCount, float otherMin, float otherMax, double otherSumOfSquares, double otherMean, double otherM2) {
+        long mergedCount = count + otherCount;
+        // pairwise update of Chan et al., exact for the mean and stable for the sum of squared differences
+        double delta = otherMean - mean;
+        mean = count == 0 ? otherMean : mean + delta * otherCount / mergedCount;
+        m2 = m2 + otherM2 + delta * delta * ((double) count * otherCount / mergedCount);
+        min = Math.min(min, otherMin);
+        max = Math.max(max, otherMax);
+        sumOfSquares += otherSumOfSquares;
+        count = mergedCount;
+    }
+
+    /**
+     * @return number of scores
+     */
+    long getCount() {
+        return count;
+    }
+
+    /**
+     * @return min score, positive infinity if there are no scores
+     */
+    float getMin() {
+        return min;
+    }
+
+    /**
+     * @return max score, negative infinity if there are no scores
+     */
+    float getMax() {
+        return max;
+    }
+
+    /**
+     * @return square root of the sum of squares of the scores
+     */
+    float getL2Norm() {
+        return (float) Math.sqrt(sumOfSquares);
+    }
+
+    /**
+     * @return mean score, NaN if there are no scores
+     */
+    float getMean() {
+        return count == 0 ? Float.NaN : (float) mean;
+    }
+
+    /**
+     * @return bias corrected standard deviation of the scores, same as the one of commons math descriptive statistics,
+     * NaN if there are no scores
+     */
+    float getStandardDeviation() {
+        if (count == 0) {
+            return Float.NaN;
+        }
+        if (count == 1) {
+            return 0.0f;
+        }
+        return (float) Math.sqrt(m2 / (count - 1));
+    }
+}
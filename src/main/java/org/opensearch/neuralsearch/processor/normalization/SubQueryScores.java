@@ -0,0 +1,115 @@
+/*
+ * Copyright OpenSearch Contributors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+package org.opensearch.neuralsearch.processor.normalization;
+
+import java.util.List;
+import java.util.Objects;
+
+import org.apache.lucene.search.ScoreDoc;
+import org.apache.lucene.search.TopDocs;
+import org.opensearch.neuralsearch.processor.CompoundTopDocs;
+
+import static org.opensearch.neuralsearch.processor.util.ProcessorUtils.getNumOfSubqueries;
+
+/**
+ * Scores of every sub query across all shards gathered into one contiguous float array per sub query, in the order of
+ * the shards and their score docs. Statistics of every sub query are accumulated shard by shard while the scores are
+ * gathered, in one fused pass over the scores of each shard, see {@link ScoreStatistics}. The arrays are normalized in
+ * place by the techniques and written back to the score docs at the end, so normalization reads and writes every score
+ * doc once regardless of the statistics needed.
+ */
+final class SubQueryScores {
+    private final float[][] scoresPerSubQuery;
+    private final ScoreStatistics[] statisticsPerSubQuery;
+
+    private SubQueryScores(float[][] scoresPerSubQuery, ScoreStatistics[] statisticsPerSubQuery) {
+        this.scoresPerSubQuery = scoresPerSubQuery;
+        this.statisticsPerSubQuery = statisticsPerSubQuery;
+    }
+
+    /**
+     * @param queryTopDocs results of all shards, null entries are skipped
+     * @return scores and statistics of every sub query
+     */
+    static SubQueryScores of(final List<CompoundTopDocs> queryTopDocs) {
+        int numberOfSubQueries = getNumOfSubqueries(queryTopDocs);
+        int[] sizes = new int[numberOfSubQueries];
+        for (CompoundTopDocs compoundQueryTopDocs : queryTopDocs) {
+            if (Objects.isNull(compoundQueryTopDocs)) {
+                continue;
+            }
+            List<TopDocs> topDocsPerSubQuery = compoundQueryTopDocs.getTopDocs();
+            for (int subQueryIndex = 0; subQueryIndex < topDocsPerSubQuery.size(); subQueryIndex++) {
+                sizes[subQueryIndex] += topDocsPerSubQuery.get(subQueryIndex).scoreDocs.length;
+            }
+        }
+        float[][] scoresPerSubQuery = new float[numberOfSubQueries][];
+        ScoreStatistics[] statisticsPerSubQuery = new ScoreStatistics[numberOfSubQueries];
+        for (int subQueryIndex = 0; subQueryIndex < numberOfSubQueries; subQueryIndex++) {
+            scoresPerSubQuery[subQueryIndex] = new float[sizes[subQueryIndex]];
+            statisticsPerSubQuery[subQueryIndex] = new ScoreStatistics();
+        }
+        int[] offsets = new int[numberOfSubQueries];
+        for (CompoundTopDocs compoundQueryTopDocs : queryTopDocs) {
+            if (Objects.isNull(compoundQueryTopDocs)) {
+                continue;
+            }
+            List<TopDocs> topDocsPerSubQuery = compoundQueryTopDocs.getTopDocs();
+            for (int subQueryIndex = 0; subQueryIndex < topDocsPerSubQuery.size(); subQueryIndex++) {
+                float[] scores = scoresPerSubQuery[subQueryIndex];
+                int shardStart = offsets[subQueryIndex];
+                for (ScoreDoc scoreDoc : topDocsPerSubQuery.get(subQueryIndex).scoreDocs) {
+                    scores[offsets[subQueryIndex]++] = scoreDoc.score;
+                }
+                statisticsPerSubQuery[subQueryIndex].add(scores, shardStart, offsets[subQueryIndex]);
+            }
+        }
+        return new SubQueryScores(scoresPerSubQuery, statisticsPerSubQuery);
+    }
+
+    /**
+     * Writes the scores of the arrays back to the score docs they have been gathered from
+     *
+     * @param queryTopDocs results of all shards, same as the ones the scores have been gathered from
+     */
+    void writeBack(final List<CompoundTopDocs> queryTopDocs) {
+        int[] offsets = new int[scoresPerSubQuery.length];
+        for (CompoundTopDocs compoundQueryTopDocs : queryTopDocs) {
+            if (Objects.isNull(compoundQueryTopDocs)) {
+                continue;
+            }
+            List<TopDocs> topDocsPerSubQuery = compoundQueryTopDocs.getTopDocs();
+            for (int subQueryIndex = 0; subQueryIndex < topDocsPerSubQuery.size(); subQueryIndex++) {
+                float[] scores = scoresPerSubQuery[subQueryIndex];
+                for (ScoreDoc scoreDoc : topDocsPerSubQuery.get(subQueryIndex).scoreDocs) {
+                    scoreDoc.score = scores[offsets[subQueryIndex]++];
+                }
+            }
+        }
+    }
+
+    /**
+     * @return number of sub queries
+     */
+    int getNumberOfSubQueries() {
+        return scoresPerSubQuery.length;
+    }
+
+    /**
+     * @param subQueryIndex index of the sub query
+     * @return scores of the sub query across all shards, normalized in place by the techniques
+     */
+    float[] getScores(int subQueryIndex) {
+        return scoresPerSubQuery[subQueryIndex];
+    }
+
+    /**
+     * @param subQueryIndex index of the sub query
+     * @return statistics of the scores of the sub query across all shards, as gathered before normalization
+     */
+    ScoreStatistics getStatistics(int subQueryIndex) {
+        return statisticsPerSubQuery[subQueryIndex];
+    }
+}
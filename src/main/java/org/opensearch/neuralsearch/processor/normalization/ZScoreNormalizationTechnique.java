@@ -16,7 +16,6 @@ import java.util.Locale;
 
 import org.apache.lucene.search.ScoreDoc;
 import org.apache.lucene.search.TopDocs;
-import org.apache.commons.math3.stat.descriptive.DescriptiveStatistics;
 
 import com.google.common.primitives.Floats;
 import org.opensearch.neuralsearch.processor.explain.DocIdAtSearchShard;
@@ -24,7 +23,6 @@ import org.opensearch.neuralsearch.processor.explain.ExplainableTechnique;
 import org.opensearch.neuralsearch.processor.explain.ExplanationDetails;
 
 import static org.opensearch.neuralsearch.processor.explain.ExplanationUtils.getDocIdAtQueryForNormalization;
-import static org.opensearch.neuralsearch.processor.util.ProcessorUtils.getNumOfSubqueries;
 
 /**
  * Abstracts normalization of scores based on z score method
@@ -54,28 +52,8 @@ public class ZScoreNormalizationTechnique implements ScoreNormalizationTechnique
     @Override
     public void normalize(NormalizeScoresDTO normalizeScoresDTO) {
         List<CompoundTopDocs> queryTopDocs = normalizeScoresDTO.getQueryTopDocs();
-
-        ZScores zscores = getZScoreResults(queryTopDocs);
-
         // do normalization using actual score and z-scores for corresponding sub query
-        for (CompoundTopDocs compoundQueryTopDocs : queryTopDocs) {
-            if (Objects.isNull(compoundQueryTopDocs)) {
-                continue;
-            }
-            List<TopDocs> topDocsPerSubQuery = compoundQueryTopDocs.getTopDocs();
-            for (int j = 0; j < topDocsPerSubQuery.size(); j++) {
-                TopDocs subQueryTopDoc = topDocsPerSubQuery.get(j);
-                for (ScoreDoc scoreDoc : subQueryTopDoc.scoreDocs) {
-                    scoreDoc.score = normalizeSingleScore(
-                        scoreDoc.score,
-                        zscores.stdPerSubquery[j],
-                        zscores.meanPerSubQuery[j],
-                        zscores.maxPerSubQuery[j],
-                        zscores.minPerSubQuery[j]
-                    );
-                }
-            }
-        }
+        normalizeScores(SubQueryScores.of(queryTopDocs)).writeBack(queryTopDocs);
     }
 
     @Override
@@ -91,8 +69,7 @@ public class ZScoreNormalizationTechnique implements ScoreNormalizationTechnique
     @Override
     public Map<DocIdAtSearchShard, ExplanationDetails> explain(final ExplainDTO explainDTO) {
         List<CompoundTopDocs> queryTopDocs = explainDTO.getQueryTopDocs();
-
-        ZScoreNormalizationTechnique.ZScores zScores = getZScoreResults(queryTopDocs);
+        normalizeScores(SubQueryScores.of(queryTopDocs)).writeBack(queryTopDocs);
 
         Map<DocIdAtSearchShard, List<Float>> normalizedScores = new HashMap<>();
         for (CompoundTopDocs compoundQueryTopDocs : queryTopDocs) {
@@ -105,102 +82,36 @@ public class ZScoreNormalizationTechnique implements ScoreNormalizationTechnique
                 TopDocs subQueryTopDoc = topDocsPerSubQuery.get(subQueryIndex);
                 for (ScoreDoc scoreDoc : subQueryTopDoc.scoreDocs) {
                     DocIdAtSearchShard docIdAtSearchShard = new DocIdAtSearchShard(scoreDoc.doc, compoundQueryTopDocs.getSearchShard());
-                    float normalizedScore = normalizeSingleScore(
-                        scoreDoc.score,
-                        zScores.stdPerSubquery[subQueryIndex],
-                        zScores.meanPerSubQuery[subQueryIndex],
-                        zScores.maxPerSubQuery[subQueryIndex],
-                        zScores.minPerSubQuery[subQueryIndex]
-                    );
                     ScoreNormalizationUtil.setNormalizedScore(
                         normalizedScores,
                         docIdAtSearchShard,
                         subQueryIndex,
                         numberOfSubQueries,
-                        normalizedScore
+                        scoreDoc.score
                     );
-                    scoreDoc.score = normalizedScore;
                 }
             }
         }
         return getDocIdAtQueryForNormalization(normalizedScores, this);
     }
 
-    private static float[] calculateMaxScorePerSubquery(final List<CompoundTopDocs> queryTopDocs, final int numOfSubqueries) {
-        DescriptiveStatistics[] statsPerSubquery = calculateStatsPerSubquery(queryTopDocs, numOfSubqueries);
-
-        float[] maxPerSubQuery = new float[numOfSubqueries];
-        for (int i = 0; i < numOfSubqueries; i++) {
-            maxPerSubQuery[i] = (float) statsPerSubquery[i].getMax();
-        }
-
-        return maxPerSubQuery;
-    }
-
-    private static float[] calculateMinScorePerSubquery(final List<CompoundTopDocs> queryTopDocs, final int numOfSubqueries) {
-        DescriptiveStatistics[] statsPerSubquery = calculateStatsPerSubquery(queryTopDocs, numOfSubqueries);
-
-        float[] minPerSubQuery = new float[numOfSubqueries];
-        for (int i = 0; i < numOfSubqueries; i++) {
-            minPerSubQuery[i] = (float) statsPerSubquery[i].getMin();
-        }
-
-        return minPerSubQuery;
-    }
-
-    private static DescriptiveStatistics[] calculateStatsPerSubquery(final List<CompoundTopDocs> queryTopDocs, final int numOfSubqueries) {
-        DescriptiveStatistics[] statsPerSubquery = new DescriptiveStatistics[numOfSubqueries];
-        for (int i = 0; i < numOfSubqueries; i++) {
-            statsPerSubquery[i] = new DescriptiveStatistics();
-        }
-
-        for (CompoundTopDocs compoundQueryTopDocs : queryTopDocs) {
-            if (Objects.isNull(compoundQueryTopDocs)) {
-                continue;
-            }
-            List<TopDocs> topDocsPerSubQuery = compoundQueryTopDocs.getTopDocs();
-            for (int subQueryIndex = 0; subQueryIndex < topDocsPerSubQuery.size(); subQueryIndex++) {
-                TopDocs topDocs = topDocsPerSubQuery.get(subQueryIndex);
-                for (ScoreDoc scoreDoc : topDocs.scoreDocs) {
-                    statsPerSubquery[subQueryIndex].addValue(scoreDoc.score);
-                }
+    /**
+     * Replaces the scores of every sub query by their z scores, in place, using mean and standard deviation of the
+     * sub query gathered with the scores
+     */
+    private static SubQueryScores normalizeScores(final SubQueryScores subQueryScores) {
+        for (int subQueryIndex = 0; subQueryIndex < subQueryScores.getNumberOfSubQueries(); subQueryIndex++) {
+            float[] scores = subQueryScores.getScores(subQueryIndex);
+            ScoreStatistics statistics = subQueryScores.getStatistics(subQueryIndex);
+            float standardDeviation = statistics.getStandardDeviation();
+            float mean = statistics.getMean();
+            float maxScore = statistics.getMax();
+            float minScore = statistics.getMin();
+            for (int i = 0; i < scores.length; i++) {
+                scores[i] = normalizeSingleScore(scores[i], standardDeviation, mean, maxScore, minScore);
             }
         }
-
-        return statsPerSubquery;
-    }
-
-    private static float[] calculateMeanPerSubquery(final List<CompoundTopDocs> queryTopDocs, final int numOfSubqueries) {
-        DescriptiveStatistics[] statsPerSubquery = calculateStatsPerSubquery(queryTopDocs, numOfSubqueries);
-
-        float[] meanPerSubQuery = new float[numOfSubqueries];
-        for (int i = 0; i < numOfSubqueries; i++) {
-            meanPerSubQuery[i] = (float) statsPerSubquery[i].getMean();
-        }
-
-        return meanPerSubQuery;
-    }
-
-    private static float[] calculateStandardDeviationPerSubquery(final List<CompoundTopDocs> queryTopDocs, final int numOfSubqueries) {
-        DescriptiveStatistics[] statsPerSubquery = calculateStatsPerSubquery(queryTopDocs, numOfSubqueries);
-
-        float[] stdPerSubQuery = new float[numOfSubqueries];
-        for (int i = 0; i < numOfSubqueries; i++) {
-            stdPerSubQuery[i] = (float) statsPerSubquery[i].getStandardDeviation();
-        }
-
-        return stdPerSubQuery;
-    }
-
-    private ZScores getZScoreResults(final List<CompoundTopDocs> queryTopDocs) {
-        int numOfSubqueries = getNumOfSubqueries(queryTopDocs);
-
-        // to be done for each subquery
-        float[] maxPerSubquery = calculateMaxScorePerSubquery(queryTopDocs, numOfSubqueries);
-        float[] minPerSubquery = calculateMinScorePerSubquery(queryTopDocs, numOfSubqueries);
-        float[] meanPerSubQuery = calculateMeanPerSubquery(queryTopDocs, numOfSubqueries);
-        float[] stdPerSubquery = calculateStandardDeviationPerSubquery(queryTopDocs, numOfSubqueries);
-        return new ZScores(meanPerSubQuery, stdPerSubquery, maxPerSubquery, minPerSubquery);
+        return subQueryScores;
     }
 
     private static float normalizeSingleScore(
@@ -222,10 +133,4 @@ public class ZScoreNormalizationTechnique implements ScoreNormalizationTechnique
 
         return normalizedScore <= 0.0f ? MIN_SCORE : normalizedScore;
     }
-
-    /**
-     * Record to hold mean, std dev, max and min scores for each sub query
-     */
-    private record ZScores(float[] meanPerSubQuery, float[] stdPerSubquery, float[] maxPerSubQuery, float[] minPerSubQuery) {
-    }
 }
@@ -0,0 +1,48 @@
+/*
+ * Copyright OpenSearch Contributors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+package org.opensearch.neuralsearch.processor.optimization;
+
+import lombok.AccessLevel;
+import lombok.NoArgsConstructor;
+import lombok.NonNull;
+import org.apache.lucene.util.BytesRef;
+import org.opensearch.common.hash.MurmurHash3;
+import org.opensearch.common.io.stream.BytesStreamOutput;
+
+import java.io.IOException;
+import java.io.UncheckedIOException;
+import java.nio.ByteBuffer;
+import java.util.Base64;
+import java.util.List;
+
+/**
+ * Compact hash of the texts a processor embeds with a model. It is stored in the document next to the embeddings, so
+ * a later ingestion of the same document can tell from the document alone whether the embeddings it carries still
+ * belong to its texts, without fetching the indexed version of the document.
+ */
+@NoArgsConstructor(access = AccessLevel.PRIVATE)
+public final class ContentHash {
+
+    /**
+     * @param modelId id of the model generating the embeddings, a different model invalidates the embeddings
+     * @param texts texts to embed in the order of the field map
+     * @return 128 bit hash of the model id and the texts, URL safe base64 encoded
+     */
+    public static String of(@NonNull final String modelId, @NonNull final List<String> texts) {
+        try (BytesStreamOutput out = new BytesStreamOutput()) {
+            out.writeString(modelId);
+            out.writeVInt(texts.size());
+            for (String text : texts) {
+                out.writeOptionalString(text);
+            }
+            BytesRef bytes = out.bytes().toBytesRef();
+            MurmurHash3.Hash128 hash = MurmurHash3.hash128(bytes.bytes, bytes.offset, bytes.length, 0, new MurmurHash3.Hash128());
+            byte[] hashBytes = ByteBuffer.allocate(2 * Long.BYTES).putLong(hash.h1).putLong(hash.h2).array();
+            return Base64.getUrlEncoder().withoutPadding().encodeToString(hashBytes);
+        } catch (IOException e) {
+            throw new UncheckedIOException(e);
+        }
+    }
+}
@@ -15,17 +15,19 @@ import org.opensearch.cluster.service.ClusterService;
 import org.opensearch.common.Nullable;
 import org.opensearch.core.action.ActionListener;
 import org.opensearch.env.Environment;
-import org.opensearch.index.analysis.AnalysisRegistry;
 import org.opensearch.ingest.AbstractBatchingSystemProcessor;
 import org.opensearch.ingest.IngestDocument;
 import org.opensearch.ingest.IngestDocumentWrapper;
 import org.opensearch.ml.common.MLModel;
 import org.opensearch.neuralsearch.mapper.dto.SparseEncodingConfig;
 import org.opensearch.neuralsearch.mapper.dto.ChunkingConfig;
+import org.opensearch.neuralsearch.ml.InferenceMicroBatcher;
+import org.opensearch.neuralsearch.ml.IngestInferenceCache;
 import org.opensearch.neuralsearch.ml.MLCommonsClientAccessor;
 import org.opensearch.neuralsearch.processor.TextInferenceRequest;
 import org.opensearch.neuralsearch.processor.chunker.Chunker;
 import org.opensearch.neuralsearch.processor.chunker.FixedTokenLengthChunker;
+import org.opensearch.neuralsearch.processor.chunker.TokenizerAnalyzerCache;
 import org.opensearch.neuralsearch.processor.dto.SemanticFieldInfo;
 import org.opensearch.neuralsearch.stats.events.EventStatName;
 import org.opensearch.neuralsearch.stats.events.EventStatsManager;
@@ -45,6 +47,7 @@ import java.util.Map;
 import java.util.Objects;
 import java.util.Set;
 import java.util.concurrent.ConcurrentHashMap;
+import java.util.concurrent.TimeUnit;
 import java.util.concurrent.atomic.AtomicInteger;
 import java.util.function.BiConsumer;
 import java.util.function.Consumer;
@@ -89,7 +92,7 @@ public class SemanticFieldProcessor extends AbstractBatchingSystemProcessor {
     protected final MLCommonsClientAccessor mlCommonsClientAccessor;
     private final Environment environment;
     private final ClusterService clusterService;
-    private final AnalysisRegistry analysisRegistry;
+    private final TokenizerAnalyzerCache analyzerCache;
 
     private final Chunker defaultTextChunker;
 
@@ -106,7 +109,7 @@ public class SemanticFieldProcessor extends AbstractBatchingSystemProcessor {
         @NonNull final Environment environment,
         @NonNull final ClusterService clusterService,
         @NonNull final Chunker defaultTextChunker,
-        @NonNull final AnalysisRegistry analysisRegistry,
+        @NonNull final TokenizerAnalyzerCache analyzerCache,
         @NonNull final OpenSearchClient openSearchClient
     ) {
         super(tag, description, batchSize);
@@ -116,7 +119,7 @@ public class SemanticFieldProcessor extends AbstractBatchingSystemProcessor {
         this.clusterService = clusterService;
         this.defaultTextChunker = defaultTextChunker;
         this.openSearchClient = openSearchClient;
-        this.analysisRegistry = analysisRegistry;
+        this.analyzerCache = analyzerCache;
     }
 
     /**
@@ -358,12 +361,17 @@ public class SemanticFieldProcessor extends AbstractBatchingSystemProcessor {
 
     private Map<String, Set<String>> groupRawDataByModelId(@NonNull final Collection<List<SemanticFieldInfo>> semanticFieldInfoLists) {
         final Map<String, Set<String>> modelIdToRawDataMap = new HashMap<>();
+        long totalChunks = 0;
         for (final List<SemanticFieldInfo> semanticFieldInfoList : semanticFieldInfoLists) {
             for (final SemanticFieldInfo semanticFieldInfo : semanticFieldInfoList) {
                 modelIdToRawDataMap.computeIfAbsent(semanticFieldInfo.getModelId(), k -> new HashSet<>())
                     .addAll(semanticFieldInfo.getChunks());
+                totalChunks += semanticFieldInfo.getChunks().size();
             }
         }
+        final long uniqueChunks = modelIdToRawDataMap.values().stream().mapToLong(Set::size).sum();
+        EventStatsManager.add(EventStatName.INGEST_INFERENCE_TEXTS, totalChunks);
+        EventStatsManager.add(EventStatName.INGEST_INFERENCE_DEDUPLICATED_TEXTS, totalChunks - uniqueChunks);
         return modelIdToRawDataMap;
     }
 
@@ -529,7 +537,7 @@ public class SemanticFieldProcessor extends AbstractBatchingSystemProcessor {
                 .skipExistingEmbedding(isSkipExistingEmbeddingEnabled(fieldConfig, pathToSemanticField))
                 .docId(docId)
                 .build();
-            semanticFieldInfo.setChunkingConfig(new ChunkingConfig(fieldConfig), analysisRegistry);
+            semanticFieldInfo.setChunkingConfig(new ChunkingConfig(fieldConfig), analyzerCache);
 
             semanticFieldInfoList.add(semanticFieldInfo);
         }
@@ -705,7 +713,6 @@ public class SemanticFieldProcessor extends AbstractBatchingSystemProcessor {
         }, e -> handler.accept(null, e)));
     }
 
-    @SuppressWarnings("unchecked")
     private void generateEmbedding(
         @NonNull final Map<String, Set<String>> modelIdToRawDataMap,
         @NonNull final Consumer<Map<Pair<String, String>, Pair<Object, Exception>>> onComplete
@@ -718,19 +725,14 @@ public class SemanticFieldProcessor extends AbstractBatchingSystemProcessor {
             final boolean isDenseModel = isDenseModel(modelIdToModelTypeMap.get(modelId));
             final List<String> values = new ArrayList<>(entry.getValue());
 
-            final TextInferenceRequest textInferenceRequest = TextInferenceRequest.builder()
-                .inputTexts(values)
-                .modelId(modelId)
-                .embeddingContentType(PASSAGE)
-                .build();
-
-            final ActionListener<?> listener = ActionListener.wrap(embeddings -> {
-                List<?> formattedEmbeddings = (List<?>) embeddings;
-                if (isDenseModel == false) {
-                    formattedEmbeddings = TokenWeightUtil.fetchListOfTokenWeightMap((List<Map<String, ?>>) embeddings);
-                }
+            final ActionListener<List<?>> listener = ActionListener.wrap(embeddings -> {
                 for (int i = 0; i < values.size(); i++) {
-                    modelIdValueToEmbeddingMap.put(Pair.of(modelId, values.get(i)), Pair.of(formattedEmbeddings.get(i), null));
+                    // the texts of a failed slice carry the failure of the slice instead of an embedding
+                    final Object embedding = embeddings.get(i);
+                    modelIdValueToEmbeddingMap.put(
+                        Pair.of(modelId, values.get(i)),
+                        embedding instanceof Exception exception ? Pair.of(null, exception) : Pair.of(embedding, null)
+                    );
                 }
                 if (counter.decrementAndGet() == 0) {
                     onComplete.accept(modelIdValueToEmbeddingMap);
@@ -744,20 +746,85 @@ public class SemanticFieldProcessor extends AbstractBatchingSystemProcessor {
                 }
             });
 
-            // For P0 we simply pass all the raw data grouped by the model id which is how our existing embedding
-            // processors work. But we may want to make the size limit of input to the predict API configurable,
-            // and we should chunk the input accordingly in the future.
+            // The texts of a model are sent in size and token bounded slices with bounded parallelism, so a large bulk
+            // does not turn into a single predict request exceeding the timeout or the payload limit of a connector.
+            IngestInferenceCache.getInstance()
+                .execute(
+                    modelId,
+                    isDenseModel ? IngestInferenceCache.DENSE_EMBEDDING_VARIANT : IngestInferenceCache.SPARSE_EMBEDDING_VARIANT,
+                    values,
+                    (texts, textsListener) -> InferenceMicroBatcher.getInstance()
+                        .execute(
+                            texts,
+                            (slice, sliceListener) -> inferSlice(modelId, isDenseModel, slice, sliceListener),
+                            textsListener::onResponse,
+                            textsListener::onFailure
+                        ),
+                    listener::onResponse,
+                    listener::onFailure
+                );
+        }
+    }
+
+    /**
+     * Runs the inference of one slice of the texts of a model. A failed slice completes with its failure as the result
+     * of each of its texts, so only the documents using texts of that slice fail and the remaining slices are still sent.
+     */
+    private void inferSlice(
+        @NonNull final String modelId,
+        final boolean isDenseModel,
+        @NonNull final List<String> slice,
+        @NonNull final ActionListener<List<?>> sliceListener
+    ) {
+        EventStatsManager.increment(EventStatName.SEMANTIC_FIELD_INFERENCE_SLICES);
+        final long startNanos = System.nanoTime();
+        final ActionListener<List<?>> timedListener = new ActionListener<>() {
+            @Override
+            public void onResponse(List<?> embeddings) {
+                recordSliceTime(startNanos);
+                sliceListener.onResponse(embeddings);
+            }
+
+            @Override
+            public void onFailure(Exception e) {
+                recordSliceTime(startNanos);
+                EventStatsManager.increment(EventStatName.SEMANTIC_FIELD_INFERENCE_SLICE_FAILURES);
+                log.debug("Failed to generate embeddings of [{}] texts with model [{}]", slice.size(), modelId, e);
+                sliceListener.onResponse(Collections.nCopies(slice.size(), e));
+            }
+        };
+        final TextInferenceRequest textInferenceRequest = TextInferenceRequest.builder()
+            .inputTexts(slice)
+            .modelId(modelId)
+            .embeddingContentType(PASSAGE)
+            .build();
+        try {
             if (isDenseModel) {
-                mlCommonsClientAccessor.inferenceSentences(textInferenceRequest, (ActionListener<List<List<Number>>>) listener);
+                mlCommonsClientAccessor.inferenceSentences(
+                    textInferenceRequest,
+                    ActionListener.wrap(timedListener::onResponse, timedListener::onFailure)
+                );
             } else {
                 mlCommonsClientAccessor.inferenceSentencesWithMapResult(
                     textInferenceRequest,
-                    (ActionListener<List<Map<String, ?>>>) listener
+                    ActionListener.wrap(
+                        resultMaps -> timedListener.onResponse(TokenWeightUtil.fetchListOfTokenWeightMap(resultMaps)),
+                        timedListener::onFailure
+                    )
                 );
             }
+        } catch (Exception e) {
+            timedListener.onFailure(e);
         }
     }
 
+    private static void recordSliceTime(final long startNanos) {
+        EventStatsManager.add(
+            EventStatName.SEMANTIC_FIELD_INFERENCE_SLICE_TIME_IN_MILLIS,
+            TimeUnit.NANOSECONDS.toMillis(System.nanoTime() - startNanos)
+        );
+    }
+
     private void batchGenerateAndSetEmbedding(
         @NonNull final List<IngestDocumentWrapper> ingestDocumentWrappers,
         @NonNull final Map<IngestDocumentWrapper, List<SemanticFieldInfo>> docToSemanticFieldInfoMap,
@@ -10,13 +10,17 @@ import lombok.extern.log4j.Log4j2;
 import org.apache.lucene.search.BulkScorer;
 import org.apache.lucene.search.DocIdSetIterator;
 import org.apache.lucene.search.LeafCollector;
+import org.apache.lucene.search.ScoreMode;
 import org.apache.lucene.search.Scorer;
+import org.apache.lucene.util.ArrayUtil;
 import org.apache.lucene.util.Bits;
 import org.apache.lucene.util.FixedBitSet;
 
 import java.io.IOException;
 import java.util.Arrays;
+import java.util.IdentityHashMap;
 import java.util.List;
+import java.util.Map;
 import java.util.Objects;
 
 /**
@@ -29,14 +33,22 @@ public class HybridBulkScorer extends BulkScorer {
     private static final int MASK = WINDOW_SIZE - 1;
 
     private final long cost;
+    // scorer per sub-query, a scorer shared by equal sub-queries is set at the index of the first of them only
     private final Scorer[] scorers;
+    // indexes of all sub-queries sharing the scorer at this index, null if the scorer is not shared
+    private final int[][] sharedScorerSubQueryIndexes;
     @Getter
     private final HybridSubQueryScorer hybridSubQueryScorer;
     private final boolean needsScores;
+    // true if sub-queries may skip documents that are not competitive for their own top hits
+    private final boolean skipNonCompetitiveScores;
+    // min competitive score last pushed to every sub-query scorer
+    private final float[] propagatedMinScores;
     @Getter
     private final FixedBitSet matching;
+    // scores of the window in doc-major order, score of sub-query i for window doc d at d * numOfSubQueries + i
     @Getter
-    private final float[][] windowScores;
+    private final float[] windowScores;
     private final HybridQueryDocIdStream hybridQueryDocIdStream;
     @Getter
     private final int maxDoc;
@@ -49,22 +61,49 @@ public class HybridBulkScorer extends BulkScorer {
      * @param maxDoc maximum document id
      */
     public HybridBulkScorer(List<Scorer> scorers, boolean needsScores, int maxDoc) {
+        this(scorers, needsScores ? ScoreMode.COMPLETE : ScoreMode.COMPLETE_NO_SCORES, maxDoc);
+    }
+
+    /**
+     * Constructor for HybridBulkScorer
+     * @param scorers list of scorers for each sub query
+     * @param scoreMode score mode of the hybrid query, in TOP_SCORES mode every sub query skips documents that cannot
+     *                  be competitive for its own top hits
+     * @param maxDoc maximum document id
+     */
+    public HybridBulkScorer(List<Scorer> scorers, ScoreMode scoreMode, int maxDoc) {
         long cost = 0;
         int numOfQueries = scorers.size();
         this.scorers = new Scorer[numOfQueries];
+        this.sharedScorerSubQueryIndexes = new int[numOfQueries][];
+        Map<Scorer, Integer> firstSubQueryIndexByScorer = new IdentityHashMap<>();
         for (int subQueryIndex = 0; subQueryIndex < numOfQueries; subQueryIndex++) {
             Scorer scorer = scorers.get(subQueryIndex);
             if (Objects.isNull(scorer)) {
                 continue;
             }
+            Integer firstSubQueryIndex = firstSubQueryIndexByScorer.putIfAbsent(scorer, subQueryIndex);
+            if (Objects.nonNull(firstSubQueryIndex)) {
+                // equal sub-queries share one scorer, it's iterated once and its scores are fanned out to all of them
+                int[] sharedIndexes = sharedScorerSubQueryIndexes[firstSubQueryIndex];
+                if (Objects.isNull(sharedIndexes)) {
+                    sharedIndexes = new int[] { firstSubQueryIndex };
+                }
+                sharedIndexes = ArrayUtil.growExact(sharedIndexes, sharedIndexes.length + 1);
+                sharedIndexes[sharedIndexes.length - 1] = subQueryIndex;
+                sharedScorerSubQueryIndexes[firstSubQueryIndex] = sharedIndexes;
+                continue;
+            }
             cost += scorer.iterator().cost();
             this.scorers[subQueryIndex] = scorer;
         }
         this.cost = cost;
         this.hybridSubQueryScorer = new HybridSubQueryScorer(numOfQueries);
-        this.needsScores = needsScores;
+        this.needsScores = scoreMode.needsScores();
+        this.skipNonCompetitiveScores = scoreMode == ScoreMode.TOP_SCORES;
+        this.propagatedMinScores = new float[numOfQueries];
         this.matching = new FixedBitSet(WINDOW_SIZE);
-        this.windowScores = new float[this.scorers.length][WINDOW_SIZE];
+        this.windowScores = new float[numOfQueries * WINDOW_SIZE];
         this.maxDoc = maxDoc;
         this.hybridQueryDocIdStream = new HybridQueryDocIdStream(this);
         this.docIds = new int[numOfQueries];
@@ -122,37 +161,107 @@ public class HybridBulkScorer extends BulkScorer {
         int windowBase
     ) throws IOException {
         for (int subQueryIndex = 0; subQueryIndex < scorers.length; subQueryIndex++) {
-            if (Objects.isNull(scorers[subQueryIndex]) || docIds[subQueryIndex] >= max) {
-                continue;
-            }
-            DocIdSetIterator it = scorers[subQueryIndex].iterator();
-            int doc = docIds[subQueryIndex];
-            if (doc < windowMin) {
-                doc = it.advance(windowMin);
-            }
-            while (doc < windowMax) {
-                if (Objects.isNull(acceptDocs) || acceptDocs.get(doc)) {
-                    int d = doc & MASK;
-                    if (needsScores) {
-                        float score = scorers[subQueryIndex].score();
-                        // collect score only in case it's gt competitive score
-                        if (score > hybridSubQueryScorer.getMinScores()[subQueryIndex]) {
-                            matching.set(d);
-                            windowScores[subQueryIndex][d] = score;
-                        }
+            scoreSubQueryWindow(subQueryIndex, acceptDocs, max, docIds, windowMin, windowMax);
+        }
+
+        hybridQueryDocIdStream.setBase(windowBase);
+        collector.collect(hybridQueryDocIdStream);
+
+        resetWindowState();
+    }
+
+    /**
+     * Scores the docs of one sub-query in the window, a scorer shared by equal sub-queries fans its scores out to all of them
+     * @param subQueryIndex index of the sub-query
+     * @param acceptDocs bitset with live docs
+     * @param max max doc id
+     * @param docIds last used doc ids per scorer
+     * @param windowMin min doc id of this collector window
+     * @param windowMax max doc id of this collector window
+     * @throws IOException
+     */
+    private void scoreSubQueryWindow(int subQueryIndex, Bits acceptDocs, int max, int[] docIds, int windowMin, int windowMax)
+        throws IOException {
+        if (Objects.isNull(scorers[subQueryIndex]) || docIds[subQueryIndex] >= max) {
+            return;
+        }
+        DocIdSetIterator it = scorers[subQueryIndex].iterator();
+        int doc = docIds[subQueryIndex];
+        if (skipNonCompetitiveScores && isNonCompetitiveWindow(subQueryIndex, Math.max(doc, windowMin), windowMax)) {
+            docIds[subQueryIndex] = it.advance(windowMax);
+            return;
+        }
+        if (doc < windowMin) {
+            doc = it.advance(windowMin);
+        }
+        while (doc < windowMax) {
+            if (Objects.isNull(acceptDocs) || acceptDocs.get(doc)) {
+                int d = doc & MASK;
+                if (needsScores) {
+                    float score = scorers[subQueryIndex].score();
+                    int[] sharedIndexes = sharedScorerSubQueryIndexes[subQueryIndex];
+                    if (Objects.isNull(sharedIndexes)) {
+                        collectScore(subQueryIndex, d, score);
                     } else {
-                        matching.set(d);
+                        for (int sharedIndex : sharedIndexes) {
+                            collectScore(sharedIndex, d, score);
+                        }
                     }
+                } else {
+                    matching.set(d);
                 }
-                doc = it.nextDoc();
             }
-            docIds[subQueryIndex] = doc;
+            doc = it.nextDoc();
         }
+        docIds[subQueryIndex] = doc;
+    }
 
-        hybridQueryDocIdStream.setBase(windowBase);
-        collector.collect(hybridQueryDocIdStream);
+    private void collectScore(int subQueryIndex, int d, float score) {
+        // collect score only in case it's gt competitive score
+        if (score > hybridSubQueryScorer.getMinScores()[subQueryIndex]) {
+            matching.set(d);
+            windowScores[d * scorers.length + subQueryIndex] = score;
+        }
+    }
 
-        resetWindowState();
+    /**
+     * Pushes the min competitive score of the sub-query, which is raised by the collector from the top hits of that
+     * sub-query only, to its scorer, so the scorer can skip blocks of documents on its own. Then checks the max score
+     * of the window from the impacts of the sub-query. Documents with scores not greater than the min competitive score
+     * are never collected, so a window where no document of the sub-query can exceed it is skipped without scoring.
+     * @param subQueryIndex index of the sub-query
+     * @param target first doc id of the window not yet consumed by the sub-query
+     * @param windowMax max doc id of the window, exclusive
+     * @return true if no document of the sub-query in the window can be competitive
+     */
+    private boolean isNonCompetitiveWindow(int subQueryIndex, int target, int windowMax) throws IOException {
+        float minScore = getMinScore(subQueryIndex);
+        if (minScore <= 0.0f || target >= windowMax) {
+            return false;
+        }
+        Scorer scorer = scorers[subQueryIndex];
+        if (minScore > propagatedMinScores[subQueryIndex]) {
+            scorer.setMinCompetitiveScore(minScore);
+            propagatedMinScores[subQueryIndex] = minScore;
+        }
+        scorer.advanceShallow(target);
+        return scorer.getMaxScore(windowMax - 1) <= minScore;
+    }
+
+    /**
+     * @return min competitive score of the sub-query, the lowest one of all sub-queries sharing its scorer
+     */
+    private float getMinScore(int subQueryIndex) {
+        float[] minScores = hybridSubQueryScorer.getMinScores();
+        int[] sharedIndexes = sharedScorerSubQueryIndexes[subQueryIndex];
+        if (Objects.isNull(sharedIndexes)) {
+            return minScores[subQueryIndex];
+        }
+        float minScore = Float.POSITIVE_INFINITY;
+        for (int sharedIndex : sharedIndexes) {
+            minScore = Math.min(minScore, minScores[sharedIndex]);
+        }
+        return minScore;
     }
 
     /**
@@ -192,13 +301,24 @@ public class HybridBulkScorer extends BulkScorer {
     }
 
     /**
-     * Reset the internal state for the next window of documents
+     * Reset the internal state for the next window of documents. Only scores of matching docs can be non-zero, so only
+     * those are cleared, which keeps the cost of the reset proportional to the number of matches instead of the window size
      */
     private void resetWindowState() {
-        matching.clear();
-
-        for (float[] windowScore : windowScores) {
-            Arrays.fill(windowScore, 0.0f);
+        long[] bits = matching.getBits();
+        int numOfSubQueries = scorers.length;
+        for (int word = 0; word < bits.length; word++) {
+            long wordBits = bits[word];
+            if (needsScores) {
+                while (wordBits != 0L) {
+                    int scoresStart = ((word << 6) | Long.numberOfTrailingZeros(wordBits)) * numOfSubQueries;
+                    for (int subQueryIndex = 0; subQueryIndex < numOfSubQueries; subQueryIndex++) {
+                        windowScores[scoresStart + subQueryIndex] = 0.0f;
+                    }
+                    wordBits &= wordBits - 1;
+                }
+            }
+            bits[word] = 0L;
         }
     }
 
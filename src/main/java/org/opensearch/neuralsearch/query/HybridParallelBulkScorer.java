@@ -0,0 +1,179 @@
+/*
+ * Copyright OpenSearch Contributors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+package org.opensearch.neuralsearch.query;
+
+import lombok.RequiredArgsConstructor;
+import org.apache.lucene.index.LeafReaderContext;
+import org.apache.lucene.search.BulkScorer;
+import org.apache.lucene.search.DocIdSetIterator;
+import org.apache.lucene.search.LeafCollector;
+import org.apache.lucene.search.ScoreMode;
+import org.apache.lucene.search.Scorer;
+import org.apache.lucene.search.TaskExecutor;
+import org.apache.lucene.search.Weight;
+import org.apache.lucene.util.ArrayUtil;
+import org.apache.lucene.util.Bits;
+
+import java.io.IOException;
+import java.util.ArrayList;
+import java.util.IdentityHashMap;
+import java.util.List;
+import java.util.Map;
+import java.util.Objects;
+import java.util.concurrent.Callable;
+
+/**
+ * Bulk scorer for hybrid query that scores every sub-query over the doc id range of the segment in its own task. Each task
+ * creates the scorer of its sub-query on the thread that runs the task, so the scorer and its postings are used by one
+ * thread only, and buffers the matching docs and scores of the sub-query. The buffered sub-queries are then merged into the
+ * per sub-query top hits of the collector window by window by {@link HybridBulkScorer} on the search thread, so the
+ * collector sees the same docs and scores, in the same order, as with serial scoring.
+ */
+@RequiredArgsConstructor
+public class HybridParallelBulkScorer extends BulkScorer {
+    // weight per sub-query, equal sub-queries share the weight and are scored by one task
+    private final List<Weight> weights;
+    private final LeafReaderContext context;
+    private final ScoreMode scoreMode;
+    private final long cost;
+    private final TaskExecutor taskExecutor;
+
+    @Override
+    public int score(LeafCollector collector, Bits acceptDocs, int min, int max) throws IOException {
+        int maxDoc = context.reader().maxDoc();
+        int rangeMax = Math.min(max, maxDoc);
+        List<Callable<Scorer>> tasks = new ArrayList<>();
+        Map<Weight, Integer> taskIndexByWeight = new IdentityHashMap<>();
+        int[] taskIndexes = new int[weights.size()];
+        for (int subQueryIndex = 0; subQueryIndex < weights.size(); subQueryIndex++) {
+            Weight weight = weights.get(subQueryIndex);
+            Integer taskIndex = taskIndexByWeight.get(weight);
+            if (Objects.isNull(taskIndex)) {
+                taskIndex = tasks.size();
+                taskIndexByWeight.put(weight, taskIndex);
+                tasks.add(() -> scoreSubQuery(weight, acceptDocs, min, rangeMax));
+            }
+            taskIndexes[subQueryIndex] = taskIndex;
+        }
+        List<Scorer> bufferedScorers = taskExecutor.invokeAll(tasks);
+        // equal sub-queries get the same buffered scorer, which is iterated once and its scores are fanned out to all of them
+        List<Scorer> scorers = new ArrayList<>(weights.size());
+        for (int taskIndex : taskIndexes) {
+            scorers.add(bufferedScorers.get(taskIndex));
+        }
+        return new HybridBulkScorer(scorers, scoreMode, maxDoc).score(collector, acceptDocs, min, rangeMax);
+    }
+
+    /**
+     * Scores one sub-query over the doc id range, runs in the task of the sub-query
+     * @param weight weight of the sub-query
+     * @param acceptDocs bitset with live docs
+     * @param min min doc id of the range, inclusive
+     * @param max max doc id of the range, exclusive
+     * @return scorer over the buffered matching docs and scores of the sub-query, null if the sub-query has no scorer
+     */
+    private Scorer scoreSubQuery(Weight weight, Bits acceptDocs, int min, int max) throws IOException {
+        Scorer scorer = weight.scorer(context);
+        if (Objects.isNull(scorer)) {
+            return null;
+        }
+        boolean needsScores = scoreMode.needsScores();
+        DocIdSetIterator it = scorer.iterator();
+        int capacity = (int) Math.max(0, Math.min(it.cost(), max - min));
+        int[] docs = new int[capacity];
+        float[] scores = needsScores ? new float[capacity] : null;
+        int size = 0;
+        int doc = it.advance(min);
+        while (doc < max) {
+            if (Objects.isNull(acceptDocs) || acceptDocs.get(doc)) {
+                if (size == docs.length) {
+                    docs = ArrayUtil.grow(docs, size + 1);
+                    if (needsScores) {
+                        scores = ArrayUtil.growExact(scores, docs.length);
+                    }
+                }
+                docs[size] = doc;
+                if (needsScores) {
+                    scores[size] = scorer.score();
+                }
+                size++;
+            }
+            doc = it.nextDoc();
+        }
+        return new BufferedSubQueryScorer(docs, scores, size, doc);
+    }
+
+    @Override
+    public long cost() {
+        return cost;
+    }
+
+    /**
+     * Scorer over the matching docs and scores of a sub-query buffered by its task. Its iterator ends with the first doc
+     * the sub-query matches after the scored range, so the bulk scorer returns the right next doc for the range
+     */
+    @RequiredArgsConstructor
+    private static final class BufferedSubQueryScorer extends Scorer {
+        private final int[] docs;
+        private final float[] scores;
+        private final int size;
+        private final int nextDocAfterRange;
+        private int index = -1;
+
+        @Override
+        public int docID() {
+            if (index < 0) {
+                return -1;
+            }
+            if (index < size) {
+                return docs[index];
+            }
+            return index == size ? nextDocAfterRange : DocIdSetIterator.NO_MORE_DOCS;
+        }
+
+        @Override
+        public float score() {
+            return Objects.isNull(scores) ? 0.0f : scores[index];
+        }
+
+        @Override
+        public float getMaxScore(int upTo) {
+            // buffered scores are collected as is, windows of the buffered sub-query are never skipped
+            return Float.POSITIVE_INFINITY;
+        }
+
+        @Override
+        public DocIdSetIterator iterator() {
+            return new DocIdSetIterator() {
+                @Override
+                public int docID() {
+                    return BufferedSubQueryScorer.this.docID();
+                }
+
+                @Override
+                public int nextDoc() {
+                    if (docID() != DocIdSetIterator.NO_MORE_DOCS) {
+                        index++;
+                    }
+                    return docID();
+                }
+
+                @Override
+                public int advance(int target) {
+                    int doc = docID();
+                    while (doc < target) {
+                        doc = nextDoc();
+                    }
+                    return doc;
+                }
+
+                @Override
+                public long cost() {
+                    return size;
+                }
+            };
+        }
+    }
+}
@@ -9,6 +9,7 @@ import java.util.AbstractMap;
 import java.util.ArrayList;
 import java.util.Collection;
 import java.util.Collections;
+import java.util.HashMap;
 import java.util.Iterator;
 import java.util.List;
 import java.util.Map;
@@ -164,7 +165,14 @@ public final class HybridQuery extends Query implements Iterable<Query> {
         final HybridQueryRewriteCollectorManager manager = new HybridQueryRewriteCollectorManager(indexSearcher);
         final List<Callable<Void>> queryRewriteTasks = new ArrayList<>();
         final List<HybridQueryExecutorCollector<IndexSearcher, Map.Entry<Query, Boolean>>> collectors = new ArrayList<>();
-        for (Query subQuery : subQueries) {
+        final int[] firstEqualSubQueryIndexes = getFirstEqualSubQueryIndexes();
+        for (int subQueryIndex = 0; subQueryIndex < subQueries.size(); subQueryIndex++) {
+            if (firstEqualSubQueryIndexes[subQueryIndex] != subQueryIndex) {
+                // equal sub-query is rewritten once, its result is shared by every slot of that sub-query
+                collectors.add(collectors.get(firstEqualSubQueryIndexes[subQueryIndex]));
+                continue;
+            }
+            final Query subQuery = subQueries.get(subQueryIndex);
             final HybridQueryExecutorCollector<IndexSearcher, Map.Entry<Query, Boolean>> collector = manager.newCollector();
             collectors.add(collector);
             queryRewriteTasks.add(() -> rewriteQuery(subQuery, collector));
@@ -235,6 +243,23 @@ public final class HybridQuery extends Query implements Iterable<Query> {
         return h;
     }
 
+    /**
+     * Finds equal sub-queries, e.g. the same clause added twice by a query template. Equal sub-queries are rewritten,
+     * weighted and scored once, and their scores are fanned out to every slot of that sub-query, so every slot still
+     * gets its own scores for normalization and combination.
+     * @return for every sub-query the index of the first sub-query equal to it, the index of the sub-query itself if there
+     * is no equal sub-query before it
+     */
+    int[] getFirstEqualSubQueryIndexes() {
+        int[] firstEqualSubQueryIndexes = new int[subQueries.size()];
+        Map<Query, Integer> firstIndexBySubQuery = new HashMap<>();
+        for (int subQueryIndex = 0; subQueryIndex < subQueries.size(); subQueryIndex++) {
+            Integer firstIndex = firstIndexBySubQuery.putIfAbsent(subQueries.get(subQueryIndex), subQueryIndex);
+            firstEqualSubQueryIndexes[subQueryIndex] = Objects.isNull(firstIndex) ? subQueryIndex : firstIndex;
+        }
+        return firstEqualSubQueryIndexes;
+    }
+
     public Collection<Query> getSubQueries() {
         return Collections.unmodifiableCollection(subQueries);
     }
@@ -11,7 +11,6 @@ import org.apache.lucene.search.DocIdStream;
 import org.apache.lucene.util.FixedBitSet;
 
 import java.io.IOException;
-import java.util.Objects;
 
 /**
  * This class is used to create a DocIdStream for HybridQuery
@@ -57,14 +56,11 @@ public class HybridQueryDocIdStream extends DocIdStream {
                 final int docIndexInWindow = (idx << BLOCK_SHIFT) | numberOfTrailingZeros;
                 final int docId = base | docIndexInWindow;
 
-                float[][] windowScores = hybridBulkScorer.getWindowScores();
-                for (int subQueryIndex = 0; subQueryIndex < windowScores.length; subQueryIndex++) {
-                    if (Objects.isNull(windowScores[subQueryIndex])) {
-                        continue;
-                    }
-                    float scoreOfDocIdForSubQuery = windowScores[subQueryIndex][docIndexInWindow];
-                    hybridBulkScorer.getHybridSubQueryScorer().getSubQueryScores()[subQueryIndex] = scoreOfDocIdForSubQuery;
-                }
+                // scores of one doc are adjacent in the doc-major window scores
+                float[] subQueryScores = hybridBulkScorer.getHybridSubQueryScorer().getSubQueryScores();
+                int numOfSubQueries = subQueryScores.length;
+                float[] windowScores = hybridBulkScorer.getWindowScores();
+                System.arraycopy(windowScores, docIndexInWindow * numOfSubQueries, subQueryScores, 0, numOfSubQueries);
                 docIds[index++] = docId;
                 hybridBulkScorer.getHybridSubQueryScorer().resetScores();
 
@@ -88,14 +84,11 @@ public class HybridQueryDocIdStream extends DocIdStream {
                 final int docIndexInWindow = (idx << BLOCK_SHIFT) | numberOfTrailingZeros;
                 final int docId = base | docIndexInWindow;
 
-                float[][] windowScores = hybridBulkScorer.getWindowScores();
-                for (int subQueryIndex = 0; subQueryIndex < windowScores.length; subQueryIndex++) {
-                    if (Objects.isNull(windowScores[subQueryIndex])) {
-                        continue;
-                    }
-                    float scoreOfDocIdForSubQuery = windowScores[subQueryIndex][docIndexInWindow];
-                    hybridBulkScorer.getHybridSubQueryScorer().getSubQueryScores()[subQueryIndex] = scoreOfDocIdForSubQuery;
-                }
+                // scores of one doc are adjacent in the doc-major window scores
+                float[] subQueryScores = hybridBulkScorer.getHybridSubQueryScorer().getSubQueryScores();
+                int numOfSubQueries = subQueryScores.length;
+                float[] windowScores = hybridBulkScorer.getWindowScores();
+                System.arraycopy(windowScores, docIndexInWindow * numOfSubQueries, subQueryScores, 0, numOfSubQueries);
                 consumer.accept(docId);
                 hybridBulkScorer.getHybridSubQueryScorer().resetScores();
 
@@ -21,7 +21,9 @@ import java.io.IOException;
 import java.util.ArrayList;
 import java.util.Collection;
 import java.util.Collections;
+import java.util.IdentityHashMap;
 import java.util.List;
+import java.util.Map;
 import java.util.Objects;
 
 /**
@@ -42,6 +44,8 @@ public class HybridQueryScorer extends Scorer {
     private final HybridScoreBlockBoundaryPropagator disjunctionBlockPropagator;
     private final TwoPhase twoPhase;
     private final int numSubqueries;
+    // number of sub-queries sharing the scorer of the sub-query at this index, equal sub-queries share one scorer
+    private final int[] numOfSubQueriesPerScorer;
 
     public HybridQueryScorer(final List<Scorer> subScorers) throws IOException {
         this(subScorers, ScoreMode.TOP_SCORES);
@@ -51,6 +55,7 @@ public class HybridQueryScorer extends Scorer {
         super();
         this.subScorers = Collections.unmodifiableList(subScorers);
         this.numSubqueries = subScorers.size();
+        this.numOfSubQueriesPerScorer = new int[numSubqueries];
         List<HybridDisiWrapper> hybridDisiWrappers = initializeSubScorersList();
         if (hybridDisiWrappers.isEmpty()) {
             throw new IllegalArgumentException("There must be at least 1 subScorers");
@@ -114,7 +119,12 @@ public class HybridQueryScorer extends Scorer {
             if (disiWrapper.scorer.docID() == DocIdSetIterator.NO_MORE_DOCS) {
                 continue;
             }
-            totalScore += disiWrapper.scorer.score();
+            if (disiWrapper instanceof HybridDisiWrapper hybridDisiWrapper) {
+                // shared scorer counts once for every equal sub-query
+                totalScore += disiWrapper.scorer.score() * numOfSubQueriesPerScorer[hybridDisiWrapper.getSubQueryIndex()];
+            } else {
+                totalScore += disiWrapper.scorer.score();
+            }
         }
         return totalScore;
     }
@@ -189,13 +199,20 @@ public class HybridQueryScorer extends Scorer {
 
     private List<HybridDisiWrapper> initializeSubScorersList() {
         Objects.requireNonNull(subScorers, "should not be null");
-        // we need to count this way in order to include all identical sub-queries
+        // equal sub-queries share one scorer, it's iterated by one wrapper and its scores are read for every sub-query
         List<HybridDisiWrapper> hybridDisiWrappers = new ArrayList<>();
+        Map<Scorer, Integer> firstSubQueryIndexByScorer = new IdentityHashMap<>();
         for (int idx = 0; idx < numSubqueries; idx++) {
             Scorer scorer = subScorers.get(idx);
             if (scorer == null) {
                 continue;
             }
+            Integer firstSubQueryIndex = firstSubQueryIndexByScorer.putIfAbsent(scorer, idx);
+            if (Objects.nonNull(firstSubQueryIndex)) {
+                numOfSubQueriesPerScorer[firstSubQueryIndex]++;
+                continue;
+            }
+            numOfSubQueriesPerScorer[idx] = 1;
             final HybridDisiWrapper disiWrapper = new HybridDisiWrapper(scorer, idx);
             hybridDisiWrappers.add(disiWrapper);
 
@@ -6,7 +6,9 @@ package org.opensearch.neuralsearch.query;
 
 import java.io.IOException;
 import java.util.ArrayList;
+import java.util.IdentityHashMap;
 import java.util.List;
+import java.util.Map;
 import java.util.Objects;
 import java.util.concurrent.Callable;
 import java.util.stream.Collectors;
@@ -18,6 +20,7 @@ import org.apache.lucene.search.Explanation;
 import org.apache.lucene.search.IndexSearcher;
 import org.apache.lucene.search.Matches;
 import org.apache.lucene.search.MatchesUtils;
+import org.apache.lucene.search.Query;
 import org.apache.lucene.search.ScoreMode;
 import org.apache.lucene.search.ScorerSupplier;
 import org.apache.lucene.search.Weight;
@@ -32,23 +35,27 @@ import static org.opensearch.neuralsearch.query.HybridQueryBuilder.MAX_NUMBER_OF
  */
 public final class HybridQueryWeight extends Weight {
 
-    // The Weights for our subqueries, in 1-1 correspondence
+    // The Weights for our subqueries, in 1-1 correspondence, equal subqueries share the same weight instance
     @Getter(AccessLevel.PACKAGE)
     private final List<Weight> weights;
     private final ScoreMode scoreMode;
 
     /**
-     * Construct the Weight for this Query searched by searcher. Recursively construct subquery weights.
+     * Construct the Weight for this Query searched by searcher. Recursively construct subquery weights, the weight of
+     * equal subqueries is created once and shared, so their scorers are shared as well.
      */
     public HybridQueryWeight(HybridQuery hybridQuery, IndexSearcher searcher, ScoreMode scoreMode, float boost) throws IOException {
         super(hybridQuery);
-        weights = hybridQuery.getSubQueries().stream().map(q -> {
-            try {
-                return searcher.createWeight(searcher.rewrite(q), scoreMode, boost);
-            } catch (IOException e) {
-                throw new RuntimeException(e);
+        List<Query> subQueries = new ArrayList<>(hybridQuery.getSubQueries());
+        int[] firstEqualSubQueryIndexes = hybridQuery.getFirstEqualSubQueryIndexes();
+        weights = new ArrayList<>(subQueries.size());
+        for (int subQueryIndex = 0; subQueryIndex < subQueries.size(); subQueryIndex++) {
+            if (firstEqualSubQueryIndexes[subQueryIndex] != subQueryIndex) {
+                weights.add(weights.get(firstEqualSubQueryIndexes[subQueryIndex]));
+            } else {
+                weights.add(searcher.createWeight(searcher.rewrite(subQueries.get(subQueryIndex)), scoreMode, boost));
             }
-        }).collect(Collectors.toList());
+        }
         this.scoreMode = scoreMode;
     }
 
@@ -82,9 +89,17 @@ public final class HybridQueryWeight extends Weight {
         HybridQueryScoreSupplierCollectorManager manager = new HybridQueryScoreSupplierCollectorManager(context);
         List<Callable<Void>> scoreSupplierTasks = new ArrayList<>();
         List<HybridQueryExecutorCollector<LeafReaderContext, ScorerSupplier>> collectors = new ArrayList<>();
+        Map<Weight, HybridQueryExecutorCollector<LeafReaderContext, ScorerSupplier>> collectorsByWeight = new IdentityHashMap<>();
         for (Weight weight : weights) {
+            HybridQueryExecutorCollector<LeafReaderContext, ScorerSupplier> sharedCollector = collectorsByWeight.get(weight);
+            if (Objects.nonNull(sharedCollector)) {
+                // shared weight of equal subqueries, one scorer supplier is used for all of them
+                collectors.add(sharedCollector);
+                continue;
+            }
             HybridQueryExecutorCollector<LeafReaderContext, ScorerSupplier> collector = manager.newCollector();
             collectors.add(collector);
+            collectorsByWeight.put(weight, collector);
             scoreSupplierTasks.add(() -> addScoreSupplier(weight, collector));
         }
         HybridQueryExecutor.getExecutor().invokeAll(scoreSupplierTasks);
@@ -12,14 +12,20 @@ import org.apache.lucene.search.ScoreMode;
 import org.apache.lucene.search.Scorer;
 import org.apache.lucene.search.ScorerSupplier;
 import org.apache.lucene.search.Weight;
+import org.opensearch.neuralsearch.executors.HybridQueryExecutor;
 
 import java.io.IOException;
 import java.util.ArrayList;
+import java.util.Collections;
+import java.util.IdentityHashMap;
 import java.util.List;
+import java.util.Map;
 import java.util.Objects;
+import java.util.Set;
 
 /**
- * This class is responsible for creating a HybridScorer based on the provided list of ScorerSupplier objects.
+ * This class is responsible for creating a HybridScorer based on the provided list of ScorerSupplier objects. Equal
+ * sub-queries share the same scorer supplier instance, which yields one scorer shared by all of their slots.
  */
 @RequiredArgsConstructor
 public class HybridScorerSupplier extends ScorerSupplier {
@@ -34,11 +40,17 @@ public class HybridScorerSupplier extends ScorerSupplier {
     @Override
     public Scorer get(long leadCost) throws IOException {
         List<Scorer> tScorers = new ArrayList<>();
+        Map<ScorerSupplier, Scorer> scorersBySupplier = new IdentityHashMap<>();
         for (ScorerSupplier ss : scorerSuppliers) {
-            if (Objects.nonNull(ss)) {
-                tScorers.add(ss.get(leadCost));
-            } else {
+            if (Objects.isNull(ss)) {
                 tScorers.add(null);
+            } else if (scorersBySupplier.containsKey(ss)) {
+                // a scorer supplier can be used only once, its scorer is shared by all slots of equal sub-queries
+                tScorers.add(scorersBySupplier.get(ss));
+            } else {
+                Scorer scorer = ss.get(leadCost);
+                scorersBySupplier.put(ss, scorer);
+                tScorers.add(scorer);
             }
         }
         return new HybridQueryScorer(tScorers, scoreMode);
@@ -48,10 +60,8 @@ public class HybridScorerSupplier extends ScorerSupplier {
     public long cost() {
         if (cost == -1) {
             long cost = 0;
-            for (ScorerSupplier ss : scorerSuppliers) {
-                if (Objects.nonNull(ss)) {
-                    cost += ss.cost();
-                }
+            for (ScorerSupplier ss : distinctScorerSuppliers()) {
+                cost += ss.cost();
             }
             this.cost = cost;
         }
@@ -60,22 +70,44 @@ public class HybridScorerSupplier extends ScorerSupplier {
 
     @Override
     public void setTopLevelScoringClause() throws IOException {
-        for (ScorerSupplier ss : scorerSuppliers) {
+        for (ScorerSupplier ss : distinctScorerSuppliers()) {
             // sub scorers need to be able to skip too as calls to setMinCompetitiveScore get
             // propagated
-            if (Objects.nonNull(ss)) {
-                ss.setTopLevelScoringClause();
-            }
+            ss.setTopLevelScoringClause();
         }
     }
 
     @Override
     public BulkScorer bulkScorer() throws IOException {
+        if (HybridQueryExecutor.isParallelSubQueryScoringEnabled() && distinctWeights().size() > 1) {
+            // every sub-query creates its scorer in its own task, so no scorer is created here
+            return new HybridParallelBulkScorer(weight.getWeights(), context, scoreMode, cost(), HybridQueryExecutor.getExecutor());
+        }
         List<Scorer> scorers = new ArrayList<>();
+        Map<Weight, Scorer> scorersByWeight = new IdentityHashMap<>();
         for (Weight weight : weight.getWeights()) {
-            Scorer scorer = weight.scorer(context);
-            scorers.add(scorer);
+            // equal sub-queries share the weight, their scorer is created once and shared by all of their slots
+            if (scorersByWeight.containsKey(weight) == false) {
+                scorersByWeight.put(weight, weight.scorer(context));
+            }
+            scorers.add(scorersByWeight.get(weight));
+        }
+        return new HybridBulkScorer(scorers, scoreMode, context.reader().maxDoc());
+    }
+
+    private Set<Weight> distinctWeights() {
+        Set<Weight> distinctWeights = Collections.newSetFromMap(new IdentityHashMap<>());
+        distinctWeights.addAll(weight.getWeights());
+        return distinctWeights;
+    }
+
+    private Set<ScorerSupplier> distinctScorerSuppliers() {
+        Set<ScorerSupplier> distinctScorerSuppliers = Collections.newSetFromMap(new IdentityHashMap<>());
+        for (ScorerSupplier ss : scorerSuppliers) {
+            if (Objects.nonNull(ss)) {
+                distinctScorerSuppliers.add(ss);
+            }
         }
-        return new HybridBulkScorer(scorers, scoreMode.needsScores(), context.reader().maxDoc());
+        return distinctScorerSuppliers;
     }
 }
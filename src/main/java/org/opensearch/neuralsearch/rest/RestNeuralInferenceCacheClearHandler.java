@@ -0,0 +1,59 @@
+/*
+ * Copyright OpenSearch Contributors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+package org.opensearch.neuralsearch.rest;
+
+import com.google.common.collect.ImmutableList;
+import org.opensearch.core.common.Strings;
+import org.opensearch.neuralsearch.plugin.NeuralSearch;
+import org.opensearch.neuralsearch.transport.NeuralInferenceCacheClearAction;
+import org.opensearch.neuralsearch.transport.NeuralInferenceCacheClearRequest;
+import org.opensearch.rest.BaseRestHandler;
+import org.opensearch.rest.RestRequest;
+import org.opensearch.rest.action.RestToXContentListener;
+import org.opensearch.transport.client.node.NodeClient;
+
+import java.util.List;
+import java.util.Locale;
+
+/**
+ * RestHandler for inference result cache clear API.
+ * API drops the cached query and ingest embeddings on each node, e.g. after a model was redeployed under the same model id.
+ */
+public class RestNeuralInferenceCacheClearHandler extends BaseRestHandler {
+    private static final String URL_PATH = "/inference_cache/_clear";
+    private static final String NODE_URL_PATH = "/{nodeId}/inference_cache/_clear";
+    public static String NAME = "neural_inference_cache_clear_action";
+
+    /**
+     * @return name of inference cache clear API action
+     */
+    @Override
+    public String getName() {
+        return NAME;
+    }
+
+    /**
+     * @return Immutable List of inference cache clear API endpoints
+     */
+    @Override
+    public List<Route> routes() {
+        return ImmutableList.of(
+            new Route(RestRequest.Method.POST, String.format(Locale.ROOT, "%s%s", NeuralSearch.NEURAL_BASE_URI, URL_PATH)),
+            new Route(RestRequest.Method.POST, String.format(Locale.ROOT, "%s%s", NeuralSearch.NEURAL_BASE_URI, NODE_URL_PATH))
+        );
+    }
+
+    /**
+     * @param request RestRequest of inference cache clear
+     * @param client NodeClient to execute actions according to request
+     * @return RestChannelConsumer
+     */
+    @Override
+    protected RestChannelConsumer prepareRequest(RestRequest request, NodeClient client) {
+        String[] nodeIds = Strings.splitStringByCommaToArray(request.param("nodeId"));
+        NeuralInferenceCacheClearRequest clearRequest = new NeuralInferenceCacheClearRequest(nodeIds);
+        return channel -> client.execute(NeuralInferenceCacheClearAction.INSTANCE, clearRequest, new RestToXContentListener<>(channel));
+    }
+}
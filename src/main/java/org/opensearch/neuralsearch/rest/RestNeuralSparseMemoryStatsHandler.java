@@ -0,0 +1,59 @@
+/*
+ * Copyright OpenSearch Contributors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+package org.opensearch.neuralsearch.rest;
+
+import com.google.common.collect.ImmutableList;
+import org.opensearch.core.common.Strings;
+import org.opensearch.neuralsearch.plugin.NeuralSearch;
+import org.opensearch.neuralsearch.transport.NeuralSparseMemoryStatsAction;
+import org.opensearch.neuralsearch.transport.NeuralSparseMemoryStatsRequest;
+import org.opensearch.rest.BaseRestHandler;
+import org.opensearch.rest.RestRequest;
+import org.opensearch.rest.action.RestToXContentListener;
+import org.opensearch.transport.client.node.NodeClient;
+
+import java.util.List;
+import java.util.Locale;
+
+/**
+ * RestHandler for SEISMIC memory stats API.
+ * API reports the cache memory every sparse index occupies on each node together with its budgets.
+ */
+public class RestNeuralSparseMemoryStatsHandler extends BaseRestHandler {
+    private static final String URL_PATH = "/sparse/memory_stats";
+    private static final String NODE_URL_PATH = "/{nodeId}/sparse/memory_stats";
+    public static String NAME = "neural_sparse_memory_stats_action";
+
+    /**
+     * @return name of memory stats API action
+     */
+    @Override
+    public String getName() {
+        return NAME;
+    }
+
+    /**
+     * @return Immutable List of memory stats API endpoints
+     */
+    @Override
+    public List<Route> routes() {
+        return ImmutableList.of(
+            new Route(RestRequest.Method.GET, String.format(Locale.ROOT, "%s%s", NeuralSearch.NEURAL_BASE_URI, URL_PATH)),
+            new Route(RestRequest.Method.GET, String.format(Locale.ROOT, "%s%s", NeuralSearch.NEURAL_BASE_URI, NODE_URL_PATH))
+        );
+    }
+
+    /**
+     * @param request RestRequest of memory stats
+     * @param client NodeClient to execute actions according to request
+     * @return RestChannelConsumer
+     */
+    @Override
+    protected RestChannelConsumer prepareRequest(RestRequest request, NodeClient client) {
+        String[] nodeIds = Strings.splitStringByCommaToArray(request.param("nodeId"));
+        NeuralSparseMemoryStatsRequest memoryStatsRequest = new NeuralSparseMemoryStatsRequest(nodeIds);
+        return channel -> client.execute(NeuralSparseMemoryStatsAction.INSTANCE, memoryStatsRequest, new RestToXContentListener<>(channel));
+    }
+}
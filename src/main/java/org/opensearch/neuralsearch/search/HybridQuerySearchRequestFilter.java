@@ -6,15 +6,20 @@ package org.opensearch.neuralsearch.search;
 
 import org.opensearch.core.action.ActionListener;
 
+import java.util.List;
 import java.util.Locale;
 import java.util.Objects;
+import java.util.function.BooleanSupplier;
+import java.util.function.Function;
 
 import org.opensearch.action.search.SearchAction;
 import org.opensearch.action.search.SearchRequest;
 import org.opensearch.action.support.ActionFilter;
 import org.opensearch.action.support.ActionFilterChain;
+import org.opensearch.cluster.metadata.IndexMetadata;
 import org.opensearch.core.action.ActionResponse;
 import org.opensearch.index.query.QueryBuilder;
+import org.opensearch.indices.IndicesRequestCache;
 import org.opensearch.neuralsearch.query.HybridQueryBuilder;
 import org.opensearch.tasks.Task;
 
@@ -39,6 +44,15 @@ import lombok.extern.log4j.Log4j2;
  *
  * This filter works transparently without any pipeline or query configuration.
  *
+ * When the request cache is enabled for hybrid queries, the filter also sets request_cache to true for hybrid queries
+ * that don't set it explicitly. The shard request cache skips requests with a non-zero size by default, which is the
+ * case for almost every hybrid query. Query phase results of hybrid queries, with the scores of every sub-query, are
+ * then cached per shard, keyed on the whole shard request: the hybrid query with its pagination_depth, the sort and the
+ * query vectors generated by neural sub-queries are all part of the key. Repeated identical hybrid searches skip
+ * the query phase on the shards and only run normalization and combination on the coordinator.
+ * An explicit request_cache=true overrides index.requests.cache.enable=false, so the flag is only set if every target index
+ * has the request cache enabled. Indices whose owners disabled the request cache are never cached by this filter.
+ *
  */
 @Log4j2
 public class HybridQuerySearchRequestFilter implements ActionFilter {
@@ -50,6 +64,25 @@ public class HybridQuerySearchRequestFilter implements ActionFilter {
      */
     private static final int DISABLE_BATCHED_REDUCE = Integer.MAX_VALUE;
 
+    private final BooleanSupplier requestCacheEnabled;
+    private final Function<SearchRequest, List<IndexMetadata>> indexMetadataResolver;
+
+    public HybridQuerySearchRequestFilter() {
+        this(() -> false, searchRequest -> List.of());
+    }
+
+    /**
+     * @param requestCacheEnabled tells if the shard request cache is enabled for hybrid queries, read on every request
+     * @param indexMetadataResolver resolves the metadata of the concrete indices a search request targets
+     */
+    public HybridQuerySearchRequestFilter(
+        final BooleanSupplier requestCacheEnabled,
+        final Function<SearchRequest, List<IndexMetadata>> indexMetadataResolver
+    ) {
+        this.requestCacheEnabled = requestCacheEnabled;
+        this.indexMetadataResolver = indexMetadataResolver;
+    }
+
     /**
      * Order of this filter in the filter chain.
      * Lower values execute first. We use 0 to ensure this runs early.
@@ -88,11 +121,57 @@ public class HybridQuerySearchRequestFilter implements ActionFilter {
                     );
                     searchRequest.setBatchedReduceSize(DISABLE_BATCHED_REDUCE);
                 }
+                enableRequestCache(searchRequest);
             }
         }
         chain.proceed(task, action, request, listener);
     }
 
+    /**
+     * Enable the shard request cache for the hybrid query unless request_cache is set explicitly. Scroll requests can't
+     * use the request cache and profiled requests must run the query phase, both are left as is. The request cache is only
+     * enabled if all target indices have index.requests.cache.enable set.
+     *
+     * @param searchRequest search request with a hybrid query
+     */
+    private void enableRequestCache(SearchRequest searchRequest) {
+        if (Objects.nonNull(searchRequest.requestCache())
+            || Objects.nonNull(searchRequest.scroll())
+            || searchRequest.source().profile()
+            || requestCacheEnabled.getAsBoolean() == false
+            || isRequestCacheEnabledOnAllIndices(searchRequest) == false) {
+            return;
+        }
+        searchRequest.requestCache(true);
+    }
+
+    /**
+     * Check if the request cache is enabled on every concrete index the search request targets. Requests whose indices
+     * can't be resolved, e.g. missing or remote indices, are treated as not cacheable and left to the search action.
+     *
+     * @param searchRequest search request with a hybrid query
+     * @return true if there is at least one target index and all of them have the request cache enabled
+     */
+    private boolean isRequestCacheEnabledOnAllIndices(SearchRequest searchRequest) {
+        final List<IndexMetadata> indexMetadataList;
+        try {
+            indexMetadataList = indexMetadataResolver.apply(searchRequest);
+        } catch (Exception e) {
+            log.debug("Failed to resolve target indices of hybrid query, request cache is not enabled", e);
+            return false;
+        }
+        if (Objects.isNull(indexMetadataList) || indexMetadataList.isEmpty()) {
+            return false;
+        }
+        for (IndexMetadata indexMetadata : indexMetadataList) {
+            if (Objects.isNull(indexMetadata)
+                || IndicesRequestCache.INDEX_CACHE_REQUEST_ENABLED_SETTING.get(indexMetadata.getSettings()) == false) {
+                return false;
+            }
+        }
+        return true;
+    }
+
     /**
      * Check if the search request contains a hybrid query.
      *
@@ -5,9 +5,11 @@
 package org.opensearch.neuralsearch.settings;
 
 import org.opensearch.common.settings.Setting;
+import org.opensearch.common.unit.TimeValue;
 
 import lombok.AccessLevel;
 import lombok.NoArgsConstructor;
+import org.opensearch.core.common.unit.ByteSizeUnit;
 import org.opensearch.core.common.unit.ByteSizeValue;
 
 /**
@@ -115,4 +117,185 @@ public final class NeuralSearchSettings {
         Setting.Property.NodeScope,
         Setting.Property.Dynamic
     );
+
+    /**
+     * Interval at which the working set of the sparse caches is persisted to a manifest in each shard data directory.
+     * The manifest is used to warm up exactly that working set when the shard starts again. Zero disables the feature.
+     */
+    public static final Setting<TimeValue> SPARSE_WARM_CACHE_MANIFEST_INTERVAL = Setting.timeSetting(
+        "plugins.neural_search.sparse.warm_cache_manifest_interval",
+        TimeValue.timeValueMinutes(10),
+        TimeValue.ZERO,
+        Setting.Property.NodeScope,
+        Setting.Property.Dynamic
+    );
+
+    /**
+     * Maximum memory of the node level SEISMIC query result cache, which holds the top-k results of repeated
+     * sparse_ann queries per segment. The memory is also accounted against the neural circuit breaker. Zero disables the cache.
+     */
+    public static final Setting<ByteSizeValue> SPARSE_QUERY_RESULT_CACHE_SIZE = Setting.byteSizeSetting(
+        "plugins.neural_search.sparse.query_result_cache_size",
+        new ByteSizeValue(10, ByteSizeUnit.MB),
+        new ByteSizeValue(0),
+        new ByteSizeValue(Integer.MAX_VALUE),
+        Setting.Property.NodeScope,
+        Setting.Property.Dynamic
+    );
+
+    /**
+     * Maximum number of query embeddings kept in the node level inference result cache. Zero disables the cache.
+     */
+    public static final Setting<Integer> INFERENCE_RESULT_CACHE_MAX_ENTRIES = Setting.intSetting(
+        "plugins.neural_search.inference_result_cache.max_entries",
+        1000,
+        0,
+        Setting.Property.NodeScope,
+        Setting.Property.Dynamic
+    );
+
+    /**
+     * Time to live of an entry of the inference result cache. It bounds how long a redeployed model with the same
+     * model id may still be served stale query embeddings. Zero disables the cache.
+     */
+    public static final Setting<TimeValue> INFERENCE_RESULT_CACHE_TTL = Setting.timeSetting(
+        "plugins.neural_search.inference_result_cache.ttl",
+        TimeValue.timeValueMinutes(5),
+        TimeValue.ZERO,
+        Setting.Property.NodeScope,
+        Setting.Property.Dynamic
+    );
+
+    /**
+     * Enables sharing one model inference between concurrent identical query inferences on a node.
+     */
+    public static final Setting<Boolean> INFERENCE_COALESCING_ENABLED = Setting.boolSetting(
+        "plugins.neural_search.inference_coalescing.enabled",
+        true,
+        Setting.Property.NodeScope,
+        Setting.Property.Dynamic
+    );
+
+    /**
+     * Maximum number of ML inference retries that may wait for their backoff at the same time on a node.
+     * Retryable failures beyond the budget fail immediately. Zero disables retries.
+     */
+    public static final Setting<Integer> ML_INFERENCE_RETRY_BUDGET = Setting.intSetting(
+        "plugins.neural_search.ml_inference.retry_budget",
+        100,
+        0,
+        Setting.Property.NodeScope,
+        Setting.Property.Dynamic
+    );
+
+    /**
+     * Approximate token budget of one ingest inference request, counting every text as long as the longest text of
+     * the request since models pad them to the same length. Larger sub-batches are split into micro-batches that are
+     * sent concurrently. Zero, the default, disables the budget, so sub-batches are sent as one request.
+     */
+    public static final Setting<Integer> INGEST_INFERENCE_MAX_TOKENS_PER_REQUEST = Setting.intSetting(
+        "plugins.neural_search.ingest_inference.max_tokens_per_request",
+        0,
+        0,
+        Setting.Property.NodeScope,
+        Setting.Property.Dynamic
+    );
+
+    /**
+     * Maximum number of texts of one ingest inference request. Zero means no limit.
+     */
+    public static final Setting<Integer> INGEST_INFERENCE_MAX_TEXTS_PER_REQUEST = Setting.intSetting(
+        "plugins.neural_search.ingest_inference.max_texts_per_request",
+        0,
+        0,
+        Setting.Property.NodeScope,
+        Setting.Property.Dynamic
+    );
+
+    /**
+     * Maximum number of in-flight ML inference calls per model on a node. Further calls wait in the model's queue.
+     * Zero disables the limit.
+     */
+    public static final Setting<Integer> INFERENCE_DISPATCHER_MAX_IN_FLIGHT = Setting.intSetting(
+        "plugins.neural_search.inference_dispatcher.max_in_flight",
+        32,
+        0,
+        Setting.Property.NodeScope,
+        Setting.Property.Dynamic
+    );
+
+    /**
+     * Maximum number of ML inference calls per model waiting for a free slot. Calls beyond it are rejected.
+     */
+    public static final Setting<Integer> INFERENCE_DISPATCHER_MAX_QUEUE_SIZE = Setting.intSetting(
+        "plugins.neural_search.inference_dispatcher.max_queue_size",
+        1000,
+        0,
+        Setting.Property.NodeScope,
+        Setting.Property.Dynamic
+    );
+
+    /**
+     * Adapts the in-flight limit of a model to throttling of its calls, up to the maximum: the limit is halved when the
+     * model answers with too many requests and grows back by one per round of successful calls. Disabled by default.
+     */
+    public static final Setting<Boolean> INFERENCE_DISPATCHER_ADAPTIVE_CONCURRENCY = Setting.boolSetting(
+        "plugins.neural_search.inference_dispatcher.adaptive_concurrency",
+        false,
+        Setting.Property.NodeScope,
+        Setting.Property.Dynamic
+    );
+
+    /**
+     * Maximum number of micro-batches of one ingest inference in flight at a time, the next one is sent when one
+     * completes. Bounds the concurrent requests sent for a very long document. Zero means no limit.
+     */
+    public static final Setting<Integer> INGEST_INFERENCE_MAX_CONCURRENT_MICRO_BATCHES = Setting.intSetting(
+        "plugins.neural_search.ingest_inference.max_concurrent_micro_batches",
+        4,
+        0,
+        Setting.Property.NodeScope,
+        Setting.Property.Dynamic
+    );
+
+    /**
+     * Maximum memory of the node level ingest inference cache, which holds the embeddings of texts recently inferred by
+     * ingest processors, so texts ingested again, e.g. by re-indexing, are not sent to the model. The memory is also
+     * accounted against the neural circuit breaker. Zero disables the cache.
+     */
+    public static final Setting<ByteSizeValue> INGEST_INFERENCE_CACHE_SIZE = Setting.byteSizeSetting(
+        "plugins.neural_search.ingest_inference.cache_size",
+        new ByteSizeValue(0),
+        new ByteSizeValue(0),
+        new ByteSizeValue(Integer.MAX_VALUE),
+        Setting.Property.NodeScope,
+        Setting.Property.Dynamic
+    );
+
+    /**
+     * Enables the shard request cache for hybrid queries that don't set request_cache explicitly. Results of the query phase
+     * of hybrid queries are cached per shard, keyed on the whole shard request, which includes the hybrid query with its
+     * pagination_depth, the sort and the query vectors generated by neural sub-queries. Hybrid queries usually have a
+     * non-zero size, which the request cache skips by default. Only applies to indices with index.requests.cache.enable set,
+     * indices with the request cache disabled are never cached. Disabled by default.
+     */
+    public static final Setting<Boolean> HYBRID_QUERY_REQUEST_CACHE_ENABLED = Setting.boolSetting(
+        "plugins.neural_search.hybrid_search.request_cache_enabled",
+        false,
+        Setting.Property.NodeScope,
+        Setting.Property.Dynamic
+    );
+
+    /**
+     * Enables scoring every sub-query of a hybrid query over a segment in its own task of the hybrid query executor. Cuts
+     * the latency of hybrid queries with several expensive sub-queries, e.g. knn and lexical ones, at the cost of threads
+     * of the hybrid query executor and of buffering the matching docs and scores of every sub-query of the segment, so it
+     * suits workloads with low query rates. Disabled by default.
+     */
+    public static final Setting<Boolean> HYBRID_PARALLEL_SUB_QUERY_SCORING_ENABLED = Setting.boolSetting(
+        "plugins.neural_search.hybrid_search.parallel_sub_query_scoring_enabled",
+        false,
+        Setting.Property.NodeScope,
+        Setting.Property.Dynamic
+    );
 }
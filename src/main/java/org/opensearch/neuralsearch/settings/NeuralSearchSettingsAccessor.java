@@ -8,10 +8,19 @@ import lombok.Getter;
 import org.opensearch.cluster.service.ClusterService;
 import org.opensearch.common.settings.Settings;
 import org.opensearch.common.util.concurrent.OpenSearchExecutors;
+import org.opensearch.neuralsearch.executors.HybridQueryExecutor;
+import org.opensearch.neuralsearch.ml.InferenceDispatcher;
+import org.opensearch.neuralsearch.ml.InferenceMicroBatcher;
+import org.opensearch.neuralsearch.ml.IngestInferenceCache;
+import org.opensearch.neuralsearch.ml.InferenceRequestCoalescer;
+import org.opensearch.neuralsearch.ml.InferenceResultCache;
+import org.opensearch.neuralsearch.sparse.WarmCacheManifestManager;
 import org.opensearch.neuralsearch.sparse.algorithm.ClusterTrainingExecutor;
 import org.opensearch.neuralsearch.sparse.cache.CircuitBreakerManager;
 import org.opensearch.neuralsearch.sparse.cache.MemoryUsageManager;
+import org.opensearch.neuralsearch.sparse.cache.SparseQueryResultCache;
 import org.opensearch.neuralsearch.stats.events.EventStatsManager;
+import org.opensearch.neuralsearch.util.RetryUtil;
 
 import static org.opensearch.neuralsearch.settings.NeuralSearchSettings.NEURAL_CIRCUIT_BREAKER_LIMIT;
 import static org.opensearch.neuralsearch.settings.NeuralSearchSettings.NEURAL_CIRCUIT_BREAKER_OVERHEAD;
@@ -26,6 +35,9 @@ public class NeuralSearchSettingsAccessor {
     @Getter
     private volatile boolean isAgenticSearchEnabled;
 
+    @Getter
+    private volatile boolean isHybridQueryRequestCacheEnabled;
+
     /**
      * Constructor, registers callbacks to update settings
      * @param clusterService
@@ -33,6 +45,7 @@ public class NeuralSearchSettingsAccessor {
      */
     public NeuralSearchSettingsAccessor(ClusterService clusterService, Settings settings) {
         isStatsEnabled = NeuralSearchSettings.NEURAL_STATS_ENABLED.get(settings);
+        isHybridQueryRequestCacheEnabled = NeuralSearchSettings.HYBRID_QUERY_REQUEST_CACHE_ENABLED.get(settings);
         registerSettingsCallbacks(clusterService, settings);
     }
 
@@ -54,5 +67,77 @@ public class NeuralSearchSettingsAccessor {
                 int maxThreadQty = OpenSearchExecutors.allocatedProcessors(settings);
                 ClusterTrainingExecutor.updateThreadPoolSize(maxThreadQty, setting);
             });
+        clusterService.getClusterSettings()
+            .addSettingsUpdateConsumer(
+                NeuralSearchSettings.SPARSE_WARM_CACHE_MANIFEST_INTERVAL,
+                interval -> WarmCacheManifestManager.getInstance().setPersistInterval(interval)
+            );
+        clusterService.getClusterSettings()
+            .addSettingsUpdateConsumer(
+                NeuralSearchSettings.SPARSE_QUERY_RESULT_CACHE_SIZE,
+                size -> SparseQueryResultCache.getInstance().setCapacity(size)
+            );
+        clusterService.getClusterSettings()
+            .addSettingsUpdateConsumer(
+                NeuralSearchSettings.INFERENCE_RESULT_CACHE_MAX_ENTRIES,
+                maxEntries -> InferenceResultCache.getInstance().setMaxEntries(maxEntries)
+            );
+        clusterService.getClusterSettings()
+            .addSettingsUpdateConsumer(
+                NeuralSearchSettings.INFERENCE_RESULT_CACHE_TTL,
+                ttl -> InferenceResultCache.getInstance().setTtl(ttl)
+            );
+        clusterService.getClusterSettings()
+            .addSettingsUpdateConsumer(
+                NeuralSearchSettings.INFERENCE_COALESCING_ENABLED,
+                enabled -> InferenceRequestCoalescer.getInstance().setEnabled(enabled)
+            );
+        clusterService.getClusterSettings()
+            .addSettingsUpdateConsumer(NeuralSearchSettings.ML_INFERENCE_RETRY_BUDGET, RetryUtil::setRetryBudget);
+        clusterService.getClusterSettings()
+            .addSettingsUpdateConsumer(
+                NeuralSearchSettings.INGEST_INFERENCE_MAX_TOKENS_PER_REQUEST,
+                maxTokens -> InferenceMicroBatcher.getInstance().setMaxTokensPerRequest(maxTokens)
+            );
+        clusterService.getClusterSettings()
+            .addSettingsUpdateConsumer(
+                NeuralSearchSettings.INGEST_INFERENCE_MAX_TEXTS_PER_REQUEST,
+                maxTexts -> InferenceMicroBatcher.getInstance().setMaxTextsPerRequest(maxTexts)
+            );
+        clusterService.getClusterSettings()
+            .addSettingsUpdateConsumer(
+                NeuralSearchSettings.INFERENCE_DISPATCHER_MAX_IN_FLIGHT,
+                maxInFlight -> InferenceDispatcher.getInstance().setMaxInFlight(maxInFlight)
+            );
+        clusterService.getClusterSettings()
+            .addSettingsUpdateConsumer(
+                NeuralSearchSettings.INFERENCE_DISPATCHER_MAX_QUEUE_SIZE,
+                maxQueueSize -> InferenceDispatcher.getInstance().setMaxQueueSize(maxQueueSize)
+            );
+        clusterService.getClusterSettings()
+            .addSettingsUpdateConsumer(
+                NeuralSearchSettings.INFERENCE_DISPATCHER_ADAPTIVE_CONCURRENCY,
+                adaptive -> InferenceDispatcher.getInstance().setAdaptive(adaptive)
+            );
+        clusterService.getClusterSettings()
+            .addSettingsUpdateConsumer(
+                NeuralSearchSettings.INGEST_INFERENCE_MAX_CONCURRENT_MICRO_BATCHES,
+                maxConcurrent -> InferenceMicroBatcher.getInstance().setMaxConcurrentMicroBatches(maxConcurrent)
+            );
+        clusterService.getClusterSettings()
+            .addSettingsUpdateConsumer(
+                NeuralSearchSettings.INGEST_INFERENCE_CACHE_SIZE,
+                size -> IngestInferenceCache.getInstance().setCapacity(size)
+            );
+        clusterService.getClusterSettings()
+            .addSettingsUpdateConsumer(
+                NeuralSearchSettings.HYBRID_QUERY_REQUEST_CACHE_ENABLED,
+                value -> isHybridQueryRequestCacheEnabled = value
+            );
+        clusterService.getClusterSettings()
+            .addSettingsUpdateConsumer(
+                NeuralSearchSettings.HYBRID_PARALLEL_SUB_QUERY_SCORING_ENABLED,
+                HybridQueryExecutor::setParallelSubQueryScoringEnabled
+            );
     }
 }
@@ -30,6 +30,7 @@ import org.opensearch.index.shard.IllegalIndexShardStateException;
 import org.opensearch.index.shard.IndexShard;
 import org.opensearch.neuralsearch.sparse.accessor.SparseVectorReader;
 import org.opensearch.neuralsearch.sparse.cache.ClusteredPostingCache;
+import org.opensearch.neuralsearch.sparse.cache.ClusteredPostingCacheItem;
 import org.opensearch.neuralsearch.sparse.cache.ForwardIndexCache;
 import org.opensearch.neuralsearch.sparse.cache.ForwardIndexCacheItem;
 import org.opensearch.neuralsearch.sparse.codec.CodecUtilWrapper;
@@ -37,14 +38,19 @@ import org.opensearch.neuralsearch.sparse.common.PredicateUtils;
 import org.opensearch.neuralsearch.sparse.cache.CacheKey;
 import org.opensearch.neuralsearch.sparse.cache.CacheGatedForwardIndexReader;
 import org.opensearch.neuralsearch.sparse.cache.CacheGatedPostingsReader;
+import org.opensearch.neuralsearch.sparse.cache.WarmCacheManifest;
 import org.opensearch.neuralsearch.sparse.codec.SparseTermsLuceneReader;
 import org.opensearch.neuralsearch.sparse.codec.SparseBinaryDocValuesPassThrough;
 import org.apache.lucene.index.SegmentReadState;
 import org.opensearch.neuralsearch.sparse.mapper.SparseVectorField;
 
+import java.nio.file.Path;
 import java.util.ArrayList;
+import java.util.HashMap;
 import java.util.List;
+import java.util.Map;
 import java.util.Set;
+import java.util.function.BiPredicate;
 
 import java.io.IOException;
 import java.util.stream.Collectors;
@@ -64,6 +70,7 @@ public class NeuralSparseIndexShard {
 
     private static final String WARM_UP_SEARCHER_SOURCE = "warm-up-searcher-source";
     private static final String CLEAR_CACHE_SEARCHER_SOURCE = "clear-cache-searcher-source";
+    private static final String WARM_CACHE_MANIFEST_SEARCHER_SOURCE = "warm-cache-manifest-searcher-source";
 
     /**
      * Return the name of the shards index
@@ -119,6 +126,93 @@ public class NeuralSparseIndexShard {
         }
     }
 
+    /**
+     * Build a manifest describing the neural-sparse data of this shard that is currently resident in cache.
+     * Cache items are only looked up, never created, so building a manifest does not allocate cache memory.
+     */
+    public WarmCacheManifest buildWarmCacheManifest() throws IOException {
+        List<WarmCacheManifest.Entry> entries = new ArrayList<>();
+        try (Engine.Searcher searcher = indexShard.acquireSearcher(WARM_CACHE_MANIFEST_SEARCHER_SOURCE)) {
+            for (final LeafReaderContext leafReaderContext : searcher.getIndexReader().leaves()) {
+                final LeafReader leafReader = leafReaderContext.reader();
+                final SegmentInfo segmentInfo = Lucene.segmentReader(leafReader).getSegmentInfo().info;
+                for (FieldInfo fieldInfo : collectSparseFieldInfos(leafReader)) {
+                    final CacheKey key = new CacheKey(segmentInfo, fieldInfo);
+                    final ClusteredPostingCacheItem postingCacheItem = ClusteredPostingCache.getInstance().get(key);
+                    final ForwardIndexCacheItem forwardIndexCacheItem = ForwardIndexCache.getInstance().get(key);
+                    final List<BytesRef> terms = postingCacheItem == null
+                        ? List.of()
+                        : new ArrayList<>(postingCacheItem.getReader().getTerms());
+                    final int[] docIdRanges = forwardIndexCacheItem == null ? new int[0] : forwardIndexCacheItem.getCachedDocIdRanges();
+                    if (terms.isEmpty() && docIdRanges.length == 0) {
+                        continue;
+                    }
+                    entries.add(new WarmCacheManifest.Entry(segmentInfo, fieldInfo.name, terms, docIdRanges));
+                }
+            }
+        }
+        return new WarmCacheManifest(entries);
+    }
+
+    /**
+     * Persist the manifest of currently cached neural-sparse data to the shard data directory.
+     * An empty manifest never overwrites a previous one, so a cold cache does not erase the last known working set.
+     */
+    public void persistWarmCacheManifest() throws IOException {
+        WarmCacheManifest manifest = buildWarmCacheManifest();
+        if (manifest.isEmpty()) {
+            return;
+        }
+        manifest.writeTo(getWarmCacheManifestPath());
+    }
+
+    /**
+     * Load exactly the working set described by the persisted manifest into the cache.
+     * Segments that no longer exist are skipped. Warm up stops early once the circuit breaker reaches its limit.
+     */
+    public void warmUpFromManifest() throws IOException {
+        WarmCacheManifest manifest = WarmCacheManifest.readFrom(getWarmCacheManifestPath());
+        if (manifest == null || manifest.isEmpty()) {
+            return;
+        }
+        Map<String, WarmCacheManifest.Entry> entries = new HashMap<>();
+        for (WarmCacheManifest.Entry entry : manifest.getEntries()) {
+            entries.put(entry.getKey(), entry);
+        }
+
+        try (Engine.Searcher searcher = indexShard.acquireSearcher(WARM_UP_SEARCHER_SOURCE)) {
+            List<CacheOperationContext> cacheOperationContexts = collectCacheOperationContexts(
+                searcher,
+                (segmentInfo, fieldInfo) -> entries.containsKey(WarmCacheManifest.entryKey(segmentInfo, fieldInfo.name))
+            );
+            for (CacheOperationContext context : cacheOperationContexts) {
+                CacheKey cacheKey = context.cacheKey;
+                WarmCacheManifest.Entry entry = entries.get(WarmCacheManifest.entryKey(cacheKey.getSegmentInfo(), cacheKey.getField()));
+                warmUpDocIdRanges(context.forwardIndexReader, entry.getDocIdRanges());
+                for (BytesRef term : entry.getTerms()) {
+                    context.postingsReader.read(term);
+                }
+            }
+        } catch (CircuitBreakingException e) {
+            log.warn("[Neural Sparse] Circuit Breaker reaches limit, stop warming up shard {} from manifest", indexShard.shardId());
+        }
+    }
+
+    private Path getWarmCacheManifestPath() {
+        return indexShard.shardPath().getDataPath().resolve(WarmCacheManifest.FILE_NAME);
+    }
+
+    private void warmUpDocIdRanges(SparseVectorReader forwardIndexReader, int[] docIdRanges) throws IOException {
+        if (forwardIndexReader == null) {
+            return;
+        }
+        for (int i = 0; i + 1 < docIdRanges.length; i += 2) {
+            for (int docId = docIdRanges[i]; docId < docIdRanges[i + 1]; docId++) {
+                forwardIndexReader.read(docId);
+            }
+        }
+    }
+
     /**
      * Warm up all forward indices
      */
@@ -221,6 +315,14 @@ public class NeuralSparseIndexShard {
      * Collect contexts needed during cache operation
      */
     private List<CacheOperationContext> collectCacheOperationContexts(Engine.Searcher searcher) throws IOException {
+        return collectCacheOperationContexts(searcher, (segmentInfo, fieldInfo) -> true);
+    }
+
+    /**
+     * Collect contexts needed during cache operation for the segments and fields accepted by the filter
+     */
+    private List<CacheOperationContext> collectCacheOperationContexts(Engine.Searcher searcher, BiPredicate<SegmentInfo, FieldInfo> filter)
+        throws IOException {
         List<CacheOperationContext> contexts = new ArrayList<>();
 
         for (final LeafReaderContext leafReaderContext : searcher.getIndexReader().leaves()) {
@@ -230,7 +332,7 @@ public class NeuralSparseIndexShard {
             final SegmentInfo segmentInfo = segmentReader.getSegmentInfo().info;
 
             for (FieldInfo fieldInfo : sparseFieldInfos) {
-                if (!PredicateUtils.shouldRunSeisPredicate.test(segmentInfo, fieldInfo)) {
+                if (!PredicateUtils.shouldRunSeisPredicate.test(segmentInfo, fieldInfo) || !filter.test(segmentInfo, fieldInfo)) {
                     continue;
                 }
                 final CacheKey key = new CacheKey(segmentInfo, fieldInfo);
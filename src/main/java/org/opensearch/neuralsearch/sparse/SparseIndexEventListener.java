@@ -9,7 +9,11 @@ import lombok.extern.log4j.Log4j2;
 import org.apache.lucene.index.SegmentInfo;
 import org.apache.lucene.index.SegmentInfos;
 import org.opensearch.common.concurrent.GatedCloseable;
+import org.opensearch.common.settings.Settings;
+import org.opensearch.core.index.Index;
+import org.opensearch.core.index.shard.ShardId;
 import org.opensearch.index.IndexService;
+import org.opensearch.index.IndexSettings;
 import org.opensearch.index.mapper.MappedFieldType;
 import org.opensearch.index.mapper.MapperService;
 import org.opensearch.index.shard.IndexEventListener;
@@ -18,11 +22,14 @@ import org.opensearch.indices.cluster.IndicesClusterStateService;
 import org.opensearch.neuralsearch.sparse.cache.ClusteredPostingCache;
 import org.opensearch.neuralsearch.sparse.cache.CacheKey;
 import org.opensearch.neuralsearch.sparse.cache.ForwardIndexCache;
+import org.opensearch.neuralsearch.sparse.cache.SparseMemoryBudgetManager;
 import org.opensearch.neuralsearch.sparse.mapper.SparseVectorFieldType;
 
 /**
  * Event listener for sparse index operations that handles cache cleanup during index removal.
  * Clears forward index and clustered posting caches for sparse token fields when indices are removed.
+ * It also notifies the WarmCacheManifestManager when shards start or close, and registers indices and
+ * their shard directories with the SparseMemoryBudgetManager.
  */
 @AllArgsConstructor
 @Log4j2
@@ -56,4 +63,37 @@ public class SparseIndexEventListener implements IndexEventListener {
             }
         }
     }
+
+    @Override
+    public void afterIndexCreated(IndexService indexService) {
+        Settings indexSettings = indexService.getIndexSettings().getSettings();
+        SparseMemoryBudgetManager.getInstance().registerIndex(indexService.index().getName(), indexSettings);
+    }
+
+    @Override
+    public void afterIndexRemoved(
+        Index index,
+        IndexSettings indexSettings,
+        IndicesClusterStateService.AllocatedIndices.IndexRemovalReason reason
+    ) {
+        SparseMemoryBudgetManager.getInstance().removeIndex(index.getName());
+    }
+
+    @Override
+    public void afterIndexShardCreated(IndexShard indexShard) {
+        SparseMemoryBudgetManager.getInstance().registerShard(indexShard.shardId().getIndexName(), indexShard.store().directory());
+    }
+
+    @Override
+    public void afterIndexShardStarted(IndexShard indexShard) {
+        WarmCacheManifestManager.getInstance().onShardStarted(indexShard);
+    }
+
+    @Override
+    public void beforeIndexShardClosed(ShardId shardId, IndexShard indexShard, Settings indexSettings) {
+        WarmCacheManifestManager.getInstance().onShardClosed(shardId);
+        if (indexShard != null) {
+            SparseMemoryBudgetManager.getInstance().unregisterShard(indexShard.store().directory());
+        }
+    }
 }
@@ -5,7 +5,13 @@
 package org.opensearch.neuralsearch.sparse;
 
 import org.opensearch.common.settings.Setting;
+import org.opensearch.common.settings.Settings;
+import org.opensearch.core.common.unit.ByteSizeValue;
 
+import java.util.HashMap;
+import java.util.Map;
+
+import static org.opensearch.common.settings.Setting.Property.Dynamic;
 import static org.opensearch.common.settings.Setting.Property.Final;
 import static org.opensearch.common.settings.Setting.Property.IndexScope;
 import static org.opensearch.common.settings.Setting.Property.UnmodifiableOnRestore;
@@ -15,6 +21,8 @@ import static org.opensearch.common.settings.Setting.Property.UnmodifiableOnRest
  */
 public class SparseSettings {
     public static final String SPARSE_INDEX = "index.sparse";
+    public static final String SPARSE_MEMORY_BUDGET = "index.sparse.memory_budget";
+    public static final String SPARSE_FIELD_MEMORY_BUDGET_PREFIX = "index.sparse.field_memory_budget.";
 
     private static SparseSettings INSTANCE;
 
@@ -35,4 +43,41 @@ public class SparseSettings {
         Final,
         UnmodifiableOnRestore
     );
+
+    /**
+     * Upper bound of the SEISMIC cache memory the index may occupy on a node. -1 means the index is only
+     * bounded by the global neural circuit breaker limit.
+     */
+    public static final Setting<ByteSizeValue> SPARSE_MEMORY_BUDGET_SETTING = Setting.byteSizeSetting(
+        SPARSE_MEMORY_BUDGET,
+        new ByteSizeValue(-1),
+        IndexScope,
+        Dynamic
+    );
+
+    /**
+     * Per-field upper bounds of the SEISMIC cache memory, e.g. index.sparse.field_memory_budget.passage_embedding: 100mb.
+     * A field budget is enforced in addition to the index budget.
+     */
+    public static final Setting<Settings> SPARSE_FIELD_MEMORY_BUDGET_SETTING = Setting.groupSetting(
+        SPARSE_FIELD_MEMORY_BUDGET_PREFIX,
+        SparseSettings::parseFieldMemoryBudgets,
+        IndexScope,
+        Dynamic
+    );
+
+    /**
+     * Parses per-field memory budgets from the group setting.
+     *
+     * @param fieldBudgets settings of {@link #SPARSE_FIELD_MEMORY_BUDGET_SETTING}
+     * @return mapping of field name to budget in bytes
+     */
+    public static Map<String, Long> parseFieldMemoryBudgets(Settings fieldBudgets) {
+        Map<String, Long> budgets = new HashMap<>();
+        for (String field : fieldBudgets.keySet()) {
+            String setting = SPARSE_FIELD_MEMORY_BUDGET_PREFIX + field;
+            budgets.put(field, ByteSizeValue.parseBytesSizeValue(fieldBudgets.get(field), setting).getBytes());
+        }
+        return budgets;
+    }
 }
@@ -0,0 +1,146 @@
+/*
+ * Copyright OpenSearch Contributors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+package org.opensearch.neuralsearch.sparse;
+
+import com.google.common.annotations.VisibleForTesting;
+import lombok.NonNull;
+import lombok.extern.log4j.Log4j2;
+import org.opensearch.common.unit.TimeValue;
+import org.opensearch.core.index.shard.ShardId;
+import org.opensearch.index.shard.IndexShard;
+import org.opensearch.threadpool.Scheduler;
+import org.opensearch.threadpool.ThreadPool;
+
+import java.util.Map;
+import java.util.Set;
+import java.util.concurrent.ConcurrentHashMap;
+
+/**
+ * Singleton class that keeps the warm cache manifests of started neural-sparse shards up to date.
+ * Manifests are persisted periodically on the generic thread pool and are used to warm up the
+ * previously hot working set in the background when a shard starts. Closing a shard does not persist its
+ * manifest, as shards are closed on the cluster applier thread and a persist scans the caches of every segment.
+ * A persist interval of zero disables both persisting and warming up from manifests. Started shards are registered
+ * even while the feature is disabled, so enabling it later persists them and warms them up.
+ */
+@Log4j2
+public class WarmCacheManifestManager {
+    private static volatile WarmCacheManifestManager INSTANCE;
+
+    private final Map<ShardId, NeuralSparseIndexShard> startedShards = new ConcurrentHashMap<>();
+    // started shards not yet warmed up, as they started while the feature was disabled
+    private final Set<ShardId> shardsToWarmUp = ConcurrentHashMap.newKeySet();
+    private ThreadPool threadPool;
+    private volatile TimeValue persistInterval = TimeValue.ZERO;
+    private Scheduler.Cancellable persistTask;
+
+    @VisibleForTesting
+    WarmCacheManifestManager() {}
+
+    public static WarmCacheManifestManager getInstance() {
+        if (INSTANCE == null) {
+            synchronized (WarmCacheManifestManager.class) {
+                if (INSTANCE == null) {
+                    INSTANCE = new WarmCacheManifestManager();
+                }
+            }
+        }
+        return INSTANCE;
+    }
+
+    /**
+     * Initializes the thread pool and schedules periodic manifest persistence.
+     *
+     * @param threadPool the OpenSearch thread pool
+     * @param persistInterval interval between two manifest persistences
+     */
+    public synchronized void initialize(@NonNull ThreadPool threadPool, @NonNull TimeValue persistInterval) {
+        this.threadPool = threadPool;
+        setPersistInterval(persistInterval);
+    }
+
+    /**
+     * Updates the persist interval and reschedules the periodic task. Enabling the feature warms up the shards
+     * that started while it was disabled.
+     *
+     * @param persistInterval interval between two manifest persistences, zero disables the feature
+     */
+    public synchronized void setPersistInterval(@NonNull TimeValue persistInterval) {
+        this.persistInterval = persistInterval;
+        if (persistTask != null) {
+            persistTask.cancel();
+            persistTask = null;
+        }
+        if (isEnabled()) {
+            persistTask = threadPool.scheduleWithFixedDelay(this::persistAll, persistInterval, ThreadPool.Names.GENERIC);
+            for (ShardId shardId : shardsToWarmUp) {
+                NeuralSparseIndexShard neuralSparseIndexShard = startedShards.get(shardId);
+                if (neuralSparseIndexShard != null) {
+                    warmUp(neuralSparseIndexShard);
+                }
+            }
+            shardsToWarmUp.clear();
+        }
+    }
+
+    /**
+     * Registers a started shard and warms up its persisted working set in the background, or once the feature
+     * is enabled if it is disabled.
+     *
+     * @param indexShard the started shard
+     */
+    public synchronized void onShardStarted(@NonNull IndexShard indexShard) {
+        NeuralSparseIndexShard neuralSparseIndexShard = new NeuralSparseIndexShard(indexShard);
+        startedShards.put(indexShard.shardId(), neuralSparseIndexShard);
+        if (isEnabled()) {
+            warmUp(neuralSparseIndexShard);
+        } else {
+            shardsToWarmUp.add(indexShard.shardId());
+        }
+    }
+
+    /**
+     * Unregisters a closing shard. Its last periodically persisted manifest is kept.
+     *
+     * @param shardId the id of the closing shard
+     */
+    public void onShardClosed(@NonNull ShardId shardId) {
+        startedShards.remove(shardId);
+        shardsToWarmUp.remove(shardId);
+    }
+
+    @VisibleForTesting
+    void persistAll() {
+        if (!isEnabled()) {
+            return;
+        }
+        for (NeuralSparseIndexShard neuralSparseIndexShard : startedShards.values()) {
+            persist(neuralSparseIndexShard);
+        }
+    }
+
+    private void warmUp(NeuralSparseIndexShard neuralSparseIndexShard) {
+        ShardId shardId = neuralSparseIndexShard.getIndexShard().shardId();
+        threadPool.generic().execute(() -> {
+            try {
+                neuralSparseIndexShard.warmUpFromManifest();
+            } catch (Exception e) {
+                log.warn("[Neural Sparse] Failed to warm up shard {} from manifest", shardId, e);
+            }
+        });
+    }
+
+    private void persist(NeuralSparseIndexShard neuralSparseIndexShard) {
+        try {
+            neuralSparseIndexShard.persistWarmCacheManifest();
+        } catch (Exception e) {
+            log.warn("[Neural Sparse] Failed to persist warm cache manifest for shard {}", neuralSparseIndexShard.getIndexShard().shardId(), e);
+        }
+    }
+
+    private boolean isEnabled() {
+        return threadPool != null && persistInterval.millis() > 0;
+    }
+}
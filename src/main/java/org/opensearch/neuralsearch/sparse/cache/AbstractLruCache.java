@@ -8,7 +8,13 @@ import com.googlecode.concurrentlinkedhashmap.ConcurrentLinkedHashMap;
 import lombok.extern.log4j.Log4j2;
 import lombok.NonNull;
 
+import java.util.ArrayList;
+import java.util.List;
+import java.util.Map;
 import java.util.Set;
+import java.util.concurrent.ConcurrentHashMap;
+import java.util.concurrent.atomic.AtomicLong;
+import java.util.function.Predicate;
 
 /**
  * Abstract LRU cache implementation for sparse vector caches using ConcurrentLinkedHashMap.
@@ -26,6 +32,13 @@ public abstract class AbstractLruCache<Key extends LruCacheKey> {
      */
     protected final ConcurrentLinkedHashMap<Key, Boolean> accessRecencyMap;
 
+    /**
+     * Access order of the keys of each cache key, with the access sequence number as value, so an eviction restricted to a scope
+     * only visits the cache keys in the scope instead of walking every key of the cache
+     */
+    protected final Map<CacheKey, ConcurrentLinkedHashMap<Key, Long>> accessRecencyMapsByCacheKey = new ConcurrentHashMap<>();
+    private final AtomicLong accessSequence = new AtomicLong();
+
     protected AbstractLruCache() {
         this.accessRecencyMap = new ConcurrentLinkedHashMap.Builder<Key, Boolean>().maximumWeightedCapacity(Long.MAX_VALUE).build();
     }
@@ -43,6 +56,10 @@ public abstract class AbstractLruCache<Key extends LruCacheKey> {
         }
 
         accessRecencyMap.put(key, true);
+        accessRecencyMapsByCacheKey.computeIfAbsent(
+            key.getCacheKey(),
+            cacheKey -> new ConcurrentLinkedHashMap.Builder<Key, Long>().maximumWeightedCapacity(Long.MAX_VALUE).build()
+        ).put(key, accessSequence.incrementAndGet());
     }
 
     /**
@@ -89,6 +106,74 @@ public abstract class AbstractLruCache<Key extends LruCacheKey> {
         log.debug("Freed {} bytes of memory", ramBytesReleased);
     }
 
+    /**
+     * Evicts items to make room for the cache item of the requester, honoring memory budgets.
+     * If the requester is over its own index or field budget, only its own entries are evicted.
+     * Otherwise entries of indices above their fair share are evicted first, then the global LRU order applies.
+     *
+     * @param requester The cache key of the item that needs memory
+     * @param ramBytesToRelease Number of bytes to evict
+     */
+    public void evict(@NonNull CacheKey requester, long ramBytesToRelease) {
+        SparseMemoryBudgetManager budgetManager = SparseMemoryBudgetManager.getInstance();
+        Predicate<CacheKey> overBudgetScope = budgetManager.getOverBudgetScope(requester, ramBytesToRelease);
+        if (overBudgetScope != null) {
+            evictMatching(ramBytesToRelease, overBudgetScope);
+            return;
+        }
+
+        Predicate<CacheKey> overFairShareScope = budgetManager.getOverFairShareScope();
+        long ramBytesReleased = overFairShareScope == null ? 0 : evictMatching(ramBytesToRelease, overFairShareScope);
+        evict(ramBytesToRelease - ramBytesReleased);
+    }
+
+    /**
+     * Evicts least recently used items whose cache key matches the scope until the specified amount of RAM has been freed.
+     * The scope is tested once per cache key, and each step evicts the oldest of the least recently used keys of the
+     * cache keys in the scope, so keys outside the scope are never visited.
+     *
+     * @param ramBytesToRelease Number of bytes to evict
+     * @param scope Predicate selecting the cache keys that may be evicted
+     * @return number of bytes freed
+     */
+    protected long evictMatching(long ramBytesToRelease, @NonNull Predicate<CacheKey> scope) {
+        if (ramBytesToRelease <= 0) {
+            return 0;
+        }
+
+        long ramBytesReleased = 0;
+        synchronized (accessRecencyMap) {
+            List<ConcurrentLinkedHashMap<Key, Long>> scopedAccessRecencyMaps = new ArrayList<>();
+            for (Map.Entry<CacheKey, ConcurrentLinkedHashMap<Key, Long>> entry : accessRecencyMapsByCacheKey.entrySet()) {
+                if (scope.test(entry.getKey())) {
+                    scopedAccessRecencyMaps.add(entry.getValue());
+                }
+            }
+            while (ramBytesReleased < ramBytesToRelease) {
+                Map.Entry<Key, Long> leastRecentlyUsed = null;
+                ConcurrentLinkedHashMap<Key, Long> leastRecentlyUsedOwner = null;
+                for (ConcurrentLinkedHashMap<Key, Long> scopedAccessRecencyMap : scopedAccessRecencyMaps) {
+                    for (Map.Entry<Key, Long> head : scopedAccessRecencyMap.ascendingMapWithLimit(1).entrySet()) {
+                        if (leastRecentlyUsed == null || head.getValue() < leastRecentlyUsed.getValue()) {
+                            leastRecentlyUsed = head;
+                            leastRecentlyUsedOwner = scopedAccessRecencyMap;
+                        }
+                    }
+                }
+                if (leastRecentlyUsed == null) {
+                    // No key left in scope, nothing more to evict
+                    break;
+                }
+                // removed from the visited map as well, which an index removal may have replaced meanwhile
+                leastRecentlyUsedOwner.remove(leastRecentlyUsed.getKey());
+                ramBytesReleased += evictItem(leastRecentlyUsed.getKey());
+            }
+        }
+
+        log.debug("Freed {} bytes of memory within scope", ramBytesReleased);
+        return ramBytesReleased;
+    }
+
     /**
      * Evicts a specific item from the cache.
      * Uses ConcurrentLinkedHashMap's atomic remove operation.
@@ -97,6 +182,10 @@ public abstract class AbstractLruCache<Key extends LruCacheKey> {
      * @return number of bytes freed, or 0 if the item was not evicted
      */
     protected long evictItem(Key key) {
+        ConcurrentLinkedHashMap<Key, Long> cacheKeyAccessRecencyMap = accessRecencyMapsByCacheKey.get(key.getCacheKey());
+        if (cacheKeyAccessRecencyMap != null) {
+            cacheKeyAccessRecencyMap.remove(key);
+        }
         if (accessRecencyMap.remove(key) == null) {
             return 0;
         }
@@ -106,12 +195,17 @@ public abstract class AbstractLruCache<Key extends LruCacheKey> {
 
     /**
      * Removes all entries for a specific cache key when an index is removed.
-     * Uses ConcurrentLinkedHashMap's concurrent iteration capabilities.
+     * Only the keys of the cache key are visited.
      *
      * @param cacheKey The cache key to remove
      */
     public void onIndexRemoval(@NonNull CacheKey cacheKey) {
-        accessRecencyMap.keySet().removeIf(key -> key.getCacheKey().equals(cacheKey));
+        ConcurrentLinkedHashMap<Key, Long> cacheKeyAccessRecencyMap = accessRecencyMapsByCacheKey.remove(cacheKey);
+        if (cacheKeyAccessRecencyMap != null) {
+            for (Key key : cacheKeyAccessRecencyMap.keySet()) {
+                accessRecencyMap.remove(key);
+            }
+        }
     }
 
     /**
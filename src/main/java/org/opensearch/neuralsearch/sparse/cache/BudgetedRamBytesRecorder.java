@@ -0,0 +1,82 @@
+/*
+ * Copyright OpenSearch Contributors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+package org.opensearch.neuralsearch.sparse.cache;
+
+import lombok.NonNull;
+
+import java.util.function.Consumer;
+import java.util.function.LongSupplier;
+
+/**
+ * RAM bytes recorder bounded by its own budget and chained to a parent recorder.
+ * An increment is only recorded if it fits both this budget and the parent's constraints,
+ * so a field recorder can be chained to an index recorder, which is chained to the global tracker.
+ */
+public class BudgetedRamBytesRecorder extends RamBytesRecorder {
+    private final RamBytesRecorder parent;
+    private final LongSupplier budgetSupplier;
+
+    /**
+     * @param parent recorder that also receives every recorded increment
+     * @param budgetSupplier supplies the current budget in bytes, a negative value means unlimited
+     */
+    public BudgetedRamBytesRecorder(@NonNull RamBytesRecorder parent, @NonNull LongSupplier budgetSupplier) {
+        super((bytes, targetedTotalBytes) -> {
+            long budget = budgetSupplier.getAsLong();
+            return budget < 0 || targetedTotalBytes <= budget;
+        });
+        this.parent = parent;
+        this.budgetSupplier = budgetSupplier;
+    }
+
+    @Override
+    public synchronized boolean record(long bytes) {
+        if (!super.record(bytes)) {
+            return false;
+        }
+        if (parent.record(bytes)) {
+            return true;
+        }
+        super.recordWithoutValidation(-bytes, null);
+        return false;
+    }
+
+    @Override
+    public void recordWithoutValidation(long bytes, Consumer<Long> postAction) {
+        super.recordWithoutValidation(bytes, null);
+        parent.recordWithoutValidation(bytes, postAction);
+    }
+
+    /**
+     * Releases bytes from this recorder and its budgeted ancestors without touching the unbudgeted root,
+     * for callers that update the root tracker themselves.
+     *
+     * @param bytes bytes to release
+     */
+    public void releaseFromBudgets(long bytes) {
+        super.recordWithoutValidation(-bytes, null);
+        if (parent instanceof BudgetedRamBytesRecorder budgetedParent) {
+            budgetedParent.releaseFromBudgets(bytes);
+        }
+    }
+
+    /**
+     * @return the current budget in bytes, a negative value means unlimited
+     */
+    public long getBudget() {
+        return budgetSupplier.getAsLong();
+    }
+
+    /**
+     * Checks whether recording additional bytes would exceed this recorder's own budget.
+     *
+     * @param additionalBytes bytes that are about to be recorded
+     * @return true if the budget is limited and would be exceeded
+     */
+    public boolean isOverBudget(long additionalBytes) {
+        long budget = getBudget();
+        return budget >= 0 && getBytes() + additionalBytes > budget;
+    }
+}
@@ -5,6 +5,7 @@
 package org.opensearch.neuralsearch.sparse.cache;
 
 import lombok.EqualsAndHashCode;
+import lombok.Getter;
 import lombok.NonNull;
 import org.apache.lucene.index.FieldInfo;
 import org.apache.lucene.index.SegmentInfo;
@@ -12,6 +13,7 @@ import org.apache.lucene.index.SegmentInfo;
 /**
  * Key for cache sparse vector forward index and clustered posting
  */
+@Getter
 @EqualsAndHashCode
 public class CacheKey {
 
@@ -35,7 +35,14 @@ public class ClusteredPostingCache extends MemMonitoredCache<ClusteredPostingCac
 
     @NonNull
     public ClusteredPostingCacheItem getOrCreate(@NonNull CacheKey key) {
-        RamBytesRecorder globalRecorder = MemoryUsageManager.getInstance().getMemoryUsageTracker();
-        return super.getOrCreate(key, k -> new ClusteredPostingCacheItem(k, globalRecorder));
+        return super.getOrCreate(key, k -> {
+            RamBytesRecorder recorder = SparseMemoryBudgetManager.getInstance().getRecorder(k);
+            return new ClusteredPostingCacheItem(k, recorder);
+        });
+    }
+
+    @Override
+    protected RamBytesRecorder getRecorder(ClusteredPostingCacheItem value) {
+        return value.getGlobalTracker();
     }
 }
@@ -28,6 +28,7 @@ public class ClusteredPostingCacheItem extends AccountableTracker implements Clu
 
     private final CacheKey cacheKey;
     private final Map<BytesRef, PostingClusters> clusteredPostings = new ConcurrentHashMap<>();
+    @Getter
     private final RamBytesRecorder globalTracker;
     @Getter
     private final ClusteredPostingReader reader = new CacheClusteredPostingReader();
@@ -81,7 +82,7 @@ public class ClusteredPostingCacheItem extends AccountableTracker implements Clu
 
         // Default handler: perform cache eviction when memory limit is reached
         private CacheClusteredPostingWriter() {
-            this.circuitBreakerTriggerHandler = (ramBytesUsed) -> { LruTermCache.getInstance().evict(ramBytesUsed); };
+            this.circuitBreakerTriggerHandler = (ramBytesUsed) -> { LruTermCache.getInstance().evict(cacheKey, ramBytesUsed); };
         }
 
         private CacheClusteredPostingWriter(Consumer<Long> circuitBreakerTriggerHandler) {
@@ -35,7 +35,14 @@ public class ForwardIndexCache extends MemMonitoredCache<ForwardIndexCacheItem>
 
     @NonNull
     public ForwardIndexCacheItem getOrCreate(@NonNull CacheKey key, int docCount) {
-        RamBytesRecorder globalRecorder = MemoryUsageManager.getInstance().getMemoryUsageTracker();
-        return super.getOrCreate(key, k -> new ForwardIndexCacheItem(k, docCount, globalRecorder));
+        return super.getOrCreate(key, k -> {
+            RamBytesRecorder recorder = SparseMemoryBudgetManager.getInstance().getRecorder(k);
+            return new ForwardIndexCacheItem(k, docCount, recorder);
+        });
+    }
+
+    @Override
+    protected RamBytesRecorder getRecorder(ForwardIndexCacheItem value) {
+        return value.getGlobalRamBytes();
     }
 }
@@ -5,13 +5,17 @@
 package org.opensearch.neuralsearch.sparse.cache;
 
 import lombok.Getter;
+import lombok.Value;
 import lombok.extern.log4j.Log4j2;
+import org.apache.lucene.util.ArrayUtil;
 import org.apache.lucene.util.RamUsageEstimator;
 import org.opensearch.neuralsearch.sparse.accessor.SparseVectorForwardIndex;
 import org.opensearch.neuralsearch.sparse.accessor.SparseVectorReader;
 import org.opensearch.neuralsearch.sparse.data.SparseVector;
 
 import java.io.IOException;
+import java.util.concurrent.atomic.AtomicLong;
+import java.util.concurrent.atomic.AtomicLongArray;
 import java.util.concurrent.atomic.AtomicReferenceArray;
 import java.util.function.Consumer;
 
@@ -23,6 +27,12 @@ public class ForwardIndexCacheItem extends AccountableTracker implements SparseV
 
     private final CacheKey cacheKey;
     private final AtomicReferenceArray<SparseVector> sparseVectors;
+    // one bit per doc whose sparse vector is resident, set and cleared together with the vector
+    private final AtomicLongArray cachedDocBits;
+    // incremented on every change of the resident docs, the cached doc id ranges are collected again only after a change
+    private final AtomicLong cachedDocModifications = new AtomicLong();
+    private volatile CachedDocIdRanges lastCachedDocIdRanges;
+    @Getter
     private final RamBytesRecorder globalRamBytes;
     @Getter
     private final SparseVectorReader reader = new CacheSparseVectorReader();
@@ -42,15 +52,71 @@ public class ForwardIndexCacheItem extends AccountableTracker implements SparseV
         this.cacheKey = cacheKey;
         this.globalRamBytes = globalRamBytes;
         sparseVectors = new AtomicReferenceArray<>(docCount);
-        // Account for the array itself in memory usage
+        cachedDocBits = new AtomicLongArray((docCount + Long.SIZE - 1) / Long.SIZE);
+        // Account for the arrays themselves in memory usage
         recordUsedBytes(
             RamUsageEstimator.shallowSizeOf(sparseVectors) + RamUsageEstimator.alignObjectSize(
                 (long) docCount * RamUsageEstimator.NUM_BYTES_OBJECT_REF
+            ) + RamUsageEstimator.shallowSizeOf(cachedDocBits) + RamUsageEstimator.alignObjectSize(
+                (long) cachedDocBits.length() * Long.BYTES
             )
         );
         globalRamBytes.recordWithoutValidation(ramBytesUsed(), CircuitBreakerManager::addWithoutBreaking);
     }
 
+    /**
+     * Collects the doc ids whose sparse vectors are currently resident in this cache item. The resident docs are
+     * tracked in a bitset as vectors are inserted and erased, and the ranges are only collected again after a change.
+     *
+     * @return flattened [start, end) doc id ranges in ascending order, must not be modified
+     */
+    public int[] getCachedDocIdRanges() {
+        long modifications = cachedDocModifications.get();
+        CachedDocIdRanges last = lastCachedDocIdRanges;
+        if (last != null && last.getModifications() == modifications) {
+            return last.getDocIdRanges();
+        }
+        int[] ranges = new int[0];
+        int size = 0;
+        for (int wordIndex = 0; wordIndex < cachedDocBits.length(); wordIndex++) {
+            long word = cachedDocBits.get(wordIndex);
+            while (word != 0) {
+                int docId = wordIndex * Long.SIZE + Long.numberOfTrailingZeros(word);
+                word &= word - 1;
+                // an insert and an erase racing on one doc may leave its bit stale, so the vector is the source of truth
+                if (sparseVectors.get(docId) == null) {
+                    continue;
+                }
+                if (size > 0 && ranges[size - 1] == docId) {
+                    ranges[size - 1]++;
+                } else {
+                    ranges = ArrayUtil.grow(ranges, size + 2);
+                    ranges[size++] = docId;
+                    ranges[size++] = docId + 1;
+                }
+            }
+        }
+        int[] docIdRanges = ArrayUtil.copyOfSubArray(ranges, 0, size);
+        lastCachedDocIdRanges = new CachedDocIdRanges(modifications, docIdRanges);
+        return docIdRanges;
+    }
+
+    private void markCached(int docId, boolean cached) {
+        long bit = 1L << docId;
+        if (cached) {
+            cachedDocBits.getAndAccumulate(docId / Long.SIZE, bit, (word, mask) -> word | mask);
+        } else {
+            cachedDocBits.getAndAccumulate(docId / Long.SIZE, bit, (word, mask) -> word & ~mask);
+        }
+        cachedDocModifications.incrementAndGet();
+    }
+
+    @Value
+    private static class CachedDocIdRanges {
+        long modifications;
+        int[] docIdRanges;
+    }
+
     private class CacheSparseVectorReader implements SparseVectorReader {
         @Override
         public SparseVector read(int docId) throws IOException {
@@ -73,7 +139,7 @@ public class ForwardIndexCacheItem extends AccountableTracker implements SparseV
 
         // Default handler: perform cache eviction when memory limit is reached
         private CacheSparseVectorWriter() {
-            this.circuitBreakerTriggerHandler = (ramBytesUsed) -> { LruDocumentCache.getInstance().evict(ramBytesUsed); };
+            this.circuitBreakerTriggerHandler = (ramBytesUsed) -> { LruDocumentCache.getInstance().evict(cacheKey, ramBytesUsed); };
         }
 
         private CacheSparseVectorWriter(Consumer<Long> circuitBreakerTriggerHandler) {
@@ -104,6 +170,7 @@ public class ForwardIndexCacheItem extends AccountableTracker implements SparseV
 
             // Only update memory usage if we actually inserted a new document
             if (sparseVectors.compareAndSet(docId, null, vector)) {
+                markCached(docId, true);
                 recordUsedBytes(ramBytesUsed);
             } else {
                 globalRamBytes.recordWithoutValidation(-ramBytesUsed, CircuitBreakerManager::addWithoutBreaking);
@@ -131,6 +198,7 @@ public class ForwardIndexCacheItem extends AccountableTracker implements SparseV
 
             // Only update memory usage if we actually erased a new document
             if (sparseVectors.compareAndSet(docId, vector, null)) {
+                markCached(docId, false);
                 recordUsedBytes(-ramBytesReleased);
                 globalRamBytes.recordWithoutValidation(-ramBytesReleased, CircuitBreakerManager::addWithoutBreaking);
                 return ramBytesReleased;
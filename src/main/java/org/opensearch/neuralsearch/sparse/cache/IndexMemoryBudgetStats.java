@@ -0,0 +1,73 @@
+/*
+ * Copyright OpenSearch Contributors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+package org.opensearch.neuralsearch.sparse.cache;
+
+import lombok.AllArgsConstructor;
+import lombok.EqualsAndHashCode;
+import lombok.Getter;
+import org.opensearch.core.common.io.stream.StreamInput;
+import org.opensearch.core.common.io.stream.StreamOutput;
+import org.opensearch.core.common.io.stream.Writeable;
+import org.opensearch.core.common.unit.ByteSizeValue;
+import org.opensearch.core.xcontent.ToXContentObject;
+import org.opensearch.core.xcontent.XContentBuilder;
+
+import java.io.IOException;
+import java.util.Map;
+import java.util.TreeMap;
+
+/**
+ * Snapshot of the SEISMIC cache memory an index occupies on a node compared to its budgets.
+ * Budgets of -1 mean unlimited.
+ */
+@Getter
+@EqualsAndHashCode
+@AllArgsConstructor
+public class IndexMemoryBudgetStats implements Writeable, ToXContentObject {
+    public static final String RESIDENT_FIELD = "resident";
+    public static final String RESIDENT_BYTES_FIELD = "resident_in_bytes";
+    public static final String BUDGET_FIELD = "budget";
+    public static final String BUDGET_BYTES_FIELD = "budget_in_bytes";
+    public static final String FIELDS_FIELD = "fields";
+
+    private final long residentBytes;
+    private final long budgetBytes;
+    private final Map<String, Long> fieldResidentBytes;
+    private final Map<String, Long> fieldBudgetBytes;
+
+    public IndexMemoryBudgetStats(StreamInput in) throws IOException {
+        this.residentBytes = in.readLong();
+        this.budgetBytes = in.readLong();
+        this.fieldResidentBytes = in.readMap(StreamInput::readString, StreamInput::readLong);
+        this.fieldBudgetBytes = in.readMap(StreamInput::readString, StreamInput::readLong);
+    }
+
+    @Override
+    public void writeTo(StreamOutput out) throws IOException {
+        out.writeLong(residentBytes);
+        out.writeLong(budgetBytes);
+        out.writeMap(fieldResidentBytes, StreamOutput::writeString, StreamOutput::writeLong);
+        out.writeMap(fieldBudgetBytes, StreamOutput::writeString, StreamOutput::writeLong);
+    }
+
+    @Override
+    public XContentBuilder toXContent(XContentBuilder builder, Params params) throws IOException {
+        builder.startObject();
+        addBytesFields(builder, residentBytes, budgetBytes);
+        builder.startObject(FIELDS_FIELD);
+        for (Map.Entry<String, Long> entry : new TreeMap<>(fieldResidentBytes).entrySet()) {
+            builder.startObject(entry.getKey());
+            addBytesFields(builder, entry.getValue(), fieldBudgetBytes.getOrDefault(entry.getKey(), -1L));
+            builder.endObject();
+        }
+        builder.endObject();
+        return builder.endObject();
+    }
+
+    private static void addBytesFields(XContentBuilder builder, long resident, long budget) throws IOException {
+        builder.humanReadableField(RESIDENT_BYTES_FIELD, RESIDENT_FIELD, new ByteSizeValue(resident));
+        builder.humanReadableField(BUDGET_BYTES_FIELD, BUDGET_FIELD, new ByteSizeValue(budget));
+    }
+}
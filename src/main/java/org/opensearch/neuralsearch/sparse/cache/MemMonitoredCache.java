@@ -31,6 +31,10 @@ public abstract class MemMonitoredCache<T extends Accountable> implements Accoun
      */
     public void onIndexRemoval(@NonNull CacheKey key) {
         cacheMap.computeIfPresent(key, (k, value) -> {
+            if (getRecorder(value) instanceof BudgetedRamBytesRecorder budgetedRecorder) {
+                // Release the item's memory from its index and field budgets, the global tracker is updated below
+                budgetedRecorder.releaseFromBudgets(value.ramBytesUsed());
+            }
             long ramBytesUsed = value.ramBytesUsed() + RamUsageEstimator.shallowSizeOf(k);
             MemoryUsageManager.getInstance()
                 .getMemoryUsageTracker()
@@ -60,6 +64,17 @@ public abstract class MemMonitoredCache<T extends Accountable> implements Accoun
         });
     }
 
+    /**
+     * Returns the recorder the memory of a cached value was recorded with.
+     * Subclasses whose values may record through a budgeted recorder must override this method.
+     *
+     * @param value a cached value
+     * @return the recorder of the value
+     */
+    protected RamBytesRecorder getRecorder(T value) {
+        return MemoryUsageManager.getInstance().getMemoryUsageTracker();
+    }
+
     /**
      * Gets an existing instance.
      *
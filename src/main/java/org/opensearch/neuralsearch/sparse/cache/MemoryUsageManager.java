@@ -21,6 +21,8 @@ import static org.opensearch.neuralsearch.sparse.common.SparseConstants.SEISMIC;
 public class MemoryUsageManager {
     private static volatile MemoryUsageManager instance;
     private RamBytesRecorder memoryUsageTracker;
+    // Bytes that can be recorded before the limit is reached, -1 if no limit has been set
+    private volatile long capacityBytes = -1L;
 
     protected MemoryUsageManager() {
         memoryUsageTracker = new RamBytesRecorder();
@@ -50,6 +52,7 @@ public class MemoryUsageManager {
      */
     public void setLimitAndOverhead(ByteSizeValue limit, double overhead) {
         memoryUsageTracker.setCanRecordIncrementChecker(getInternalAndCbPredicate(limit, overhead));
+        capacityBytes = (long) (limit.getBytes() / overhead);
     }
 
     @VisibleForTesting
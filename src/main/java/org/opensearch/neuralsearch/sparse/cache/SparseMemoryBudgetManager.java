@@ -0,0 +1,257 @@
+/*
+ * Copyright OpenSearch Contributors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+package org.opensearch.neuralsearch.sparse.cache;
+
+import com.google.common.annotations.VisibleForTesting;
+import lombok.Getter;
+import lombok.NonNull;
+import lombok.extern.log4j.Log4j2;
+import org.apache.lucene.store.Directory;
+import org.apache.lucene.store.FilterDirectory;
+import org.opensearch.common.settings.Settings;
+import org.opensearch.core.common.unit.ByteSizeValue;
+import org.opensearch.neuralsearch.sparse.SparseSettings;
+
+import java.util.HashMap;
+import java.util.Map;
+import java.util.Set;
+import java.util.concurrent.ConcurrentHashMap;
+import java.util.function.Predicate;
+import java.util.stream.Collectors;
+
+/**
+ * Singleton class that enforces per-index and per-field memory budgets on the SEISMIC caches.
+ * Cache items of a registered index record their memory through a chain of budgeted recorders
+ * (field, then index, then the global tracker), so one hot index cannot exceed its budget.
+ * It also decides which cache entries are evicted first when memory has to be released:
+ * the requester's own entries when it is over its budget, otherwise entries of indices above their fair share.
+ * CacheKeys are mapped to indices through the store directory of their segment.
+ */
+@Log4j2
+public class SparseMemoryBudgetManager {
+    public static final long UNLIMITED = -1L;
+
+    private static volatile SparseMemoryBudgetManager INSTANCE;
+
+    private final Map<Directory, String> directoryToIndex = new ConcurrentHashMap<>();
+    private final Map<String, IndexMemoryBudget> indexBudgets = new ConcurrentHashMap<>();
+
+    @VisibleForTesting
+    SparseMemoryBudgetManager() {}
+
+    public static SparseMemoryBudgetManager getInstance() {
+        if (INSTANCE == null) {
+            synchronized (SparseMemoryBudgetManager.class) {
+                if (INSTANCE == null) {
+                    INSTANCE = new SparseMemoryBudgetManager();
+                }
+            }
+        }
+        return INSTANCE;
+    }
+
+    /**
+     * Registers an index and its budgets on this node.
+     *
+     * @param indexName name of the index
+     * @param indexSettings settings of the index
+     */
+    public void registerIndex(@NonNull String indexName, @NonNull Settings indexSettings) {
+        IndexMemoryBudget indexMemoryBudget = indexBudgets.computeIfAbsent(
+            indexName,
+            name -> new IndexMemoryBudget(name, MemoryUsageManager.getInstance().getMemoryUsageTracker())
+        );
+        indexMemoryBudget.setBudgetBytes(SparseSettings.SPARSE_MEMORY_BUDGET_SETTING.get(indexSettings).getBytes());
+        indexMemoryBudget.setFieldBudgetBytes(
+            SparseSettings.parseFieldMemoryBudgets(SparseSettings.SPARSE_FIELD_MEMORY_BUDGET_SETTING.get(indexSettings))
+        );
+    }
+
+    /**
+     * Removes an index and all of its shard directories.
+     *
+     * @param indexName name of the index
+     */
+    public void removeIndex(@NonNull String indexName) {
+        indexBudgets.remove(indexName);
+        directoryToIndex.values().removeIf(indexName::equals);
+    }
+
+    /**
+     * Updates the budget of a registered index.
+     *
+     * @param indexName name of the index
+     * @param budget new budget, -1 means unlimited
+     */
+    public void updateIndexBudget(@NonNull String indexName, @NonNull ByteSizeValue budget) {
+        IndexMemoryBudget indexMemoryBudget = indexBudgets.get(indexName);
+        if (indexMemoryBudget != null) {
+            indexMemoryBudget.setBudgetBytes(budget.getBytes());
+        }
+    }
+
+    /**
+     * Updates the per-field budgets of a registered index.
+     *
+     * @param indexName name of the index
+     * @param fieldBudgets settings of {@link SparseSettings#SPARSE_FIELD_MEMORY_BUDGET_SETTING}
+     */
+    public void updateFieldBudgets(@NonNull String indexName, @NonNull Settings fieldBudgets) {
+        IndexMemoryBudget indexMemoryBudget = indexBudgets.get(indexName);
+        if (indexMemoryBudget != null) {
+            indexMemoryBudget.setFieldBudgetBytes(SparseSettings.parseFieldMemoryBudgets(fieldBudgets));
+        }
+    }
+
+    /**
+     * Maps the store directory of a shard to its index so that CacheKeys of the shard's segments can be resolved.
+     *
+     * @param indexName name of the index
+     * @param directory store directory of the shard
+     */
+    public void registerShard(@NonNull String indexName, @NonNull Directory directory) {
+        directoryToIndex.put(FilterDirectory.unwrap(directory), indexName);
+    }
+
+    /**
+     * @param directory store directory of a closed shard
+     */
+    public void unregisterShard(@NonNull Directory directory) {
+        directoryToIndex.remove(FilterDirectory.unwrap(directory));
+    }
+
+    /**
+     * Resolves the index a CacheKey belongs to.
+     *
+     * @param key the cache key
+     * @return the index name, or null if the segment does not belong to a registered shard
+     */
+    public String resolveIndex(@NonNull CacheKey key) {
+        Directory directory = key.getSegmentInfo().dir;
+        return directory == null ? null : directoryToIndex.get(FilterDirectory.unwrap(directory));
+    }
+
+    /**
+     * Returns the recorder a new cache item of the given key should record its memory with.
+     *
+     * @param key the cache key
+     * @return the budgeted field recorder of a registered index, otherwise the global tracker
+     */
+    public RamBytesRecorder getRecorder(@NonNull CacheKey key) {
+        IndexMemoryBudget indexMemoryBudget = getIndexMemoryBudget(key);
+        if (indexMemoryBudget == null) {
+            return MemoryUsageManager.getInstance().getMemoryUsageTracker();
+        }
+        return indexMemoryBudget.getFieldRecorder(key.getField());
+    }
+
+    /**
+     * Returns the scope eviction has to be restricted to when recording more bytes for the requester
+     * would exceed the requester's own field or index budget. Evicting other indices does not help in this case.
+     *
+     * @param requester key of the cache item that needs memory
+     * @param bytes bytes the requester wants to record
+     * @return predicate matching the over-budget field or index, or null if the requester is within its budgets
+     */
+    public Predicate<CacheKey> getOverBudgetScope(@NonNull CacheKey requester, long bytes) {
+        IndexMemoryBudget indexMemoryBudget = getIndexMemoryBudget(requester);
+        if (indexMemoryBudget == null) {
+            return null;
+        }
+        String indexName = indexMemoryBudget.getIndexName();
+        String field = requester.getField();
+        if (indexMemoryBudget.getFieldRecorder(field).isOverBudget(bytes)) {
+            return key -> field.equals(key.getField()) && indexName.equals(resolveIndex(key));
+        }
+        if (indexMemoryBudget.getRecorder().isOverBudget(bytes)) {
+            return key -> indexName.equals(resolveIndex(key));
+        }
+        return null;
+    }
+
+    /**
+     * Returns the scope of indices occupying more than their fair share of the global capacity.
+     * The fair share is the global capacity divided evenly between the registered indices.
+     *
+     * @return predicate matching keys of indices above their fair share, or null if there is none
+     */
+    public Predicate<CacheKey> getOverFairShareScope() {
+        long capacity = MemoryUsageManager.getInstance().getCapacityBytes();
+        int indexCount = indexBudgets.size();
+        if (capacity <= 0 || indexCount < 2) {
+            return null;
+        }
+        long fairShare = capacity / indexCount;
+        Set<String> overFairShare = indexBudgets.values()
+            .stream()
+            .filter(indexMemoryBudget -> indexMemoryBudget.getRecorder().getBytes() > fairShare)
+            .map(IndexMemoryBudget::getIndexName)
+            .collect(Collectors.toSet());
+        if (overFairShare.isEmpty()) {
+            return null;
+        }
+        return key -> overFairShare.contains(resolveIndex(key));
+    }
+
+    /**
+     * @return resident bytes and budgets of every registered index on this node
+     */
+    public Map<String, IndexMemoryBudgetStats> getStats() {
+        Map<String, IndexMemoryBudgetStats> stats = new HashMap<>();
+        for (IndexMemoryBudget indexMemoryBudget : indexBudgets.values()) {
+            stats.put(indexMemoryBudget.getIndexName(), indexMemoryBudget.getStats());
+        }
+        return stats;
+    }
+
+    private IndexMemoryBudget getIndexMemoryBudget(CacheKey key) {
+        String indexName = resolveIndex(key);
+        return indexName == null ? null : indexBudgets.get(indexName);
+    }
+
+    /**
+     * Budgets and recorders of one index.
+     */
+    @Getter
+    private static class IndexMemoryBudget {
+        private final String indexName;
+        private final BudgetedRamBytesRecorder recorder;
+        private final Map<String, BudgetedRamBytesRecorder> fieldRecorders = new ConcurrentHashMap<>();
+        private volatile long budgetBytes = UNLIMITED;
+        private volatile Map<String, Long> fieldBudgetBytes = Map.of();
+
+        IndexMemoryBudget(String indexName, RamBytesRecorder globalRecorder) {
+            this.indexName = indexName;
+            this.recorder = new BudgetedRamBytesRecorder(globalRecorder, () -> budgetBytes);
+        }
+
+        void setBudgetBytes(long budgetBytes) {
+            this.budgetBytes = budgetBytes;
+        }
+
+        void setFieldBudgetBytes(Map<String, Long> fieldBudgetBytes) {
+            this.fieldBudgetBytes = Map.copyOf(fieldBudgetBytes);
+        }
+
+        BudgetedRamBytesRecorder getFieldRecorder(String field) {
+            return fieldRecorders.computeIfAbsent(
+                field,
+                name -> new BudgetedRamBytesRecorder(recorder, () -> fieldBudgetBytes.getOrDefault(name, UNLIMITED))
+            );
+        }
+
+        IndexMemoryBudgetStats getStats() {
+            Map<String, Long> fieldResidentBytes = new HashMap<>();
+            Map<String, Long> fieldBudgets = new HashMap<>(fieldBudgetBytes);
+            for (Map.Entry<String, BudgetedRamBytesRecorder> entry : fieldRecorders.entrySet()) {
+                fieldResidentBytes.put(entry.getKey(), entry.getValue().getBytes());
+            }
+            for (String field : fieldBudgets.keySet()) {
+                fieldResidentBytes.putIfAbsent(field, 0L);
+            }
+            return new IndexMemoryBudgetStats(recorder.getBytes(), budgetBytes, fieldResidentBytes, fieldBudgets);
+        }
+    }
+}
@@ -0,0 +1,242 @@
+/*
+ * Copyright OpenSearch Contributors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+package org.opensearch.neuralsearch.sparse.cache;
+
+import com.google.common.annotations.VisibleForTesting;
+import com.googlecode.concurrentlinkedhashmap.ConcurrentLinkedHashMap;
+import com.googlecode.concurrentlinkedhashmap.EntryWeigher;
+import lombok.Getter;
+import lombok.NonNull;
+import lombok.extern.log4j.Log4j2;
+import org.apache.commons.lang3.tuple.Pair;
+import org.apache.lucene.index.IndexReader;
+import org.apache.lucene.util.Accountable;
+import org.apache.lucene.util.RamUsageEstimator;
+import org.opensearch.core.common.unit.ByteSizeValue;
+import org.opensearch.neuralsearch.sparse.data.SparseVector;
+import org.opensearch.neuralsearch.sparse.query.SparseQueryContext;
+
+import java.util.ArrayList;
+import java.util.List;
+import java.util.Map;
+import java.util.Objects;
+import java.util.Set;
+import java.util.concurrent.ConcurrentHashMap;
+
+/**
+ * Node level, byte bounded LRU cache of SEISMIC top-k results per segment.
+ * Entries are keyed by the reader of the segment, the field and the quantized query, so a new reader
+ * (e.g. after deletes) never sees stale results, and all entries of a reader are dropped when it closes.
+ * Memory of the entries is accounted in the global memory usage tracker and the neural circuit breaker.
+ */
+@Log4j2
+public class SparseQueryResultCache {
+    private static volatile SparseQueryResultCache INSTANCE;
+
+    private final ConcurrentLinkedHashMap<Key, Results> cache;
+    private final Map<IndexReader.CacheKey, Set<Key>> keysByReader = new ConcurrentHashMap<>();
+
+    @VisibleForTesting
+    SparseQueryResultCache(long capacityInBytes) {
+        this.cache = new ConcurrentLinkedHashMap.Builder<Key, Results>().maximumWeightedCapacity(capacityInBytes)
+            .weigher((EntryWeigher<Key, Results>) (key, results) -> (int) Math.min(Integer.MAX_VALUE, entryBytes(key, results)))
+            .listener(this::onEviction)
+            .build();
+    }
+
+    public static SparseQueryResultCache getInstance() {
+        if (INSTANCE == null) {
+            synchronized (SparseQueryResultCache.class) {
+                if (INSTANCE == null) {
+                    INSTANCE = new SparseQueryResultCache(0);
+                }
+            }
+        }
+        return INSTANCE;
+    }
+
+    /**
+     * Updates the capacity of the cache, evicting entries if needed. Zero disables the cache.
+     *
+     * @param capacity the new capacity
+     */
+    public void setCapacity(@NonNull ByteSizeValue capacity) {
+        cache.setCapacity(capacity.getBytes());
+    }
+
+    /**
+     * @return true if the cache may hold entries
+     */
+    public boolean isEnabled() {
+        return cache.capacity() > 0;
+    }
+
+    /**
+     * Looks up the top-k results of a query on a segment.
+     *
+     * @param key the result key
+     * @return results ordered by doc id, or null on cache miss
+     */
+    public List<Pair<Integer, Integer>> get(@NonNull Key key) {
+        Results results = cache.get(key);
+        return results == null ? null : results.toOrderedList();
+    }
+
+    /**
+     * Caches the top-k results of a query on a segment if the memory can be accounted.
+     *
+     * @param key the result key
+     * @param readerCacheHelper cache helper of the segment reader, used to invalidate entries when the reader closes
+     * @param results results ordered by doc id
+     */
+    public void put(@NonNull Key key, @NonNull IndexReader.CacheHelper readerCacheHelper, @NonNull List<Pair<Integer, Integer>> results) {
+        if (!isEnabled()) {
+            return;
+        }
+        Results value = new Results(results);
+        long entryBytes = entryBytes(key, value);
+        RamBytesRecorder globalRecorder = MemoryUsageManager.getInstance().getMemoryUsageTracker();
+        if (!globalRecorder.record(entryBytes)) {
+            return;
+        }
+        keysByReader.computeIfAbsent(key.getReaderKey(), readerKey -> {
+            readerCacheHelper.addClosedListener(this::invalidate);
+            return ConcurrentHashMap.newKeySet();
+        }).add(key);
+        if (cache.putIfAbsent(key, value) != null) {
+            globalRecorder.recordWithoutValidation(-entryBytes, CircuitBreakerManager::addWithoutBreaking);
+        }
+    }
+
+    /**
+     * Removes all entries of a closed reader.
+     *
+     * @param readerKey key of the closed reader
+     */
+    public void invalidate(@NonNull IndexReader.CacheKey readerKey) {
+        Set<Key> keys = keysByReader.remove(readerKey);
+        if (keys == null) {
+            return;
+        }
+        for (Key key : keys) {
+            Results results = cache.remove(key);
+            if (results != null) {
+                release(key, results);
+            }
+        }
+    }
+
+    /**
+     * @return bytes currently held by the cache
+     */
+    public long ramBytesUsed() {
+        return cache.weightedSize();
+    }
+
+    private void onEviction(Key key, Results results) {
+        Set<Key> keys = keysByReader.get(key.getReaderKey());
+        if (keys != null) {
+            keys.remove(key);
+        }
+        release(key, results);
+    }
+
+    private void release(Key key, Results results) {
+        MemoryUsageManager.getInstance()
+            .getMemoryUsageTracker()
+            .recordWithoutValidation(-entryBytes(key, results), CircuitBreakerManager::addWithoutBreaking);
+    }
+
+    private static long entryBytes(Key key, Results results) {
+        return key.ramBytesUsed() + results.ramBytesUsed();
+    }
+
+    /**
+     * Identifies the results of one query on one segment. The filter is not part of the key because
+     * SEISMIC applies it after the top-k traversal, so the cached results are valid for any filter.
+     */
+    @Getter
+    public static class Key implements Accountable {
+        private static final long BASE_RAM_BYTES_USED = RamUsageEstimator.shallowSizeOfInstance(Key.class);
+
+        private final IndexReader.CacheKey readerKey;
+        private final String field;
+        private final SparseVector queryVector;
+        private final SparseQueryContext queryContext;
+        private final int hash;
+
+        public Key(
+            @NonNull IndexReader.CacheKey readerKey,
+            @NonNull String field,
+            @NonNull SparseVector queryVector,
+            @NonNull SparseQueryContext queryContext
+        ) {
+            this.readerKey = readerKey;
+            this.field = field;
+            this.queryVector = queryVector;
+            this.queryContext = queryContext;
+            // The key is hashed on every lookup, so hash the query vector only once
+            this.hash = Objects.hash(readerKey, field, queryVector, queryContext);
+        }
+
+        @Override
+        public boolean equals(Object o) {
+            if (this == o) {
+                return true;
+            }
+            if (o == null || getClass() != o.getClass()) {
+                return false;
+            }
+            Key other = (Key) o;
+            return hash == other.hash
+                && readerKey.equals(other.readerKey)
+                && field.equals(other.field)
+                && queryContext.equals(other.queryContext)
+                && queryVector.equals(other.queryVector);
+        }
+
+        @Override
+        public int hashCode() {
+            return hash;
+        }
+
+        @Override
+        public long ramBytesUsed() {
+            return BASE_RAM_BYTES_USED + queryVector.ramBytesUsed();
+        }
+    }
+
+    /**
+     * Top-k results stored as primitive arrays ordered by doc id.
+     */
+    private static class Results implements Accountable {
+        private static final long BASE_RAM_BYTES_USED = RamUsageEstimator.shallowSizeOfInstance(Results.class);
+
+        private final int[] docIds;
+        private final int[] scores;
+
+        Results(List<Pair<Integer, Integer>> results) {
+            docIds = new int[results.size()];
+            scores = new int[results.size()];
+            for (int i = 0; i < results.size(); i++) {
+                docIds[i] = results.get(i).getLeft();
+                scores[i] = results.get(i).getRight();
+            }
+        }
+
+        List<Pair<Integer, Integer>> toOrderedList() {
+            List<Pair<Integer, Integer>> results = new ArrayList<>(docIds.length);
+            for (int i = 0; i < docIds.length; i++) {
+                results.add(Pair.of(docIds[i], scores[i]));
+            }
+            return results;
+        }
+
+        @Override
+        public long ramBytesUsed() {
+            return BASE_RAM_BYTES_USED + RamUsageEstimator.sizeOf(docIds) + RamUsageEstimator.sizeOf(scores);
+        }
+    }
+}
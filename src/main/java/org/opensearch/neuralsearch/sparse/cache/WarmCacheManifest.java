@@ -0,0 +1,179 @@
+/*
+ * Copyright OpenSearch Contributors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+package org.opensearch.neuralsearch.sparse.cache;
+
+import lombok.AllArgsConstructor;
+import lombok.Getter;
+import lombok.NonNull;
+import lombok.Value;
+import lombok.extern.log4j.Log4j2;
+import org.apache.lucene.index.SegmentInfo;
+import org.apache.lucene.util.ArrayUtil;
+import org.apache.lucene.util.BytesRef;
+import org.apache.lucene.util.StringHelper;
+import org.opensearch.core.common.io.stream.InputStreamStreamInput;
+import org.opensearch.core.common.io.stream.OutputStreamStreamOutput;
+import org.opensearch.core.common.io.stream.StreamInput;
+import org.opensearch.core.common.io.stream.StreamOutput;
+
+import java.io.IOException;
+import java.io.InputStream;
+import java.io.OutputStream;
+import java.nio.file.Files;
+import java.nio.file.NoSuchFileException;
+import java.nio.file.Path;
+import java.nio.file.StandardCopyOption;
+import java.util.ArrayList;
+import java.util.List;
+
+/**
+ * Compact description of the sparse data that was resident in cache for one shard.
+ * For every CacheKey it records the cached terms of the clustered postings and the cached
+ * doc ids of the forward index (as [start, end) ranges). It is persisted to the shard data
+ * directory so that a restarted node can warm exactly this working set instead of the whole index.
+ */
+@Log4j2
+@Getter
+@AllArgsConstructor
+public class WarmCacheManifest {
+    public static final String FILE_NAME = "neural_sparse_warm_cache.manifest";
+    private static final int FORMAT_VERSION = 1;
+
+    private final List<Entry> entries;
+
+    /**
+     * @return true if the manifest does not describe any cached data
+     */
+    public boolean isEmpty() {
+        return entries.isEmpty();
+    }
+
+    /**
+     * Atomically writes the manifest to the given path by writing a temporary file first.
+     *
+     * @param path destination of the manifest
+     * @throws IOException if the manifest cannot be written
+     */
+    public void writeTo(@NonNull Path path) throws IOException {
+        Path tmpPath = path.resolveSibling(path.getFileName() + ".tmp");
+        try (OutputStream outputStream = Files.newOutputStream(tmpPath); StreamOutput out = new OutputStreamStreamOutput(outputStream)) {
+            out.writeVInt(FORMAT_VERSION);
+            out.writeVInt(entries.size());
+            for (Entry entry : entries) {
+                out.writeString(entry.getSegmentName());
+                out.writeString(entry.getSegmentId());
+                out.writeString(entry.getField());
+                out.writeVInt(entry.getTerms().size());
+                for (BytesRef term : entry.getTerms()) {
+                    out.writeBytesRef(term);
+                }
+                out.writeVIntArray(entry.getDocIdRanges());
+            }
+        }
+        Files.move(tmpPath, path, StandardCopyOption.REPLACE_EXISTING, StandardCopyOption.ATOMIC_MOVE);
+    }
+
+    /**
+     * Reads a manifest previously written by {@link #writeTo(Path)}.
+     *
+     * @param path location of the manifest
+     * @return the manifest, or null if it does not exist or was written in an unknown format
+     * @throws IOException if the manifest exists but cannot be read
+     */
+    public static WarmCacheManifest readFrom(@NonNull Path path) throws IOException {
+        try (InputStream inputStream = Files.newInputStream(path); StreamInput in = new InputStreamStreamInput(inputStream)) {
+            int version = in.readVInt();
+            if (version != FORMAT_VERSION) {
+                log.warn("[Neural Sparse] Ignoring warm cache manifest {} with unsupported version {}", path, version);
+                return null;
+            }
+            int entryCount = in.readVInt();
+            List<Entry> entries = new ArrayList<>(entryCount);
+            for (int i = 0; i < entryCount; i++) {
+                String segmentName = in.readString();
+                String segmentId = in.readString();
+                String field = in.readString();
+                int termCount = in.readVInt();
+                List<BytesRef> terms = new ArrayList<>(termCount);
+                for (int j = 0; j < termCount; j++) {
+                    terms.add(in.readBytesRef());
+                }
+                int[] docIdRanges = in.readVIntArray();
+                entries.add(new Entry(segmentName, segmentId, field, terms, docIdRanges));
+            }
+            return new WarmCacheManifest(entries);
+        } catch (NoSuchFileException e) {
+            return null;
+        }
+    }
+
+    /**
+     * Builds the key identifying a segment and field across node restarts. Unlike {@link CacheKey},
+     * which relies on the identity of the in-memory SegmentInfo, this key only uses persisted segment metadata.
+     *
+     * @param segmentInfo the segment
+     * @param field the sparse field name
+     * @return a stable key for the segment and field
+     */
+    public static String entryKey(@NonNull SegmentInfo segmentInfo, @NonNull String field) {
+        return entryKey(segmentInfo.name, StringHelper.idToString(segmentInfo.getId()), field);
+    }
+
+    private static String entryKey(String segmentName, String segmentId, String field) {
+        return String.join("/", segmentName, segmentId, field);
+    }
+
+    /**
+     * Compresses ascending doc ids into flattened [start, end) ranges.
+     *
+     * @param sortedDocIds ascending doc ids
+     * @param count number of valid doc ids in the array
+     * @return flattened ranges
+     */
+    public static int[] toDocIdRanges(int[] sortedDocIds, int count) {
+        int[] ranges = new int[0];
+        int size = 0;
+        int i = 0;
+        while (i < count) {
+            int start = sortedDocIds[i];
+            int end = start + 1;
+            while (++i < count && sortedDocIds[i] == end) {
+                end++;
+            }
+            ranges = ArrayUtil.grow(ranges, size + 2);
+            ranges[size++] = start;
+            ranges[size++] = end;
+        }
+        return ArrayUtil.copyOfSubArray(ranges, 0, size);
+    }
+
+    /**
+     * Cached working set of one segment and field.
+     */
+    @Value
+    public static class Entry {
+        String segmentName;
+        String segmentId;
+        String field;
+        List<BytesRef> terms;
+        int[] docIdRanges;
+
+        public Entry(SegmentInfo segmentInfo, String field, List<BytesRef> terms, int[] docIdRanges) {
+            this(segmentInfo.name, StringHelper.idToString(segmentInfo.getId()), field, terms, docIdRanges);
+        }
+
+        public Entry(String segmentName, String segmentId, String field, List<BytesRef> terms, int[] docIdRanges) {
+            this.segmentName = segmentName;
+            this.segmentId = segmentId;
+            this.field = field;
+            this.terms = terms;
+            this.docIdRanges = docIdRanges;
+        }
+
+        public String getKey() {
+            return entryKey(segmentName, segmentId, field);
+        }
+    }
+}
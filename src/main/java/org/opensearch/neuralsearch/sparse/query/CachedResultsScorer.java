@@ -0,0 +1,61 @@
+/*
+ * Copyright OpenSearch Contributors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+package org.opensearch.neuralsearch.sparse.query;
+
+import org.apache.commons.lang3.tuple.Pair;
+import org.apache.lucene.search.ConjunctionUtils;
+import org.apache.lucene.search.DocIdSetIterator;
+import org.apache.lucene.search.Scorer;
+import org.apache.lucene.search.similarities.Similarity;
+import org.apache.lucene.util.BitSetIterator;
+
+import java.io.IOException;
+import java.util.List;
+
+/**
+ * Scorer over top-k results served from the SparseQueryResultCache.
+ * It behaves like OrderedPostingWithClustersScorer without repeating the cluster traversal.
+ */
+public class CachedResultsScorer extends Scorer {
+
+    private final Similarity.SimScorer simScorer;
+    private final DocIdSetIterator conjunctionDisi;
+
+    /**
+     * Creates scorer from cached results and optional filtering.
+     */
+    public CachedResultsScorer(List<Pair<Integer, Integer>> results, Similarity.SimScorer simScorer, BitSetIterator filterBitSetIterator) {
+        this.simScorer = simScorer;
+        SeismicBaseScorer.ResultsDocValueIterator resultsIterator = new SeismicBaseScorer.ResultsDocValueIterator(results);
+        if (filterBitSetIterator != null) {
+            conjunctionDisi = ConjunctionUtils.intersectIterators(List.of(resultsIterator, filterBitSetIterator));
+        } else {
+            conjunctionDisi = resultsIterator;
+        }
+    }
+
+    @Override
+    public int docID() {
+        return conjunctionDisi.docID();
+    }
+
+    @Override
+    public DocIdSetIterator iterator() {
+        return conjunctionDisi;
+    }
+
+    @Override
+    public float getMaxScore(int upTo) throws IOException {
+        return 0;
+    }
+
+    /**
+     * Computes score for current document using similarity scorer.
+     */
+    @Override
+    public float score() throws IOException {
+        return this.simScorer.score(conjunctionDisi.cost(), 0);
+    }
+}
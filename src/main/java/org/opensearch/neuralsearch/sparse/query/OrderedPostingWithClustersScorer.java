@@ -4,6 +4,7 @@
  */
 package org.opensearch.neuralsearch.sparse.query;
 
+import lombok.Getter;
 import lombok.NonNull;
 import org.apache.commons.lang3.tuple.Pair;
 import org.apache.lucene.index.LeafReader;
@@ -26,6 +27,8 @@ public class OrderedPostingWithClustersScorer extends SeismicBaseScorer {
 
     private final Similarity.SimScorer simScorer;
     private final DocIdSetIterator conjunctionDisi;
+    @Getter
+    private final List<Pair<Integer, Integer>> results;
 
     /**
      * Creates scorer with upfront search results and optional filtering.
@@ -42,7 +45,7 @@ public class OrderedPostingWithClustersScorer extends SeismicBaseScorer {
     ) throws IOException {
         super(leafReader, fieldName, sparseQueryContext, leafReader.maxDoc(), queryVector, reader, acceptedDocs);
         this.simScorer = simScorer;
-        List<Pair<Integer, Integer>> results = searchUpfront(sparseQueryContext.getK());
+        results = searchUpfront(sparseQueryContext.getK());
         ResultsDocValueIterator resultsIterator = new ResultsDocValueIterator(results);
         if (filterBitSetIterator != null) {
             conjunctionDisi = ConjunctionUtils.intersectIterators(List.of(resultsIterator, filterBitSetIterator));
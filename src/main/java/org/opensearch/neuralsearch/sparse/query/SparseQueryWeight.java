@@ -6,8 +6,10 @@ package org.opensearch.neuralsearch.sparse.query;
 
 import com.google.common.annotations.VisibleForTesting;
 import lombok.extern.log4j.Log4j2;
+import org.apache.commons.lang3.tuple.Pair;
 import org.apache.lucene.index.BinaryDocValues;
 import org.apache.lucene.index.FieldInfo;
+import org.apache.lucene.index.IndexReader;
 import org.apache.lucene.index.LeafReader;
 import org.apache.lucene.index.LeafReaderContext;
 import org.apache.lucene.index.SegmentInfo;
@@ -31,12 +33,16 @@ import org.opensearch.neuralsearch.sparse.cache.CacheGatedForwardIndexReader;
 import org.opensearch.neuralsearch.sparse.cache.CacheKey;
 import org.opensearch.neuralsearch.sparse.cache.ForwardIndexCache;
 import org.opensearch.neuralsearch.sparse.cache.ForwardIndexCacheItem;
+import org.opensearch.neuralsearch.sparse.cache.SparseQueryResultCache;
 import org.opensearch.neuralsearch.sparse.codec.SparseBinaryDocValuesPassThrough;
 import org.opensearch.neuralsearch.sparse.common.PredicateUtils;
 import org.opensearch.neuralsearch.sparse.quantization.ByteQuantizationUtil;
 import org.opensearch.neuralsearch.sparse.query.explain.SparseExplanationBuilder;
+import org.opensearch.neuralsearch.stats.events.EventStatName;
+import org.opensearch.neuralsearch.stats.events.EventStatsManager;
 
 import java.io.IOException;
+import java.util.List;
 
 import static org.opensearch.neuralsearch.sparse.quantization.ByteQuantizationUtil.MAX_UNSIGNED_BYTE_VALUE;
 
@@ -48,6 +54,7 @@ public class SparseQueryWeight extends Weight {
     private final float boost;
     private final Weight fallbackQueryWeight;
     private final ForwardIndexCache forwardIndexCache;
+    private final SparseQueryResultCache queryResultCache;
 
     public SparseQueryWeight(
         SparseVectorQuery query,
@@ -55,10 +62,22 @@ public class SparseQueryWeight extends Weight {
         ScoreMode scoreMode,
         float boost,
         ForwardIndexCache forwardIndexCache
+    ) throws IOException {
+        this(query, searcher, scoreMode, boost, forwardIndexCache, SparseQueryResultCache.getInstance());
+    }
+
+    public SparseQueryWeight(
+        SparseVectorQuery query,
+        IndexSearcher searcher,
+        ScoreMode scoreMode,
+        float boost,
+        ForwardIndexCache forwardIndexCache,
+        SparseQueryResultCache queryResultCache
     ) throws IOException {
         super(query);
         this.boost = boost;
         this.forwardIndexCache = forwardIndexCache;
+        this.queryResultCache = queryResultCache;
         this.fallbackQueryWeight = query.getFallbackQuery().createWeight(searcher, scoreMode, boost);
     }
 
@@ -164,7 +183,16 @@ public class SparseQueryWeight extends Weight {
                 }
             }
         }
-        return new OrderedPostingWithClustersScorer(
+        SparseQueryResultCache.Key resultKey = createResultCacheKey(query, context);
+        if (resultKey != null) {
+            List<Pair<Integer, Integer>> cachedResults = queryResultCache.get(resultKey);
+            if (cachedResults != null) {
+                EventStatsManager.increment(EventStatName.SEISMIC_QUERY_RESULT_CACHE_HITS);
+                return new CachedResultsScorer(cachedResults, simScorer, filterBitIterator);
+            }
+            EventStatsManager.increment(EventStatName.SEISMIC_QUERY_RESULT_CACHE_MISSES);
+        }
+        OrderedPostingWithClustersScorer scorer = new OrderedPostingWithClustersScorer(
             query.getFieldName(),
             query.getQueryContext(),
             query.getQueryVector(),
@@ -174,6 +202,27 @@ public class SparseQueryWeight extends Weight {
             simScorer,
             filterBitIterator
         );
+        if (resultKey != null) {
+            queryResultCache.put(resultKey, context.reader().getReaderCacheHelper(), scorer.getResults());
+        }
+        return scorer;
+    }
+
+    // Results depend on the live docs, so they are cached per reader instead of per segment core
+    private SparseQueryResultCache.Key createResultCacheKey(SparseVectorQuery query, LeafReaderContext context) {
+        if (!queryResultCache.isEnabled()) {
+            return null;
+        }
+        IndexReader.CacheHelper readerCacheHelper = context.reader().getReaderCacheHelper();
+        if (readerCacheHelper == null) {
+            return null;
+        }
+        return new SparseQueryResultCache.Key(
+            readerCacheHelper.getKey(),
+            query.getFieldName(),
+            query.getQueryVector(),
+            query.getQueryContext()
+        );
     }
 
     private SparseVectorReader getCacheGatedForwardIndexReader(SparseVectorForwardIndex index, LeafReader leafReader, String fieldName)
@@ -185,6 +234,10 @@ public class SparseQueryWeight extends Weight {
         return SparseVectorReader.NOOP_READER;
     }
 
+    /**
+     * The Lucene query cache only caches matching docs without scores, so top-k results are cached
+     * in the SparseQueryResultCache instead.
+     */
     @Override
     public boolean isCacheable(LeafReaderContext ctx) {
         return false;
@@ -27,6 +27,12 @@ public interface EventStat {
      */
     void increment();
 
+    /**
+     * Adds a number of events to the stat at once
+     * @param count number of events
+     */
+    void add(long count);
+
     /**
      * Resets the stat value
      */
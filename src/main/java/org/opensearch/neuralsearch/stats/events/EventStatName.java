@@ -272,6 +272,129 @@ public enum EventStatName implements StatName {
         "processors.search",
         EventStatType.TIMESTAMPED_EVENT_COUNTER,
         Version.V_3_3_0
+    ),
+    /** Counts seismic segment searches served from the query result cache */
+    SEISMIC_QUERY_RESULT_CACHE_HITS(
+        "seismic_query_result_cache_hits",
+        "query.neural_sparse",
+        EventStatType.TIMESTAMPED_EVENT_COUNTER,
+        Version.V_3_6_0
+    ),
+    /** Counts seismic segment searches that missed the query result cache */
+    SEISMIC_QUERY_RESULT_CACHE_MISSES(
+        "seismic_query_result_cache_misses",
+        "query.neural_sparse",
+        EventStatType.TIMESTAMPED_EVENT_COUNTER,
+        Version.V_3_6_0
+    ),
+    /** Counts query inferences served from the inference result cache */
+    INFERENCE_RESULT_CACHE_HITS(
+        "inference_result_cache_hits",
+        "query.inference",
+        EventStatType.TIMESTAMPED_EVENT_COUNTER,
+        Version.V_3_6_0
+    ),
+    /** Counts query inferences that missed the inference result cache */
+    INFERENCE_RESULT_CACHE_MISSES(
+        "inference_result_cache_misses",
+        "query.inference",
+        EventStatType.TIMESTAMPED_EVENT_COUNTER,
+        Version.V_3_6_0
+    ),
+    /** Counts query inferences that joined an identical in-flight inference instead of calling the model */
+    INFERENCE_COALESCED_REQUESTS(
+        "inference_coalesced_requests",
+        "query.inference",
+        EventStatType.TIMESTAMPED_EVENT_COUNTER,
+        Version.V_3_6_0
+    ),
+    /** Counts retries of ML Commons calls that failed because the ML node could not be reached */
+    ML_INFERENCE_RETRIES("ml_inference_retries", "ml.inference", EventStatType.TIMESTAMPED_EVENT_COUNTER, Version.V_3_6_0),
+    /** Counts retryable ML Commons failures that were not retried because of the retry limit or budget */
+    ML_INFERENCE_RETRY_GIVE_UPS(
+        "ml_inference_retry_give_ups",
+        "ml.inference",
+        EventStatType.TIMESTAMPED_EVENT_COUNTER,
+        Version.V_3_6_0
+    ),
+    /** Counts texts collected for ingest inference, before duplicates within a batch are removed */
+    INGEST_INFERENCE_TEXTS("ingest_inference_texts", "processors.ingest", EventStatType.TIMESTAMPED_EVENT_COUNTER, Version.V_3_6_0),
+    /** Counts duplicate texts within an ingest batch that were not sent to the model, ratio to ingest_inference_texts is the dedup ratio */
+    INGEST_INFERENCE_DEDUPLICATED_TEXTS(
+        "ingest_inference_deduplicated_texts",
+        "processors.ingest",
+        EventStatType.TIMESTAMPED_EVENT_COUNTER,
+        Version.V_3_6_0
+    ),
+    /** Counts micro-batches sent to the model for ingest inferences that were split by the token budget or text limit */
+    INGEST_INFERENCE_MICRO_BATCHES(
+        "ingest_inference_micro_batches",
+        "processors.ingest",
+        EventStatType.TIMESTAMPED_EVENT_COUNTER,
+        Version.V_3_6_0
+    ),
+    /** Counts ML inference calls that waited for a free slot of their model */
+    INFERENCE_DISPATCHER_QUEUED_REQUESTS(
+        "inference_dispatcher_queued_requests",
+        "ml.inference",
+        EventStatType.TIMESTAMPED_EVENT_COUNTER,
+        Version.V_3_6_0
+    ),
+    /** Counts ML inference calls rejected because the queue of their model was full */
+    INFERENCE_DISPATCHER_REJECTIONS(
+        "inference_dispatcher_rejections",
+        "ml.inference",
+        EventStatType.TIMESTAMPED_EVENT_COUNTER,
+        Version.V_3_6_0
+    ),
+    /** Counts decreases of the adaptive in-flight limit of a model after throttling or latency spikes */
+    INFERENCE_DISPATCHER_LIMIT_DECREASES(
+        "inference_dispatcher_limit_decreases",
+        "ml.inference",
+        EventStatType.TIMESTAMPED_EVENT_COUNTER,
+        Version.V_3_6_0
+    ),
+    /** Counts documents whose stored content hash matched, so the embeddings they carry were reused without a fetch */
+    SKIP_EXISTING_CONTENT_HASH_MATCHES(
+        "skip_existing_content_hash_matches",
+        "processors.ingest",
+        EventStatType.TIMESTAMPED_EVENT_COUNTER,
+        Version.V_3_6_0
+    ),
+    /** Counts ingest inference texts served from the ingest inference cache */
+    INGEST_INFERENCE_CACHE_HITS(
+        "ingest_inference_cache_hits",
+        "processors.ingest",
+        EventStatType.TIMESTAMPED_EVENT_COUNTER,
+        Version.V_3_6_0
+    ),
+    /** Counts ingest inference texts that missed the ingest inference cache */
+    INGEST_INFERENCE_CACHE_MISSES(
+        "ingest_inference_cache_misses",
+        "processors.ingest",
+        EventStatType.TIMESTAMPED_EVENT_COUNTER,
+        Version.V_3_6_0
+    ),
+    /** Counts predict requests of slices of the texts of a model sent by the semantic field processor */
+    SEMANTIC_FIELD_INFERENCE_SLICES(
+        "semantic_field_inference_slices",
+        "processors.ingest",
+        EventStatType.TIMESTAMPED_EVENT_COUNTER,
+        Version.V_3_6_0
+    ),
+    /** Counts failed predict requests of slices sent by the semantic field processor */
+    SEMANTIC_FIELD_INFERENCE_SLICE_FAILURES(
+        "semantic_field_inference_slice_failures",
+        "processors.ingest",
+        EventStatType.TIMESTAMPED_EVENT_COUNTER,
+        Version.V_3_6_0
+    ),
+    /** Sums the latency in milliseconds of the predict requests of slices sent by the semantic field processor */
+    SEMANTIC_FIELD_INFERENCE_SLICE_TIME_IN_MILLIS(
+        "semantic_field_inference_slice_time_in_millis",
+        "processors.ingest",
+        EventStatType.TIMESTAMPED_EVENT_COUNTER,
+        Version.V_3_6_0
     );
 
     private final String nameString;
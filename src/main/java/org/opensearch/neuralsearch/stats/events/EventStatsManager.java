@@ -43,6 +43,16 @@ public class EventStatsManager {
         instance().inc(eventStatName);
     }
 
+    /**
+     * Static helper to add a number of events to the counter for a specified event statistic on the singleton
+     *
+     * @param eventStatName The name of the event stat to add to
+     * @param count The number of events
+     */
+    public static void add(EventStatName eventStatName, long count) {
+        instance().addCount(eventStatName, count);
+    }
+
     /**
      * Initializes dependencies for the EventStats manager
      * @param settingsAccessor
@@ -62,6 +72,18 @@ public class EventStatsManager {
         }
     }
 
+    /**
+     *  Instance level method to add a number of events to the counter for a specified event statistic.
+     *
+     * @param eventStatName The name of the event stat to add to
+     * @param count The number of events
+     */
+    public void addCount(EventStatName eventStatName, long count) {
+        if (count > 0 && settingsAccessor.isStatsEnabled()) {
+            eventStatName.getEventStat().add(count);
+        }
+    }
+
     /**
      * Retrieves snapshots of specified event statistics.
      *
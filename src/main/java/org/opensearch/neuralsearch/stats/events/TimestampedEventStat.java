@@ -55,15 +55,23 @@ public class TimestampedEventStat implements EventStat {
      * Increments the counter
      */
     public void increment() {
-        totalCounter.increment();
+        add(1);
+    }
+
+    /**
+     * Adds a number of events to the counter at once
+     * @param count number of events, must not be negative
+     */
+    public void add(long count) {
+        totalCounter.add(count);
         lastEventTimestamp = getCurrentTimeInMillis();
-        incrementCurrentBucket();
+        addToCurrentBucket(count);
     }
 
     /**
-     * Helper to increment the current bucket based on system time
+     * Helper to add events to the current bucket based on system time
      */
-    private void incrementCurrentBucket() {
+    private void addToCurrentBucket(long count) {
         long now = getCurrentTimeInMillis();
 
         // Align current time to current minute
@@ -79,7 +87,7 @@ public class TimestampedEventStat implements EventStat {
         if (bucketTimestamp != currentBucketTime && bucket.timestamp.compareAndSet(bucketTimestamp, currentBucketTime)) {
             bucket.count.reset();
         }
-        bucket.count.add(1);
+        bucket.count.add(count);
     }
 
     /**
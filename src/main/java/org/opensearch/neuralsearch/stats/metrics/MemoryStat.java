@@ -4,6 +4,7 @@
  */
 package org.opensearch.neuralsearch.stats.metrics;
 
+import org.opensearch.neuralsearch.ml.IngestInferenceCache;
 import org.opensearch.neuralsearch.sparse.cache.ClusteredPostingCache;
 import org.opensearch.neuralsearch.sparse.cache.ForwardIndexCache;
 
@@ -39,6 +40,8 @@ public class MemoryStat implements MetricStat {
                 return ForwardIndexCache.getInstance().ramBytesUsed();
             case MetricStatName.MEMORY_SPARSE_CLUSTERED_POSTING_USAGE:
                 return ClusteredPostingCache.getInstance().ramBytesUsed();
+            case MetricStatName.MEMORY_INGEST_INFERENCE_CACHE_USAGE:
+                return IngestInferenceCache.getInstance().ramBytesUsed();
             default:
                 throw new IllegalArgumentException(String.format(Locale.ROOT, "Metric stat not found: %s", statName));
         }
@@ -23,7 +23,8 @@ public enum MetricStatName implements StatName {
     MEMORY_SPARSE_MEMORY_USAGE("sparse_memory_usage", "memory.sparse", MetricStatType.MEMORY, Version.V_3_3_0),
     MEMORY_SPARSE_MEMORY_USAGE_PERCENTAGE("sparse_memory_usage_percentage", "memory.sparse", MetricStatType.MEMORY, Version.V_3_3_0),
     MEMORY_SPARSE_FORWARD_INDEX_USAGE("forward_index_usage", "memory.sparse", MetricStatType.MEMORY, Version.V_3_3_0),
-    MEMORY_SPARSE_CLUSTERED_POSTING_USAGE("clustered_posting_usage", "memory.sparse", MetricStatType.MEMORY, Version.V_3_3_0);
+    MEMORY_SPARSE_CLUSTERED_POSTING_USAGE("clustered_posting_usage", "memory.sparse", MetricStatType.MEMORY, Version.V_3_3_0),
+    MEMORY_INGEST_INFERENCE_CACHE_USAGE("ingest_inference_cache_usage", "memory.ingest", MetricStatType.MEMORY, Version.V_3_6_0);
 
     private final String nameString;
     private final String path;
@@ -0,0 +1,29 @@
+/*
+ * Copyright OpenSearch Contributors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+package org.opensearch.neuralsearch.transport;
+
+import org.opensearch.action.ActionType;
+import org.opensearch.core.common.io.stream.Writeable;
+
+/**
+ * Action to drop the cached query embeddings of the inference result cache on nodes
+ */
+public class NeuralInferenceCacheClearAction extends ActionType<NeuralInferenceCacheClearResponse> {
+
+    public static final NeuralInferenceCacheClearAction INSTANCE = new NeuralInferenceCacheClearAction();
+    public static final String NAME = "cluster:admin/neural_inference_cache_clear_action";
+
+    /**
+     * Constructor
+     */
+    private NeuralInferenceCacheClearAction() {
+        super(NAME, NeuralInferenceCacheClearResponse::new);
+    }
+
+    @Override
+    public Writeable.Reader<NeuralInferenceCacheClearResponse> getResponseReader() {
+        return NeuralInferenceCacheClearResponse::new;
+    }
+}
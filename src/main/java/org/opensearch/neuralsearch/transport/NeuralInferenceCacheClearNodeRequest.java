@@ -0,0 +1,33 @@
+/*
+ * Copyright OpenSearch Contributors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+package org.opensearch.neuralsearch.transport;
+
+import org.opensearch.core.common.io.stream.StreamInput;
+import org.opensearch.transport.TransportRequest;
+
+import java.io.IOException;
+
+/**
+ *  NeuralInferenceCacheClearNodeRequest represents the request to an individual node
+ */
+public class NeuralInferenceCacheClearNodeRequest extends TransportRequest {
+
+    /**
+     * Constructor
+     */
+    public NeuralInferenceCacheClearNodeRequest() {
+        super();
+    }
+
+    /**
+     * Constructor
+     *
+     * @param in input stream
+     * @throws IOException in case of I/O errors
+     */
+    public NeuralInferenceCacheClearNodeRequest(StreamInput in) throws IOException {
+        super(in);
+    }
+}
@@ -0,0 +1,58 @@
+/*
+ * Copyright OpenSearch Contributors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+package org.opensearch.neuralsearch.transport;
+
+import lombok.Getter;
+import org.opensearch.action.support.nodes.BaseNodeResponse;
+import org.opensearch.cluster.node.DiscoveryNode;
+import org.opensearch.core.common.io.stream.StreamInput;
+import org.opensearch.core.common.io.stream.StreamOutput;
+import org.opensearch.core.xcontent.ToXContentFragment;
+import org.opensearch.core.xcontent.XContentBuilder;
+
+import java.io.IOException;
+
+/**
+ * NeuralInferenceCacheClearNodeResponse holds the number of cache entries an individual node dropped
+ */
+@Getter
+public class NeuralInferenceCacheClearNodeResponse extends BaseNodeResponse implements ToXContentFragment {
+    public static final String CLEARED_ENTRIES_FIELD = "cleared_entries";
+
+    private final long clearedEntries;
+
+    /**
+     * Constructor
+     *
+     * @param in stream
+     * @throws IOException in case of I/O errors
+     */
+    public NeuralInferenceCacheClearNodeResponse(StreamInput in) throws IOException {
+        super(in);
+        this.clearedEntries = in.readVLong();
+    }
+
+    /**
+     * Constructor
+     *
+     * @param node node
+     * @param clearedEntries number of dropped cache entries
+     */
+    public NeuralInferenceCacheClearNodeResponse(DiscoveryNode node, long clearedEntries) {
+        super(node);
+        this.clearedEntries = clearedEntries;
+    }
+
+    @Override
+    public void writeTo(StreamOutput out) throws IOException {
+        super.writeTo(out);
+        out.writeVLong(clearedEntries);
+    }
+
+    @Override
+    public XContentBuilder toXContent(XContentBuilder builder, Params params) throws IOException {
+        return builder.field(CLEARED_ENTRIES_FIELD, clearedEntries);
+    }
+}
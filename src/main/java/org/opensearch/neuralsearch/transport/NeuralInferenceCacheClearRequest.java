@@ -0,0 +1,35 @@
+/*
+ * Copyright OpenSearch Contributors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+package org.opensearch.neuralsearch.transport;
+
+import org.opensearch.action.support.nodes.BaseNodesRequest;
+import org.opensearch.core.common.io.stream.StreamInput;
+
+import java.io.IOException;
+
+/**
+ * NeuralInferenceCacheClearRequest drops the cached query embeddings on nodes
+ */
+public class NeuralInferenceCacheClearRequest extends BaseNodesRequest<NeuralInferenceCacheClearRequest> {
+
+    /**
+     * Constructor
+     *
+     * @param in input stream
+     * @throws IOException in case of I/O errors
+     */
+    public NeuralInferenceCacheClearRequest(StreamInput in) throws IOException {
+        super(in);
+    }
+
+    /**
+     * Constructor
+     *
+     * @param nodeIds NodeIDs on which to clear the cache, all nodes if empty
+     */
+    public NeuralInferenceCacheClearRequest(String... nodeIds) {
+        super(nodeIds);
+    }
+}
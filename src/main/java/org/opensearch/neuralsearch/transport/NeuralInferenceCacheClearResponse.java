@@ -0,0 +1,73 @@
+/*
+ * Copyright OpenSearch Contributors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+package org.opensearch.neuralsearch.transport;
+
+import org.opensearch.action.FailedNodeException;
+import org.opensearch.action.support.nodes.BaseNodesResponse;
+import org.opensearch.cluster.ClusterName;
+import org.opensearch.core.common.io.stream.StreamInput;
+import org.opensearch.core.common.io.stream.StreamOutput;
+import org.opensearch.core.xcontent.ToXContentObject;
+import org.opensearch.core.xcontent.XContentBuilder;
+
+import java.io.IOException;
+import java.util.List;
+
+/**
+ * NeuralInferenceCacheClearResponse consists of the number of cache entries every node dropped
+ */
+public class NeuralInferenceCacheClearResponse extends BaseNodesResponse<NeuralInferenceCacheClearNodeResponse>
+    implements
+        ToXContentObject {
+    public static final String NODES_FIELD = "nodes";
+
+    /**
+     * Constructor
+     *
+     * @param in StreamInput
+     * @throws IOException thrown when unable to read from stream
+     */
+    public NeuralInferenceCacheClearResponse(StreamInput in) throws IOException {
+        super(in);
+    }
+
+    /**
+     * Constructor
+     *
+     * @param clusterName name of cluster
+     * @param nodes successful node responses
+     * @param failures failed node responses
+     */
+    public NeuralInferenceCacheClearResponse(
+        ClusterName clusterName,
+        List<NeuralInferenceCacheClearNodeResponse> nodes,
+        List<FailedNodeException> failures
+    ) {
+        super(clusterName, nodes, failures);
+    }
+
+    @Override
+    public List<NeuralInferenceCacheClearNodeResponse> readNodesFrom(StreamInput in) throws IOException {
+        return in.readList(NeuralInferenceCacheClearNodeResponse::new);
+    }
+
+    @Override
+    public void writeNodesTo(StreamOutput out, List<NeuralInferenceCacheClearNodeResponse> nodes) throws IOException {
+        out.writeList(nodes);
+    }
+
+    @Override
+    public XContentBuilder toXContent(XContentBuilder builder, Params params) throws IOException {
+        builder.startObject();
+        builder.startObject(NODES_FIELD);
+        for (NeuralInferenceCacheClearNodeResponse nodeResponse : getNodes()) {
+            builder.startObject(nodeResponse.getNode().getId());
+            nodeResponse.toXContent(builder, params);
+            builder.endObject();
+        }
+        builder.endObject();
+        return builder.endObject();
+    }
+}
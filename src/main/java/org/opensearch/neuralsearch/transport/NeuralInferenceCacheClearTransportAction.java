@@ -0,0 +1,83 @@
+/*
+ * Copyright OpenSearch Contributors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+package org.opensearch.neuralsearch.transport;
+
+import org.opensearch.action.FailedNodeException;
+import org.opensearch.action.support.ActionFilters;
+import org.opensearch.action.support.nodes.TransportNodesAction;
+import org.opensearch.cluster.service.ClusterService;
+import org.opensearch.common.inject.Inject;
+import org.opensearch.core.common.io.stream.StreamInput;
+import org.opensearch.neuralsearch.ml.InferenceResultCache;
+import org.opensearch.neuralsearch.ml.IngestInferenceCache;
+import org.opensearch.threadpool.ThreadPool;
+import org.opensearch.transport.TransportService;
+
+import java.io.IOException;
+import java.util.List;
+
+/**
+ *  NeuralInferenceCacheClearTransportAction drops the cached query embeddings of the inference result cache and the cached
+ *  embeddings of the ingest inference cache on the nodes
+ */
+public class NeuralInferenceCacheClearTransportAction extends TransportNodesAction<
+    NeuralInferenceCacheClearRequest,
+    NeuralInferenceCacheClearResponse,
+    NeuralInferenceCacheClearNodeRequest,
+    NeuralInferenceCacheClearNodeResponse> {
+
+    /**
+     * Constructor
+     *
+     * @param threadPool ThreadPool to use
+     * @param clusterService ClusterService
+     * @param transportService TransportService
+     * @param actionFilters Action Filters
+     */
+    @Inject
+    public NeuralInferenceCacheClearTransportAction(
+        ThreadPool threadPool,
+        ClusterService clusterService,
+        TransportService transportService,
+        ActionFilters actionFilters
+    ) {
+        super(
+            NeuralInferenceCacheClearAction.NAME,
+            threadPool,
+            clusterService,
+            transportService,
+            actionFilters,
+            NeuralInferenceCacheClearRequest::new,
+            NeuralInferenceCacheClearNodeRequest::new,
+            ThreadPool.Names.MANAGEMENT,
+            NeuralInferenceCacheClearNodeResponse.class
+        );
+    }
+
+    @Override
+    protected NeuralInferenceCacheClearResponse newResponse(
+        NeuralInferenceCacheClearRequest request,
+        List<NeuralInferenceCacheClearNodeResponse> responses,
+        List<FailedNodeException> failures
+    ) {
+        return new NeuralInferenceCacheClearResponse(clusterService.getClusterName(), responses, failures);
+    }
+
+    @Override
+    protected NeuralInferenceCacheClearNodeRequest newNodeRequest(NeuralInferenceCacheClearRequest request) {
+        return new NeuralInferenceCacheClearNodeRequest();
+    }
+
+    @Override
+    protected NeuralInferenceCacheClearNodeResponse newNodeResponse(StreamInput in) throws IOException {
+        return new NeuralInferenceCacheClearNodeResponse(in);
+    }
+
+    @Override
+    protected NeuralInferenceCacheClearNodeResponse nodeOperation(NeuralInferenceCacheClearNodeRequest request) {
+        long clearedEntries = InferenceResultCache.getInstance().clear() + IngestInferenceCache.getInstance().clear();
+        return new NeuralInferenceCacheClearNodeResponse(clusterService.localNode(), clearedEntries);
+    }
+}
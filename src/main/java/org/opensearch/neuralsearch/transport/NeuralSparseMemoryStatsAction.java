@@ -0,0 +1,29 @@
+/*
+ * Copyright OpenSearch Contributors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+package org.opensearch.neuralsearch.transport;
+
+import org.opensearch.action.ActionType;
+import org.opensearch.core.common.io.stream.Writeable;
+
+/**
+ * Action to retrieve per-index SEISMIC cache memory usage and budgets from nodes
+ */
+public class NeuralSparseMemoryStatsAction extends ActionType<NeuralSparseMemoryStatsResponse> {
+
+    public static final NeuralSparseMemoryStatsAction INSTANCE = new NeuralSparseMemoryStatsAction();
+    public static final String NAME = "cluster:admin/neural_sparse_memory_stats_action";
+
+    /**
+     * Constructor
+     */
+    private NeuralSparseMemoryStatsAction() {
+        super(NAME, NeuralSparseMemoryStatsResponse::new);
+    }
+
+    @Override
+    public Writeable.Reader<NeuralSparseMemoryStatsResponse> getResponseReader() {
+        return NeuralSparseMemoryStatsResponse::new;
+    }
+}
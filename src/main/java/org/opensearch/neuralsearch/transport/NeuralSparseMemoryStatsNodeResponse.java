@@ -0,0 +1,66 @@
+/*
+ * Copyright OpenSearch Contributors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+package org.opensearch.neuralsearch.transport;
+
+import lombok.Getter;
+import org.opensearch.action.support.nodes.BaseNodeResponse;
+import org.opensearch.cluster.node.DiscoveryNode;
+import org.opensearch.core.common.io.stream.StreamInput;
+import org.opensearch.core.common.io.stream.StreamOutput;
+import org.opensearch.core.xcontent.ToXContentFragment;
+import org.opensearch.core.xcontent.XContentBuilder;
+import org.opensearch.neuralsearch.sparse.cache.IndexMemoryBudgetStats;
+
+import java.io.IOException;
+import java.util.Map;
+import java.util.TreeMap;
+
+/**
+ * NeuralSparseMemoryStatsNodeResponse holds the per-index SEISMIC cache memory stats of an individual node
+ */
+@Getter
+public class NeuralSparseMemoryStatsNodeResponse extends BaseNodeResponse implements ToXContentFragment {
+    public static final String INDICES_FIELD = "indices";
+
+    private final Map<String, IndexMemoryBudgetStats> indexStats;
+
+    /**
+     * Constructor
+     *
+     * @param in stream
+     * @throws IOException in case of I/O errors
+     */
+    public NeuralSparseMemoryStatsNodeResponse(StreamInput in) throws IOException {
+        super(in);
+        this.indexStats = in.readMap(StreamInput::readString, IndexMemoryBudgetStats::new);
+    }
+
+    /**
+     * Constructor
+     *
+     * @param node node
+     * @param indexStats mapping of index name to its memory stats
+     */
+    public NeuralSparseMemoryStatsNodeResponse(DiscoveryNode node, Map<String, IndexMemoryBudgetStats> indexStats) {
+        super(node);
+        this.indexStats = indexStats;
+    }
+
+    @Override
+    public void writeTo(StreamOutput out) throws IOException {
+        super.writeTo(out);
+        out.writeMap(indexStats, StreamOutput::writeString, (output, stats) -> stats.writeTo(output));
+    }
+
+    @Override
+    public XContentBuilder toXContent(XContentBuilder builder, Params params) throws IOException {
+        builder.startObject(INDICES_FIELD);
+        for (Map.Entry<String, IndexMemoryBudgetStats> entry : new TreeMap<>(indexStats).entrySet()) {
+            builder.field(entry.getKey());
+            entry.getValue().toXContent(builder, params);
+        }
+        return builder.endObject();
+    }
+}
@@ -0,0 +1,35 @@
+/*
+ * Copyright OpenSearch Contributors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+package org.opensearch.neuralsearch.transport;
+
+import org.opensearch.action.support.nodes.BaseNodesRequest;
+import org.opensearch.core.common.io.stream.StreamInput;
+
+import java.io.IOException;
+
+/**
+ * NeuralSparseMemoryStatsRequest gets per-index SEISMIC cache memory stats from nodes
+ */
+public class NeuralSparseMemoryStatsRequest extends BaseNodesRequest<NeuralSparseMemoryStatsRequest> {
+
+    /**
+     * Constructor
+     *
+     * @param in input stream
+     * @throws IOException in case of I/O errors
+     */
+    public NeuralSparseMemoryStatsRequest(StreamInput in) throws IOException {
+        super(in);
+    }
+
+    /**
+     * Constructor
+     *
+     * @param nodeIds NodeIDs from which to retrieve stats, all nodes if empty
+     */
+    public NeuralSparseMemoryStatsRequest(String... nodeIds) {
+        super(nodeIds);
+    }
+}
@@ -0,0 +1,80 @@
+/*
+ * Copyright OpenSearch Contributors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+package org.opensearch.neuralsearch.transport;
+
+import org.opensearch.action.FailedNodeException;
+import org.opensearch.action.support.ActionFilters;
+import org.opensearch.action.support.nodes.TransportNodesAction;
+import org.opensearch.cluster.service.ClusterService;
+import org.opensearch.common.inject.Inject;
+import org.opensearch.core.common.io.stream.StreamInput;
+import org.opensearch.neuralsearch.sparse.cache.SparseMemoryBudgetManager;
+import org.opensearch.threadpool.ThreadPool;
+import org.opensearch.transport.TransportService;
+
+import java.io.IOException;
+import java.util.List;
+
+/**
+ *  NeuralSparseMemoryStatsTransportAction collects per-index SEISMIC cache memory usage and budgets from the nodes
+ */
+public class NeuralSparseMemoryStatsTransportAction extends TransportNodesAction<
+    NeuralSparseMemoryStatsRequest,
+    NeuralSparseMemoryStatsResponse,
+    NeuralSparseMemoryStatsNodeRequest,
+    NeuralSparseMemoryStatsNodeResponse> {
+
+    /**
+     * Constructor
+     *
+     * @param threadPool ThreadPool to use
+     * @param clusterService ClusterService
+     * @param transportService TransportService
+     * @param actionFilters Action Filters
+     */
+    @Inject
+    public NeuralSparseMemoryStatsTransportAction(
+        ThreadPool threadPool,
+        ClusterService clusterService,
+        TransportService transportService,
+        ActionFilters actionFilters
+    ) {
+        super(
+            NeuralSparseMemoryStatsAction.NAME,
+            threadPool,
+            clusterService,
+            transportService,
+            actionFilters,
+            NeuralSparseMemoryStatsRequest::new,
+            NeuralSparseMemoryStatsNodeRequest::new,
+            ThreadPool.Names.MANAGEMENT,
+            NeuralSparseMemoryStatsNodeResponse.class
+        );
+    }
+
+    @Override
+    protected NeuralSparseMemoryStatsResponse newResponse(
+        NeuralSparseMemoryStatsRequest request,
+        List<NeuralSparseMemoryStatsNodeResponse> responses,
+        List<FailedNodeException> failures
+    ) {
+        return new NeuralSparseMemoryStatsResponse(clusterService.getClusterName(), responses, failures);
+    }
+
+    @Override
+    protected NeuralSparseMemoryStatsNodeRequest newNodeRequest(NeuralSparseMemoryStatsRequest request) {
+        return new NeuralSparseMemoryStatsNodeRequest();
+    }
+
+    @Override
+    protected NeuralSparseMemoryStatsNodeResponse newNodeResponse(StreamInput in) throws IOException {
+        return new NeuralSparseMemoryStatsNodeResponse(in);
+    }
+
+    @Override
+    protected NeuralSparseMemoryStatsNodeResponse nodeOperation(NeuralSparseMemoryStatsNodeRequest request) {
+        return new NeuralSparseMemoryStatsNodeResponse(clusterService.localNode(), SparseMemoryBudgetManager.getInstance().getStats());
+    }
+}
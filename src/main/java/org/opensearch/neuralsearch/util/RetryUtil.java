@@ -5,16 +5,30 @@
 package org.opensearch.neuralsearch.util;
 
 import java.util.List;
+import java.util.concurrent.atomic.AtomicInteger;
 
+import com.google.common.annotations.VisibleForTesting;
+import lombok.NonNull;
 import lombok.extern.log4j.Log4j2;
 import org.apache.commons.lang3.exception.ExceptionUtils;
+import org.opensearch.common.unit.TimeValue;
 import org.opensearch.core.action.ActionListener;
+import org.opensearch.neuralsearch.stats.events.EventStatName;
+import org.opensearch.neuralsearch.stats.events.EventStatsManager;
+import org.opensearch.threadpool.ThreadPool;
 import org.opensearch.transport.NodeDisconnectedException;
 import org.opensearch.transport.NodeNotConnectedException;
 
 import com.google.common.collect.ImmutableList;
 import org.opensearch.common.Randomness;
 
+/**
+ * Retries ML Commons calls that failed because the ML node could not be reached.
+ * Retries are scheduled on the thread pool with jittered exponential backoff, so the thread that delivered the failure,
+ * typically a transport or search thread, is never blocked. The number of retries waiting at the same time on a node is
+ * bounded by a retry budget, so a disconnected ML node does not pile up retries for every in-flight request. Before the
+ * thread pool is initialized, failures are not retried.
+ */
 @Log4j2
 public class RetryUtil {
 
@@ -25,6 +39,28 @@ public class RetryUtil {
         NodeDisconnectedException.class
     );
 
+    private static final AtomicInteger pendingRetries = new AtomicInteger();
+    private static volatile ThreadPool threadPool;
+    private static volatile int retryBudget = Integer.MAX_VALUE;
+
+    /**
+     * Initializes the thread pool retries are scheduled on and the retry budget of this node
+     * @param threadPool ThreadPool of the node
+     * @param retryBudget maximum number of retries waiting at the same time
+     */
+    public static void initialize(@NonNull ThreadPool threadPool, int retryBudget) {
+        RetryUtil.threadPool = threadPool;
+        RetryUtil.retryBudget = retryBudget;
+    }
+
+    /**
+     * Updates the retry budget of this node
+     * @param retryBudget maximum number of retries waiting at the same time, zero disables retries
+     */
+    public static void setRetryBudget(int retryBudget) {
+        RetryUtil.retryBudget = retryBudget;
+    }
+
     /**
      * Handle retry or failure based on the exception and retry time
      * @param e Exception
@@ -33,33 +69,80 @@ public class RetryUtil {
      * @param listener Listener to handle success or failure
      */
     public static void handleRetryOrFailure(Exception e, int retryTime, Runnable retryAction, ActionListener<?> listener) {
-        if (shouldRetry(e, retryTime)) {
-            long backoffTime = calculateBackoffTime(retryTime);
-            log.warn("Retrying connection for ML inference due to [{}] after [{}ms]", e.getMessage(), backoffTime, e);
+        if (!isRetryableException(e)) {
+            listener.onFailure(e);
+            return;
+        }
+        ThreadPool currentThreadPool = threadPool;
+        // without a thread pool there is nothing to wait for the backoff on but the thread that delivered the failure
+        if (currentThreadPool == null || retryTime >= DEFAULT_MAX_RETRY || !tryAcquireRetry()) {
+            log.warn("Giving up retrying ML inference due to [{}] after [{}] retries", e.getMessage(), retryTime);
+            EventStatsManager.increment(EventStatName.ML_INFERENCE_RETRY_GIVE_UPS);
+            listener.onFailure(e);
+            return;
+        }
+        EventStatsManager.increment(EventStatName.ML_INFERENCE_RETRIES);
+        long backoffTime = calculateBackoffTime(retryTime);
+        log.warn("Retrying connection for ML inference due to [{}] after [{}ms]", e.getMessage(), backoffTime, e);
+        Runnable retry = () -> {
+            pendingRetries.decrementAndGet();
             try {
-                Thread.sleep(backoffTime);
-            } catch (InterruptedException interruptedException) {
-                Thread.currentThread().interrupt();
-                listener.onFailure(interruptedException);
-                return;
+                retryAction.run();
+            } catch (Exception retryException) {
+                listener.onFailure(retryException);
             }
-            retryAction.run();
-        } else {
+        };
+        try {
+            currentThreadPool.schedule(retry, TimeValue.timeValueMillis(backoffTime), ThreadPool.Names.GENERIC);
+        } catch (Exception scheduleException) {
+            pendingRetries.decrementAndGet();
+            log.warn("Failed to schedule retry of ML inference", scheduleException);
             listener.onFailure(e);
         }
     }
 
-    private static boolean shouldRetry(final Exception e, int retryTime) {
-        return isRetryableException(e) && retryTime < DEFAULT_MAX_RETRY;
+    /**
+     * Drops the thread pool and the retry budget, so failures are not retried until initialized again
+     */
+    @VisibleForTesting
+    static void reset() {
+        threadPool = null;
+        retryBudget = Integer.MAX_VALUE;
+        pendingRetries.set(0);
+    }
+
+    /**
+     * @return number of retries currently waiting for their backoff
+     */
+    @VisibleForTesting
+    static int getPendingRetries() {
+        return pendingRetries.get();
+    }
+
+    private static boolean tryAcquireRetry() {
+        while (true) {
+            int pending = pendingRetries.get();
+            if (pending >= retryBudget) {
+                return false;
+            }
+            if (pendingRetries.compareAndSet(pending, pending + 1)) {
+                return true;
+            }
+        }
     }
 
     private static boolean isRetryableException(final Exception e) {
         return RETRYABLE_EXCEPTIONS.stream().anyMatch(x -> ExceptionUtils.indexOfThrowable(e, x) != -1);
     }
 
-    private static long calculateBackoffTime(int retryTime) {
+    /**
+     * Exponential backoff with equal jitter: half of the delay is fixed and half is random,
+     * so retries of requests that failed together do not hit the ML node at the same time again.
+     */
+    @VisibleForTesting
+    static long calculateBackoffTime(int retryTime) {
         long backoffTime = DEFAULT_BASE_DELAY_MS * (1L << retryTime); // Exponential backoff
-        long jitter = Randomness.get().nextLong(10, 50); // Add jitter between 10ms and 50ms
-        return backoffTime + jitter;
+        long halfBackoffTime = backoffTime / 2;
+        return halfBackoffTime + Randomness.get().nextLong(0, halfBackoffTime + 1);
     }
 }
@@ -0,0 +1,56 @@
+/*
+ * Copyright OpenSearch Contributors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+package org.opensearch.neuralsearch.common;
+
+import java.util.List;
+
+import org.opensearch.test.OpenSearchTestCase;
+
+public class FloatArrayListTests extends OpenSearchTestCase {
+
+    public void testFromNumbers() {
+        assertEquals(List.of(1.5f, 2.0f, 3.0f), FloatArrayList.fromNumbers(new Number[] { 1.5f, 2.0d, 3 }));
+        assertEquals(List.of(1.5f, 2.0f), FloatArrayList.fromNumbers(List.of(1.5d, 2L)));
+        assertTrue(FloatArrayList.fromNumbers(new Number[0]).isEmpty());
+    }
+
+    public void testGetFloat() {
+        FloatArrayList list = new FloatArrayList(new float[] { 1.0f, 2.0f });
+
+        assertEquals(2.0f, list.getFloat(1), 0.0f);
+        expectThrows(IndexOutOfBoundsException.class, () -> list.getFloat(2));
+    }
+
+    public void testToFloatArray_thenCopy() {
+        float[] values = new float[] { 1.0f, 2.0f };
+        FloatArrayList list = new FloatArrayList(values);
+
+        float[] copy = list.toFloatArray();
+        copy[0] = 5.0f;
+
+        assertEquals(1.0f, list.getFloat(0), 0.0f);
+    }
+
+    public void testModification() {
+        FloatArrayList list = new FloatArrayList(new float[] { 1.0f, 2.0f });
+
+        assertEquals(Float.valueOf(2.0f), list.set(1, 3.0f));
+        list.add(4.0f);
+        list.add(0, 0.5f);
+        assertEquals(List.of(0.5f, 1.0f, 3.0f, 4.0f), list);
+
+        assertEquals(Float.valueOf(1.0f), list.remove(1));
+        assertEquals(List.of(0.5f, 3.0f, 4.0f), list);
+        assertArrayEquals(new float[] { 0.5f, 3.0f, 4.0f }, list.toFloatArray(), 0.0f);
+    }
+
+    public void testEqualsAndHashCode() {
+        FloatArrayList list = new FloatArrayList(new float[] { 1.0f, 2.0f });
+
+        assertEquals(List.of(1.0f, 2.0f), list);
+        assertEquals(List.of(1.0f, 2.0f).hashCode(), list.hashCode());
+        assertNotEquals(List.of(1.0f), list);
+    }
+}
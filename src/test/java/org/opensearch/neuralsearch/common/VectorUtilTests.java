@@ -25,4 +25,15 @@ public class VectorUtilTests extends OpenSearchTestCase {
         assertEquals(0, vectorAsArray_withNoElements.length);
     }
 
+    @SuppressWarnings("unchecked")
+    public void testVectorAsListToArray_whenFloatArrayList_thenCopy() {
+        float[] values = new float[] { 1.3f, 2.5f, 3.5f };
+        List<Number> vectorAsList = (List<Number>) (List<?>) new FloatArrayList(values);
+
+        float[] vectorAsArray = VectorUtil.vectorAsListToArray(vectorAsList);
+
+        assertArrayEquals(values, vectorAsArray, 0.0f);
+        assertNotSame(values, vectorAsArray);
+    }
+
 }
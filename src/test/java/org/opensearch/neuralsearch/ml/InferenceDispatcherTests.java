@@ -0,0 +1,248 @@
+/*
+ * Copyright OpenSearch Contributors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+package org.opensearch.neuralsearch.ml;
+
+import org.junit.Before;
+import org.opensearch.OpenSearchStatusException;
+import org.opensearch.common.settings.Settings;
+import org.opensearch.common.util.concurrent.AbstractRunnable;
+import org.opensearch.common.util.concurrent.ThreadContext;
+import org.opensearch.core.action.ActionListener;
+import org.opensearch.core.concurrency.OpenSearchRejectedExecutionException;
+import org.opensearch.core.rest.RestStatus;
+import org.opensearch.neuralsearch.stats.events.EventStatName;
+import org.opensearch.neuralsearch.util.TestUtils;
+import org.opensearch.test.OpenSearchTestCase;
+import org.opensearch.threadpool.ThreadPool;
+
+import java.util.ArrayList;
+import java.util.List;
+import java.util.concurrent.ExecutorService;
+import java.util.concurrent.atomic.AtomicLong;
+import java.util.function.Consumer;
+
+import static org.mockito.ArgumentMatchers.any;
+import static org.mockito.Mockito.doAnswer;
+import static org.mockito.Mockito.mock;
+import static org.mockito.Mockito.never;
+import static org.mockito.Mockito.verify;
+import static org.mockito.Mockito.when;
+
+public class InferenceDispatcherTests extends OpenSearchTestCase {
+    private static final String MODEL_ID = "model_id";
+
+    private AtomicLong nanoTime;
+    private List<ActionListener<String>> pendingCalls;
+    private Consumer<ActionListener<String>> call;
+
+    @Before
+    public void setup() {
+        TestUtils.initializeEventStatsManager();
+        nanoTime = new AtomicLong();
+        pendingCalls = new ArrayList<>();
+        call = pendingCalls::add;
+    }
+
+    public void testDispatch_whenDisabled_thenCallsDirectly() {
+        InferenceDispatcher dispatcher = new InferenceDispatcher(0, 0, false, nanoTime::get);
+
+        for (int i = 0; i < 5; i++) {
+            dispatcher.dispatch(MODEL_ID, mock(ActionListener.class), call);
+        }
+
+        assertEquals(5, pendingCalls.size());
+    }
+
+    public void testDispatch_whenLimitReached_thenQueuedUntilSlotFreed() {
+        InferenceDispatcher dispatcher = new InferenceDispatcher(2, 10, false, nanoTime::get);
+        ActionListener<String> first = mock(ActionListener.class);
+        ActionListener<String> third = mock(ActionListener.class);
+        long queuedBefore = EventStatName.INFERENCE_DISPATCHER_QUEUED_REQUESTS.getEventStat().getValue();
+
+        dispatcher.dispatch(MODEL_ID, first, call);
+        dispatcher.dispatch(MODEL_ID, mock(ActionListener.class), call);
+        dispatcher.dispatch(MODEL_ID, third, call);
+        assertEquals(2, pendingCalls.size());
+        assertEquals(1, EventStatName.INFERENCE_DISPATCHER_QUEUED_REQUESTS.getEventStat().getValue() - queuedBefore);
+
+        pendingCalls.get(0).onResponse("first");
+        verify(first).onResponse("first");
+        assertEquals(3, pendingCalls.size());
+
+        pendingCalls.get(2).onResponse("third");
+        verify(third).onResponse("third");
+    }
+
+    public void testDispatch_whenQueueFull_thenRejected() {
+        InferenceDispatcher dispatcher = new InferenceDispatcher(1, 1, false, nanoTime::get);
+        ActionListener<String> rejected = mock(ActionListener.class);
+        long rejectionsBefore = EventStatName.INFERENCE_DISPATCHER_REJECTIONS.getEventStat().getValue();
+
+        dispatcher.dispatch(MODEL_ID, mock(ActionListener.class), call);
+        dispatcher.dispatch(MODEL_ID, mock(ActionListener.class), call);
+        dispatcher.dispatch(MODEL_ID, rejected, call);
+
+        verify(rejected).onFailure(any(OpenSearchRejectedExecutionException.class));
+        verify(rejected, never()).onResponse(any());
+        assertEquals(1, pendingCalls.size());
+        assertEquals(1, EventStatName.INFERENCE_DISPATCHER_REJECTIONS.getEventStat().getValue() - rejectionsBefore);
+    }
+
+    public void testDispatch_whenModelsDiffer_thenLimitedSeparately() {
+        InferenceDispatcher dispatcher = new InferenceDispatcher(1, 10, false, nanoTime::get);
+
+        dispatcher.dispatch(MODEL_ID, mock(ActionListener.class), call);
+        dispatcher.dispatch("other_model_id", mock(ActionListener.class), call);
+
+        assertEquals(2, pendingCalls.size());
+    }
+
+    public void testDispatch_whenCallThrows_thenSlotFreed() {
+        InferenceDispatcher dispatcher = new InferenceDispatcher(1, 10, false, nanoTime::get);
+        ActionListener<String> failing = mock(ActionListener.class);
+        RuntimeException exception = new RuntimeException("predict failed");
+
+        dispatcher.dispatch(MODEL_ID, failing, listener -> { throw exception; });
+        dispatcher.dispatch(MODEL_ID, mock(ActionListener.class), call);
+
+        verify(failing).onFailure(exception);
+        assertEquals(1, pendingCalls.size());
+    }
+
+    public void testDispatch_whenThrottled_thenLimitHalvedAndRecovers() {
+        InferenceDispatcher dispatcher = new InferenceDispatcher(8, 10, true, nanoTime::get);
+        long decreasesBefore = EventStatName.INFERENCE_DISPATCHER_LIMIT_DECREASES.getEventStat().getValue();
+
+        dispatcher.dispatch(MODEL_ID, mock(ActionListener.class), call);
+        nanoTime.addAndGet(100);
+        pendingCalls.get(0).onFailure(new OpenSearchStatusException("throttled", RestStatus.TOO_MANY_REQUESTS));
+        assertEquals(4, dispatcher.currentLimit(MODEL_ID));
+        assertEquals(1, EventStatName.INFERENCE_DISPATCHER_LIMIT_DECREASES.getEventStat().getValue() - decreasesBefore);
+
+        for (int i = 1; i < 100; i++) {
+            dispatcher.dispatch(MODEL_ID, mock(ActionListener.class), call);
+            nanoTime.addAndGet(100);
+            pendingCalls.get(i).onResponse("result");
+        }
+        assertEquals(8, dispatcher.currentLimit(MODEL_ID));
+    }
+
+    public void testDispatch_whenCallsInFlightDuringDecreaseThrottled_thenLimitHalvedOnce() {
+        InferenceDispatcher dispatcher = new InferenceDispatcher(8, 10, true, nanoTime::get);
+        for (int i = 0; i < 3; i++) {
+            dispatcher.dispatch(MODEL_ID, mock(ActionListener.class), call);
+        }
+        nanoTime.addAndGet(100);
+
+        for (int i = 0; i < 3; i++) {
+            pendingCalls.get(i).onFailure(new OpenSearchStatusException("throttled", RestStatus.TOO_MANY_REQUESTS));
+        }
+        assertEquals(4, dispatcher.currentLimit(MODEL_ID));
+
+        nanoTime.addAndGet(100);
+        dispatcher.dispatch(MODEL_ID, mock(ActionListener.class), call);
+        pendingCalls.get(3).onFailure(new OpenSearchStatusException("throttled", RestStatus.TOO_MANY_REQUESTS));
+        assertEquals(2, dispatcher.currentLimit(MODEL_ID));
+    }
+
+    public void testDispatch_whenCallLatenciesVary_thenLimitNotDecreased() {
+        InferenceDispatcher dispatcher = new InferenceDispatcher(8, 10, true, nanoTime::get);
+
+        for (int i = 0; i < 20; i++) {
+            dispatcher.dispatch(MODEL_ID, mock(ActionListener.class), call);
+            // single text calls alternate with large batches that take much longer
+            nanoTime.addAndGet(i % 2 == 0 ? 10 : 10_000);
+            pendingCalls.get(i).onResponse("result");
+        }
+
+        assertEquals(8, dispatcher.currentLimit(MODEL_ID));
+    }
+
+    public void testDispatch_whenNotAdaptive_thenLimitFixed() {
+        InferenceDispatcher dispatcher = new InferenceDispatcher(8, 10, false, nanoTime::get);
+
+        dispatcher.dispatch(MODEL_ID, mock(ActionListener.class), call);
+        pendingCalls.get(0).onFailure(new OpenSearchStatusException("throttled", RestStatus.TOO_MANY_REQUESTS));
+
+        assertEquals(8, dispatcher.currentLimit(MODEL_ID));
+    }
+
+    public void testSetMaxInFlight_whenDisabled_thenQueuedCallsStarted() {
+        InferenceDispatcher dispatcher = new InferenceDispatcher(1, 10, false, nanoTime::get);
+
+        dispatcher.dispatch(MODEL_ID, mock(ActionListener.class), call);
+        dispatcher.dispatch(MODEL_ID, mock(ActionListener.class), call);
+        assertEquals(1, pendingCalls.size());
+
+        dispatcher.setMaxInFlight(0);
+        assertEquals(2, pendingCalls.size());
+    }
+
+    public void testDispatch_whenQueuedCallStarted_thenForkedInSubmitterContext() {
+        ThreadContext threadContext = new ThreadContext(Settings.EMPTY);
+        List<Runnable> forkedCalls = new ArrayList<>();
+        InferenceDispatcher dispatcher = new InferenceDispatcher(1, 10, false, nanoTime::get);
+        dispatcher.initialize(mockThreadPool(threadContext, forkedCalls::add));
+        List<String> callUsers = new ArrayList<>();
+        Consumer<ActionListener<String>> recordingCall = listener -> {
+            callUsers.add(threadContext.getHeader("user"));
+            pendingCalls.add(listener);
+        };
+
+        try (ThreadContext.StoredContext ignored = threadContext.stashContext()) {
+            threadContext.putHeader("user", "first");
+            dispatcher.dispatch(MODEL_ID, mock(ActionListener.class), recordingCall);
+        }
+        try (ThreadContext.StoredContext ignored = threadContext.stashContext()) {
+            threadContext.putHeader("user", "second");
+            dispatcher.dispatch(MODEL_ID, mock(ActionListener.class), recordingCall);
+        }
+        try (ThreadContext.StoredContext ignored = threadContext.stashContext()) {
+            threadContext.putHeader("user", "responder");
+            pendingCalls.get(0).onResponse("first");
+        }
+        assertEquals(1, pendingCalls.size());
+        assertEquals(1, forkedCalls.size());
+
+        forkedCalls.get(0).run();
+
+        assertEquals(List.of("first", "second"), callUsers);
+        assertNull(threadContext.getHeader("user"));
+    }
+
+    public void testDispatch_whenForkRejected_thenQueuedCallFailedAndSlotFreed() {
+        ThreadContext threadContext = new ThreadContext(Settings.EMPTY);
+        InferenceDispatcher dispatcher = new InferenceDispatcher(1, 10, false, nanoTime::get);
+        dispatcher.initialize(mockThreadPool(threadContext, task -> {
+            throw new OpenSearchRejectedExecutionException("shutting down");
+        }));
+        ActionListener<String> queued = mock(ActionListener.class);
+
+        dispatcher.dispatch(MODEL_ID, mock(ActionListener.class), call);
+        dispatcher.dispatch(MODEL_ID, queued, call);
+        pendingCalls.get(0).onResponse("first");
+
+        verify(queued).onFailure(any(OpenSearchRejectedExecutionException.class));
+        dispatcher.dispatch(MODEL_ID, mock(ActionListener.class), call);
+        assertEquals(2, pendingCalls.size());
+    }
+
+    private ThreadPool mockThreadPool(ThreadContext threadContext, Consumer<AbstractRunnable> executor) {
+        ExecutorService genericExecutor = mock(ExecutorService.class);
+        doAnswer(invocation -> {
+            AbstractRunnable task = invocation.getArgument(0);
+            try {
+                executor.accept(task);
+            } catch (OpenSearchRejectedExecutionException e) {
+                task.onRejection(e);
+            }
+            return null;
+        }).when(genericExecutor).execute(any(Runnable.class));
+        ThreadPool threadPool = mock(ThreadPool.class);
+        when(threadPool.getThreadContext()).thenReturn(threadContext);
+        when(threadPool.executor(ThreadPool.Names.GENERIC)).thenReturn(genericExecutor);
+        return threadPool;
+    }
+}
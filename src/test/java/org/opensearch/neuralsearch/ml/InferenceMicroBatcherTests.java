@@ -0,0 +1,190 @@
+/*
+ * Copyright OpenSearch Contributors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+package org.opensearch.neuralsearch.ml;
+
+import org.junit.Before;
+import org.opensearch.common.settings.Settings;
+import org.opensearch.core.action.ActionListener;
+import org.opensearch.neuralsearch.settings.NeuralSearchSettings;
+import org.opensearch.neuralsearch.stats.events.EventStatName;
+import org.opensearch.neuralsearch.util.TestUtils;
+import org.opensearch.test.OpenSearchTestCase;
+
+import java.util.ArrayList;
+import java.util.List;
+import java.util.concurrent.atomic.AtomicReference;
+import java.util.function.BiConsumer;
+
+public class InferenceMicroBatcherTests extends OpenSearchTestCase {
+    private List<List<String>> requests;
+    private List<ActionListener<List<?>>> pendingInferences;
+    private BiConsumer<List<String>, ActionListener<List<?>>> inference;
+    private AtomicReference<List<?>> response;
+    private AtomicReference<Exception> failure;
+
+    @Before
+    public void setup() {
+        TestUtils.initializeEventStatsManager();
+        requests = new ArrayList<>();
+        pendingInferences = new ArrayList<>();
+        inference = (texts, listener) -> {
+            requests.add(texts);
+            pendingInferences.add(listener);
+        };
+        response = new AtomicReference<>();
+        failure = new AtomicReference<>();
+    }
+
+    public void testSplit_whenUnbounded_thenSingleBatch() {
+        InferenceMicroBatcher microBatcher = new InferenceMicroBatcher(0, 0, 0);
+        List<String> texts = List.of("a", "bb", "ccc");
+
+        assertEquals(List.of(texts), microBatcher.split(texts));
+    }
+
+    public void testSplit_whenMaxTexts_thenBoundedBatches() {
+        InferenceMicroBatcher microBatcher = new InferenceMicroBatcher(0, 2, 0);
+
+        assertEquals(List.of(List.of("a", "b"), List.of("c", "d"), List.of("e")), microBatcher.split(List.of("a", "b", "c", "d", "e")));
+    }
+
+    public void testSplit_whenTokenBudget_thenBoundedByPaddedSize() {
+        // texts of 1, 1, 1, 2 and 2 approximate tokens, a budget of 4 padded tokens
+        InferenceMicroBatcher microBatcher = new InferenceMicroBatcher(4, 0, 0);
+
+        assertEquals(
+            List.of(List.of("a", "b", "cc"), List.of("dddddd", "eeeeeeee")),
+            microBatcher.split(List.of("a", "b", "cc", "dddddd", "eeeeeeee"))
+        );
+    }
+
+    public void testSplit_whenTextsNotSorted_thenBoundedByLongestText() {
+        // texts of 2, 1 and 1 approximate tokens, a budget of 4 padded tokens
+        InferenceMicroBatcher microBatcher = new InferenceMicroBatcher(4, 0, 0);
+
+        assertEquals(List.of(List.of("dddddd", "a"), List.of("b")), microBatcher.split(List.of("dddddd", "a", "b")));
+    }
+
+    public void testSplit_whenTextExceedsBudget_thenOwnBatch() {
+        InferenceMicroBatcher microBatcher = new InferenceMicroBatcher(2, 0, 0);
+        String longText = "x".repeat(100);
+
+        assertEquals(List.of(List.of("a"), List.of(longText), List.of(longText)), microBatcher.split(List.of("a", longText, longText)));
+    }
+
+    public void testExecute_whenSingleBatch_thenResultsPassedThrough() {
+        InferenceMicroBatcher microBatcher = new InferenceMicroBatcher(0, 0, 0);
+        List<String> results = List.of("r1", "r2", "r3");
+
+        microBatcher.execute(List.of("a", "b"), inference, response::set, failure::set);
+        pendingInferences.get(0).onResponse(results);
+
+        assertEquals(1, requests.size());
+        assertSame(results, response.get());
+        assertNull(failure.get());
+    }
+
+    public void testExecute_whenDefaultSettings_thenTextsSentInOneRequestUnchanged() {
+        InferenceMicroBatcher microBatcher = new InferenceMicroBatcher(
+            NeuralSearchSettings.INGEST_INFERENCE_MAX_TOKENS_PER_REQUEST.get(Settings.EMPTY),
+            NeuralSearchSettings.INGEST_INFERENCE_MAX_TEXTS_PER_REQUEST.get(Settings.EMPTY),
+            NeuralSearchSettings.INGEST_INFERENCE_MAX_CONCURRENT_MICRO_BATCHES.get(Settings.EMPTY)
+        );
+        List<String> texts = new ArrayList<>();
+        for (int i = 0; i < 1000; i++) {
+            texts.add("x".repeat(1000));
+        }
+        List<String> results = new ArrayList<>(texts);
+        long microBatchesBefore = EventStatName.INGEST_INFERENCE_MICRO_BATCHES.getEventStat().getValue();
+
+        microBatcher.execute(texts, inference, response::set, failure::set);
+        pendingInferences.get(0).onResponse(results);
+
+        assertEquals(1, requests.size());
+        assertSame(texts, requests.get(0));
+        assertSame(results, response.get());
+        assertNull(failure.get());
+        assertEquals(microBatchesBefore, EventStatName.INGEST_INFERENCE_MICRO_BATCHES.getEventStat().getValue());
+    }
+
+    public void testExecute_whenMicroBatchesCompleteOutOfOrder_thenResultsInTextOrder() {
+        InferenceMicroBatcher microBatcher = new InferenceMicroBatcher(0, 2, 0);
+
+        microBatcher.execute(List.of("a", "b", "c", "d", "e"), inference, response::set, failure::set);
+        assertEquals(List.of(List.of("a", "b"), List.of("c", "d"), List.of("e")), requests);
+
+        pendingInferences.get(2).onResponse(List.of("E"));
+        pendingInferences.get(0).onResponse(List.of("A", "B"));
+        assertNull(response.get());
+        pendingInferences.get(1).onResponse(List.of("C", "D"));
+
+        assertEquals(List.of("A", "B", "C", "D", "E"), response.get());
+        assertNull(failure.get());
+    }
+
+    public void testExecute_whenMicroBatchFails_thenFailsOnce() {
+        InferenceMicroBatcher microBatcher = new InferenceMicroBatcher(0, 1, 0);
+        RuntimeException exception = new RuntimeException("inference failed");
+        List<Exception> failures = new ArrayList<>();
+
+        microBatcher.execute(List.of("a", "b", "c"), inference, response::set, failures::add);
+        pendingInferences.get(0).onFailure(exception);
+        pendingInferences.get(1).onResponse(List.of("B"));
+        pendingInferences.get(2).onFailure(new RuntimeException("another failure"));
+
+        assertEquals(List.of(exception), failures);
+        assertNull(response.get());
+    }
+
+    public void testExecute_whenMicroBatchReturnsTooFewResults_thenFails() {
+        InferenceMicroBatcher microBatcher = new InferenceMicroBatcher(0, 2, 0);
+
+        microBatcher.execute(List.of("a", "b", "c"), inference, response::set, failure::set);
+        pendingInferences.get(0).onResponse(List.of("A"));
+
+        assertTrue(failure.get() instanceof IllegalStateException);
+        assertNull(response.get());
+    }
+
+    public void testExecute_whenWindowBounded_thenNextMicroBatchSentOnCompletion() {
+        InferenceMicroBatcher microBatcher = new InferenceMicroBatcher(0, 1, 2);
+
+        microBatcher.execute(List.of("a", "b", "c", "d"), inference, response::set, failure::set);
+        assertEquals(List.of(List.of("a"), List.of("b")), requests);
+
+        pendingInferences.get(1).onResponse(List.of("B"));
+        assertEquals(List.of(List.of("a"), List.of("b"), List.of("c")), requests);
+        pendingInferences.get(0).onResponse(List.of("A"));
+        pendingInferences.get(2).onResponse(List.of("C"));
+        assertEquals(4, requests.size());
+        pendingInferences.get(3).onResponse(List.of("D"));
+
+        assertEquals(List.of("A", "B", "C", "D"), response.get());
+        assertNull(failure.get());
+    }
+
+    public void testExecute_whenWindowBoundedAndMicroBatchFails_thenRemainingNotSent() {
+        InferenceMicroBatcher microBatcher = new InferenceMicroBatcher(0, 1, 1);
+
+        microBatcher.execute(List.of("a", "b", "c"), inference, response::set, failure::set);
+        pendingInferences.get(0).onFailure(new RuntimeException("inference failed"));
+
+        assertEquals(1, requests.size());
+        assertNotNull(failure.get());
+    }
+
+    public void testExecute_whenMicroBatchesCompleteSynchronously_thenAllSentWithoutRecursion() {
+        InferenceMicroBatcher microBatcher = new InferenceMicroBatcher(0, 1, 1);
+        List<String> texts = new ArrayList<>();
+        for (int i = 0; i < 10_000; i++) {
+            texts.add("text");
+        }
+
+        microBatcher.execute(texts, (batch, listener) -> listener.onResponse(List.of("result")), response::set, failure::set);
+
+        assertEquals(texts.size(), response.get().size());
+        assertNull(failure.get());
+    }
+}
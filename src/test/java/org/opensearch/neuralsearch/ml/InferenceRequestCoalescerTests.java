@@ -0,0 +1,136 @@
+/*
+ * Copyright OpenSearch Contributors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+package org.opensearch.neuralsearch.ml;
+
+import com.google.common.hash.HashCode;
+import org.junit.Before;
+import org.opensearch.common.settings.Settings;
+import org.opensearch.common.util.concurrent.ThreadContext;
+import org.opensearch.core.action.ActionListener;
+import org.opensearch.neuralsearch.util.TestUtils;
+import org.opensearch.test.OpenSearchTestCase;
+import org.opensearch.threadpool.ThreadPool;
+
+import java.util.ArrayList;
+import java.util.List;
+import java.util.concurrent.atomic.AtomicInteger;
+import java.util.function.Consumer;
+
+import static org.mockito.Mockito.mock;
+import static org.mockito.Mockito.verify;
+import static org.mockito.Mockito.when;
+
+public class InferenceRequestCoalescerTests extends OpenSearchTestCase {
+    private static final HashCode KEY = HashCode.fromInt(1);
+
+    private InferenceRequestCoalescer coalescer;
+    private List<ActionListener<String>> pendingInferences;
+    private AtomicInteger inferenceCount;
+    private Consumer<ActionListener<String>> inference;
+
+    @Before
+    public void setup() {
+        TestUtils.initializeEventStatsManager();
+        coalescer = new InferenceRequestCoalescer();
+        pendingInferences = new ArrayList<>();
+        inferenceCount = new AtomicInteger();
+        inference = listener -> {
+            inferenceCount.incrementAndGet();
+            pendingInferences.add(listener);
+        };
+    }
+
+    public void testExecute_whenIdenticalInferenceInFlight_thenShared() {
+        ActionListener<String> first = mock(ActionListener.class);
+        ActionListener<String> second = mock(ActionListener.class);
+
+        coalescer.execute(KEY, first, inference);
+        coalescer.execute(KEY, second, inference);
+        assertEquals(1, inferenceCount.get());
+        assertEquals(1, coalescer.inFlightCount());
+
+        pendingInferences.get(0).onResponse("embedding");
+
+        verify(first).onResponse("embedding");
+        verify(second).onResponse("embedding");
+        assertEquals(0, coalescer.inFlightCount());
+    }
+
+    public void testExecute_whenInferenceFails_thenAllWaitersFail() {
+        ActionListener<String> first = mock(ActionListener.class);
+        ActionListener<String> second = mock(ActionListener.class);
+        RuntimeException exception = new RuntimeException("inference failed");
+
+        coalescer.execute(KEY, first, inference);
+        coalescer.execute(KEY, second, inference);
+        pendingInferences.get(0).onFailure(exception);
+
+        verify(first).onFailure(exception);
+        verify(second).onFailure(exception);
+        assertEquals(0, coalescer.inFlightCount());
+    }
+
+    public void testExecute_whenInferenceCompleted_thenNextRequestRunsNewInference() {
+        coalescer.execute(KEY, mock(ActionListener.class), inference);
+        pendingInferences.get(0).onResponse("embedding");
+
+        coalescer.execute(KEY, mock(ActionListener.class), inference);
+
+        assertEquals(2, inferenceCount.get());
+    }
+
+    public void testExecute_whenDifferentKeys_thenNotShared() {
+        coalescer.execute(KEY, mock(ActionListener.class), inference);
+        coalescer.execute(HashCode.fromInt(2), mock(ActionListener.class), inference);
+
+        assertEquals(2, inferenceCount.get());
+    }
+
+    public void testExecute_whenDisabled_thenNotShared() {
+        coalescer.setEnabled(false);
+
+        coalescer.execute(KEY, mock(ActionListener.class), inference);
+        coalescer.execute(KEY, mock(ActionListener.class), inference);
+
+        assertEquals(2, inferenceCount.get());
+        assertEquals(0, coalescer.inFlightCount());
+    }
+
+    public void testExecute_whenInferenceThrows_thenWaitersFailAndKeyReleased() {
+        ActionListener<String> listener = mock(ActionListener.class);
+        RuntimeException exception = new RuntimeException("invalid input");
+
+        coalescer.execute(KEY, listener, l -> { throw exception; });
+
+        verify(listener).onFailure(exception);
+        assertEquals(0, coalescer.inFlightCount());
+    }
+
+    public void testExecute_whenListenersJoinFromDifferentContexts_thenEachCompletedInOwnContext() {
+        ThreadContext threadContext = new ThreadContext(Settings.EMPTY);
+        ThreadPool threadPool = mock(ThreadPool.class);
+        when(threadPool.getThreadContext()).thenReturn(threadContext);
+        coalescer.initialize(threadPool);
+        List<String> completionUsers = new ArrayList<>();
+        ActionListener<String> first = ActionListener.wrap(r -> completionUsers.add(threadContext.getHeader("user")), e -> fail());
+        ActionListener<String> second = ActionListener.wrap(r -> completionUsers.add(threadContext.getHeader("user")), e -> fail());
+
+        try (ThreadContext.StoredContext ignored = threadContext.stashContext()) {
+            threadContext.putHeader("user", "first");
+            coalescer.execute(KEY, first, inference);
+        }
+        try (ThreadContext.StoredContext ignored = threadContext.stashContext()) {
+            threadContext.putHeader("user", "second");
+            coalescer.execute(KEY, second, inference);
+        }
+        try (ThreadContext.StoredContext ignored = threadContext.stashContext()) {
+            threadContext.putHeader("user", "responder");
+            pendingInferences.get(0).onResponse("embedding");
+            assertEquals("responder", threadContext.getHeader("user"));
+        }
+
+        assertEquals(List.of("first", "second"), completionUsers);
+    }
+}
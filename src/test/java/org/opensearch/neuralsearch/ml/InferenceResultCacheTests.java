@@ -0,0 +1,148 @@
+/*
+ * Copyright OpenSearch Contributors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+package org.opensearch.neuralsearch.ml;
+
+import com.google.common.hash.HashCode;
+import org.junit.Before;
+import org.opensearch.common.settings.Settings;
+import org.opensearch.common.unit.TimeValue;
+import org.opensearch.common.util.concurrent.ThreadContext;
+import org.opensearch.core.action.ActionListener;
+import org.opensearch.neuralsearch.processor.EmbeddingContentType;
+import org.opensearch.neuralsearch.processor.MapInferenceRequest;
+import org.opensearch.neuralsearch.processor.TextInferenceRequest;
+import org.opensearch.neuralsearch.util.TestUtils;
+import org.opensearch.test.OpenSearchTestCase;
+import org.opensearch.threadpool.ThreadPool;
+
+import java.util.LinkedHashMap;
+import java.util.List;
+import java.util.Map;
+
+import static org.mockito.Mockito.mock;
+import static org.mockito.Mockito.verify;
+import static org.mockito.Mockito.when;
+
+public class InferenceResultCacheTests extends OpenSearchTestCase {
+    private static final String MODEL_ID = "model_id";
+
+    private InferenceResultCache cache;
+    private ThreadContext threadContext;
+
+    @Before
+    public void setup() {
+        TestUtils.initializeEventStatsManager();
+        cache = new InferenceResultCache(10, TimeValue.timeValueMinutes(1));
+        threadContext = new ThreadContext(Settings.EMPTY);
+        ThreadPool threadPool = mock(ThreadPool.class);
+        when(threadPool.getThreadContext()).thenReturn(threadContext);
+        cache.initialize(threadPool);
+    }
+
+    public void testCreateKey_whenSameRequest_thenSameKey() {
+        HashCode key = cache.createKey(textRequest(EmbeddingContentType.QUERY), List.of("hello"));
+
+        assertEquals(key, cache.createKey(textRequest(EmbeddingContentType.QUERY), List.of("hello")));
+        assertNotEquals(key, cache.createKey(textRequest(EmbeddingContentType.QUERY), List.of("world")));
+        assertNotEquals(key, cache.createKey(textRequest(EmbeddingContentType.QUERY), List.of("hel", "lo")));
+    }
+
+    public void testCreateKey_whenMapInputInDifferentOrder_thenSameKey() {
+        Map<String, String> input = new LinkedHashMap<>();
+        input.put("inputText", "text");
+        input.put("inputImage", "image");
+        Map<String, String> reordered = new LinkedHashMap<>();
+        reordered.put("inputImage", "image");
+        reordered.put("inputText", "text");
+        MapInferenceRequest request = MapInferenceRequest.builder()
+            .modelId(MODEL_ID)
+            .inputObjects(input)
+            .embeddingContentType(EmbeddingContentType.QUERY)
+            .build();
+
+        assertEquals(cache.createKey(request, input), cache.createKey(request, reordered));
+    }
+
+    public void testCreateKey_whenDifferentUser_thenDifferentKey() {
+        HashCode key;
+        try (ThreadContext.StoredContext ignored = threadContext.stashContext()) {
+            threadContext.putTransient(InferenceResultCache.SECURITY_USER_INFO_TRANSIENT, "alice|ml_users|ml_full_access|");
+            key = cache.createKey(textRequest(EmbeddingContentType.QUERY), List.of("hello"));
+            cache.cachingListener(key, mock(ActionListener.class)).onResponse(List.of(1.0f));
+        }
+        try (ThreadContext.StoredContext ignored = threadContext.stashContext()) {
+            threadContext.putTransient(InferenceResultCache.SECURITY_USER_INFO_TRANSIENT, "bob|||");
+            HashCode otherUserKey = cache.createKey(textRequest(EmbeddingContentType.QUERY), List.of("hello"));
+
+            assertNotEquals(key, otherUserKey);
+            assertNull(cache.get(otherUserKey));
+        }
+    }
+
+    public void testCreateKey_whenDifferentTenant_thenDifferentKey() {
+        HashCode key;
+        try (ThreadContext.StoredContext ignored = threadContext.stashContext()) {
+            threadContext.putHeader(InferenceResultCache.TENANT_ID_HEADER, "tenant_a");
+            key = cache.createKey(textRequest(EmbeddingContentType.QUERY), List.of("hello"));
+        }
+        try (ThreadContext.StoredContext ignored = threadContext.stashContext()) {
+            threadContext.putHeader(InferenceResultCache.TENANT_ID_HEADER, "tenant_b");
+
+            assertNotEquals(key, cache.createKey(textRequest(EmbeddingContentType.QUERY), List.of("hello")));
+        }
+    }
+
+    public void testCreateKey_whenNotQueryContent_thenNull() {
+        assertNull(cache.createKey(textRequest(EmbeddingContentType.PASSAGE), List.of("hello")));
+        assertNull(cache.createKey(textRequest(null), List.of("hello")));
+    }
+
+    public void testCachingListener_whenDisabled_thenNotCached() {
+        HashCode key = cache.createKey(textRequest(EmbeddingContentType.QUERY), List.of("hello"));
+        ActionListener<List<Number>> listener = mock(ActionListener.class);
+        cache.setMaxEntries(0);
+
+        assertFalse(cache.isEnabled());
+        assertSame(listener, cache.cachingListener(key, listener));
+        assertNull(cache.get(key));
+    }
+
+    public void testCachingListener_whenResponse_thenCachedAndForwarded() {
+        HashCode key = cache.createKey(textRequest(EmbeddingContentType.QUERY), List.of("hello"));
+        ActionListener<List<Number>> listener = mock(ActionListener.class);
+        List<Number> embedding = List.of(1.0f, 2.0f);
+
+        assertNull(cache.get(key));
+        cache.cachingListener(key, listener).onResponse(embedding);
+
+        verify(listener).onResponse(embedding);
+        assertEquals(embedding, cache.get(key));
+        assertEquals(1, cache.size());
+    }
+
+    public void testCachingListener_whenFailure_thenNotCached() {
+        HashCode key = cache.createKey(textRequest(EmbeddingContentType.QUERY), List.of("hello"));
+        ActionListener<List<Number>> listener = mock(ActionListener.class);
+        RuntimeException exception = new RuntimeException("inference failed");
+
+        cache.cachingListener(key, listener).onFailure(exception);
+
+        verify(listener).onFailure(exception);
+        assertNull(cache.get(key));
+    }
+
+    public void testClear_thenReturnsDroppedEntries() {
+        HashCode key = cache.createKey(textRequest(EmbeddingContentType.QUERY), List.of("hello"));
+        cache.cachingListener(key, mock(ActionListener.class)).onResponse(List.of(1.0f));
+
+        assertEquals(1, cache.clear());
+        assertNull(cache.get(key));
+        assertEquals(0, cache.size());
+    }
+
+    private TextInferenceRequest textRequest(EmbeddingContentType contentType) {
+        return TextInferenceRequest.builder().modelId(MODEL_ID).inputTexts(List.of("hello")).embeddingContentType(contentType).build();
+    }
+}
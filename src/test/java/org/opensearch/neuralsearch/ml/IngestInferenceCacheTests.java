@@ -0,0 +1,258 @@
+/*
+ * Copyright OpenSearch Contributors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+package org.opensearch.neuralsearch.ml;
+
+import org.junit.Before;
+import org.opensearch.core.action.ActionListener;
+import org.opensearch.core.common.breaker.CircuitBreaker;
+import org.opensearch.core.common.breaker.CircuitBreakingException;
+import org.opensearch.core.common.unit.ByteSizeValue;
+import org.opensearch.neuralsearch.common.FloatArrayList;
+import org.opensearch.neuralsearch.sparse.cache.CircuitBreakerManager;
+import org.opensearch.neuralsearch.stats.events.EventStatName;
+import org.opensearch.neuralsearch.util.TestUtils;
+import org.opensearch.test.OpenSearchTestCase;
+
+import java.util.ArrayList;
+import java.util.Arrays;
+import java.util.HashMap;
+import java.util.List;
+import java.util.Map;
+import java.util.concurrent.atomic.AtomicReference;
+import java.util.function.BiConsumer;
+
+import static org.mockito.ArgumentMatchers.anyLong;
+import static org.mockito.ArgumentMatchers.anyString;
+import static org.mockito.Mockito.doThrow;
+import static org.mockito.Mockito.mock;
+import static org.mockito.Mockito.never;
+import static org.mockito.Mockito.times;
+import static org.mockito.Mockito.verify;
+
+public class IngestInferenceCacheTests extends OpenSearchTestCase {
+    private static final String MODEL_ID = "model_id";
+    private static final long CAPACITY = 1024 * 1024;
+
+    private CircuitBreaker circuitBreaker;
+    private List<List<String>> requests;
+    private BiConsumer<List<String>, ActionListener<List<?>>> inference;
+    private AtomicReference<List<?>> response;
+    private AtomicReference<Exception> failure;
+
+    @Before
+    public void setup() {
+        TestUtils.initializeEventStatsManager();
+        circuitBreaker = mock(CircuitBreaker.class);
+        CircuitBreakerManager.setCircuitBreaker(circuitBreaker);
+        requests = new ArrayList<>();
+        // the dense embedding of a text is its length repeated twice
+        inference = (texts, listener) -> {
+            requests.add(texts);
+            List<FloatArrayList> results = new ArrayList<>();
+            for (String text : texts) {
+                results.add(new FloatArrayList(new float[] { text.length(), text.length() }));
+            }
+            listener.onResponse(results);
+        };
+        response = new AtomicReference<>();
+        failure = new AtomicReference<>();
+    }
+
+    public void testExecute_whenTextsCached_thenInferenceSkipped() {
+        IngestInferenceCache cache = new IngestInferenceCache(CAPACITY);
+        long hitsBefore = EventStatName.INGEST_INFERENCE_CACHE_HITS.getEventStat().getValue();
+
+        cache.execute(MODEL_ID, IngestInferenceCache.DENSE_EMBEDDING_VARIANT, List.of("a", "bb"), inference, response::set, failure::set);
+        cache.execute(MODEL_ID, IngestInferenceCache.DENSE_EMBEDDING_VARIANT, List.of("bb", "a"), inference, response::set, failure::set);
+
+        assertEquals(1, requests.size());
+        assertEquals(List.of(List.of(2f, 2f), List.of(1f, 1f)), response.get());
+        assertEquals(2, EventStatName.INGEST_INFERENCE_CACHE_HITS.getEventStat().getValue() - hitsBefore);
+        assertNull(failure.get());
+    }
+
+    public void testExecute_whenSomeTextsCached_thenOnlyMissesInferredAndResultsInOrder() {
+        IngestInferenceCache cache = new IngestInferenceCache(CAPACITY);
+        long missesBefore = EventStatName.INGEST_INFERENCE_CACHE_MISSES.getEventStat().getValue();
+
+        cache.execute(MODEL_ID, IngestInferenceCache.DENSE_EMBEDDING_VARIANT, List.of("bb"), inference, response::set, failure::set);
+        cache.execute(
+            MODEL_ID,
+            IngestInferenceCache.DENSE_EMBEDDING_VARIANT,
+            List.of("a", "bb", "ccc"),
+            inference,
+            response::set,
+            failure::set
+        );
+
+        assertEquals(List.of(List.of("bb"), List.of("a", "ccc")), requests);
+        assertEquals(List.of(List.of(1f, 1f), List.of(2f, 2f), List.of(3f, 3f)), response.get());
+        assertEquals(3, EventStatName.INGEST_INFERENCE_CACHE_MISSES.getEventStat().getValue() - missesBefore);
+    }
+
+    public void testExecute_whenModelOrVariantDiffers_thenNotShared() {
+        IngestInferenceCache cache = new IngestInferenceCache(CAPACITY);
+
+        cache.execute(MODEL_ID, IngestInferenceCache.DENSE_EMBEDDING_VARIANT, List.of("a"), inference, response::set, failure::set);
+        cache.execute("other_model_id", IngestInferenceCache.DENSE_EMBEDDING_VARIANT, List.of("a"), inference, response::set, failure::set);
+        cache.execute(MODEL_ID, "other_variant", List.of("a"), inference, response::set, failure::set);
+
+        assertEquals(3, requests.size());
+    }
+
+    public void testExecute_whenDisabledOrNoVariant_thenPassedThrough() {
+        IngestInferenceCache disabledCache = new IngestInferenceCache(0);
+        IngestInferenceCache cache = new IngestInferenceCache(CAPACITY);
+        List<?> results = List.of("result");
+        BiConsumer<List<String>, ActionListener<List<?>>> rawInference = (texts, listener) -> {
+            requests.add(texts);
+            listener.onResponse(results);
+        };
+
+        disabledCache.execute(
+            MODEL_ID,
+            IngestInferenceCache.DENSE_EMBEDDING_VARIANT,
+            List.of("a"),
+            rawInference,
+            response::set,
+            failure::set
+        );
+        assertSame(results, response.get());
+        cache.execute(MODEL_ID, null, List.of("a"), rawInference, response::set, failure::set);
+        assertSame(results, response.get());
+        cache.execute(MODEL_ID, null, List.of("a"), rawInference, response::set, failure::set);
+
+        assertEquals(3, requests.size());
+        assertEquals(0, cache.ramBytesUsed());
+        verify(circuitBreaker, never()).addEstimateBytesAndMaybeBreak(anyLong(), anyString());
+    }
+
+    public void testExecute_whenCircuitBreakerTrips_thenNotCached() {
+        IngestInferenceCache cache = new IngestInferenceCache(CAPACITY);
+        doThrow(new CircuitBreakingException("Memory limit exceeded", CircuitBreaker.Durability.PERMANENT)).when(circuitBreaker)
+            .addEstimateBytesAndMaybeBreak(anyLong(), anyString());
+
+        cache.execute(MODEL_ID, IngestInferenceCache.DENSE_EMBEDDING_VARIANT, List.of("a"), inference, response::set, failure::set);
+        cache.execute(MODEL_ID, IngestInferenceCache.DENSE_EMBEDDING_VARIANT, List.of("a"), inference, response::set, failure::set);
+
+        assertEquals(2, requests.size());
+        assertEquals(List.of(List.of(1f, 1f)), response.get());
+        assertEquals(0, cache.ramBytesUsed());
+    }
+
+    public void testExecute_whenTooFewResults_thenFails() {
+        IngestInferenceCache cache = new IngestInferenceCache(CAPACITY);
+
+        cache.execute(
+            MODEL_ID,
+            IngestInferenceCache.DENSE_EMBEDDING_VARIANT,
+            List.of("a", "b"),
+            (texts, listener) -> listener.onResponse(List.of(new FloatArrayList(new float[] { 1f }))),
+            response::set,
+            failure::set
+        );
+
+        assertTrue(failure.get() instanceof IllegalStateException);
+        assertNull(response.get());
+        assertEquals(0, cache.ramBytesUsed());
+    }
+
+    public void testExecute_whenInferenceFails_thenFailurePassedThrough() {
+        IngestInferenceCache cache = new IngestInferenceCache(CAPACITY);
+        RuntimeException exception = new RuntimeException("inference failed");
+
+        cache.execute(MODEL_ID, IngestInferenceCache.DENSE_EMBEDDING_VARIANT, List.of("a"), (texts, listener) -> {
+            throw exception;
+        }, response::set, failure::set);
+
+        assertSame(exception, failure.get());
+        assertNull(response.get());
+    }
+
+    @SuppressWarnings("unchecked")
+    public void testExecute_whenCachedResultsModified_thenCacheUnchanged() {
+        IngestInferenceCache cache = new IngestInferenceCache(CAPACITY);
+        BiConsumer<List<String>, ActionListener<List<?>>> sparseInference = (texts, listener) -> listener.onResponse(
+            List.of(new HashMap<>(Map.of("hello", 1.5f, "world", 0.5f)))
+        );
+
+        cache.execute(MODEL_ID, IngestInferenceCache.SPARSE_EMBEDDING_VARIANT, List.of("hello world"), sparseInference, results -> {
+            ((Map<String, Float>) results.get(0)).put("hello", 0f);
+        }, failure::set);
+        cache.execute(
+            MODEL_ID,
+            IngestInferenceCache.SPARSE_EMBEDDING_VARIANT,
+            List.of("hello world"),
+            inference,
+            response::set,
+            failure::set
+        );
+        assertEquals(List.of(Map.of("hello", 1.5f, "world", 0.5f)), response.get());
+        ((Map<String, Float>) response.get().get(0)).clear();
+
+        cache.execute(MODEL_ID, IngestInferenceCache.DENSE_EMBEDDING_VARIANT, List.of("a"), inference, response::set, failure::set);
+        ((FloatArrayList) response.get().get(0)).set(0, 0f);
+        cache.execute(MODEL_ID, IngestInferenceCache.DENSE_EMBEDDING_VARIANT, List.of("a"), inference, response::set, failure::set);
+
+        assertEquals(List.of(List.of(1f, 1f)), response.get());
+        cache.execute(
+            MODEL_ID,
+            IngestInferenceCache.SPARSE_EMBEDDING_VARIANT,
+            List.of("hello world"),
+            inference,
+            response::set,
+            failure::set
+        );
+        assertEquals(List.of(Map.of("hello", 1.5f, "world", 0.5f)), response.get());
+        assertNull(failure.get());
+    }
+
+    public void testExecute_whenResultNotAnEmbedding_thenNotCached() {
+        IngestInferenceCache cache = new IngestInferenceCache(CAPACITY);
+        BiConsumer<List<String>, ActionListener<List<?>>> rawInference = (texts, listener) -> {
+            requests.add(texts);
+            listener.onResponse(List.of("result"));
+        };
+
+        cache.execute(MODEL_ID, IngestInferenceCache.DENSE_EMBEDDING_VARIANT, List.of("a"), rawInference, response::set, failure::set);
+        cache.execute(MODEL_ID, IngestInferenceCache.DENSE_EMBEDDING_VARIANT, List.of("a"), rawInference, response::set, failure::set);
+
+        assertEquals(2, requests.size());
+        assertEquals(List.of("result"), response.get());
+    }
+
+    public void testClear_thenEntriesDroppedAndMemoryReleased() {
+        IngestInferenceCache cache = new IngestInferenceCache(CAPACITY);
+        cache.execute(
+            MODEL_ID,
+            IngestInferenceCache.DENSE_EMBEDDING_VARIANT,
+            Arrays.asList("a", "bb"),
+            inference,
+            response::set,
+            failure::set
+        );
+        long bytes = cache.ramBytesUsed();
+        assertTrue(bytes > 0);
+
+        assertEquals(2, cache.clear());
+
+        assertEquals(0, cache.ramBytesUsed());
+        verify(circuitBreaker, times(2)).addWithoutBreaking(-bytes / 2);
+        cache.execute(MODEL_ID, IngestInferenceCache.DENSE_EMBEDDING_VARIANT, List.of("a"), inference, response::set, failure::set);
+        assertEquals(2, requests.size());
+    }
+
+    public void testSetCapacity_whenReduced_thenEntriesEvictedAndMemoryReleased() {
+        IngestInferenceCache cache = new IngestInferenceCache(CAPACITY);
+        cache.execute(MODEL_ID, IngestInferenceCache.DENSE_EMBEDDING_VARIANT, List.of("a"), inference, response::set, failure::set);
+        long bytes = cache.ramBytesUsed();
+
+        cache.setCapacity(new ByteSizeValue(0));
+
+        assertFalse(cache.isEnabled());
+        assertEquals(0, cache.ramBytesUsed());
+        verify(circuitBreaker).addWithoutBreaking(-bytes);
+    }
+}
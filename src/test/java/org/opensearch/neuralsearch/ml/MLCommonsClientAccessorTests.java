@@ -6,6 +6,7 @@ package org.opensearch.neuralsearch.ml;
 
 import static org.mockito.ArgumentMatchers.any;
 import static org.mockito.ArgumentMatchers.anyList;
+import static org.mockito.ArgumentMatchers.anyString;
 import static org.mockito.ArgumentMatchers.eq;
 import static org.mockito.Mockito.mock;
 import static org.mockito.Mockito.times;
@@ -28,11 +29,17 @@ import org.mockito.InjectMocks;
 import org.mockito.Mock;
 import org.mockito.Mockito;
 import org.mockito.MockitoAnnotations;
+import org.opensearch.OpenSearchStatusException;
 import org.opensearch.ResourceNotFoundException;
 import org.opensearch.action.search.SearchRequest;
 import org.opensearch.cluster.node.DiscoveryNode;
+import org.opensearch.common.settings.Settings;
+import org.opensearch.common.unit.TimeValue;
+import org.opensearch.common.util.concurrent.ThreadContext;
 import org.opensearch.core.action.ActionListener;
+import org.opensearch.core.rest.RestStatus;
 import org.opensearch.core.xcontent.NamedXContentRegistry;
+import org.opensearch.neuralsearch.common.FloatArrayList;
 import org.opensearch.neuralsearch.ml.dto.AgentInfoDTO;
 import org.opensearch.neuralsearch.ml.dto.AgentExecutionDTO;
 import org.opensearch.neuralsearch.query.AgenticSearchQueryBuilder;
@@ -53,6 +60,9 @@ import org.opensearch.neuralsearch.constants.TestCommonConstants;
 import org.opensearch.neuralsearch.processor.highlight.SentenceHighlightingRequest;
 import org.opensearch.neuralsearch.processor.TextInferenceRequest;
 import org.opensearch.neuralsearch.processor.MapInferenceRequest;
+import org.opensearch.neuralsearch.util.RetryUtil;
+import org.opensearch.neuralsearch.util.TestUtils;
+import org.opensearch.threadpool.ThreadPool;
 import org.opensearch.test.OpenSearchTestCase;
 import org.opensearch.transport.NodeNotConnectedException;
 
@@ -76,6 +86,16 @@ public class MLCommonsClientAccessorTests extends OpenSearchTestCase {
     @Before
     public void setup() {
         MockitoAnnotations.openMocks(this);
+        TestUtils.initializeEventStatsManager();
+        // run scheduled retries immediately
+        final ThreadPool threadPool = mock(ThreadPool.class);
+        when(threadPool.schedule(any(Runnable.class), any(TimeValue.class), anyString())).thenAnswer(invocation -> {
+            invocation.<Runnable>getArgument(0).run();
+            return null;
+        });
+        RetryUtil.initialize(threadPool, Integer.MAX_VALUE);
+        // predict mocks that never respond must not hold slots of later tests
+        InferenceDispatcher.getInstance().reset();
     }
 
     public void testInferenceSentences_whenValidInputThenSuccess() {
@@ -440,6 +460,91 @@ public class MLCommonsClientAccessorTests extends OpenSearchTestCase {
         Mockito.verifyNoMoreInteractions(singleSentenceResultListener);
     }
 
+    public void testInferenceSentencesMap_whenQueryInferenceRepeated_thenServedFromCache() {
+        final List<Number> vector = new ArrayList<>(List.of(TestCommonConstants.PREDICT_VECTOR_ARRAY));
+        Mockito.doAnswer(invocation -> {
+            final ActionListener<MLModel> actionListener = invocation.getArgument(2);
+            actionListener.onResponse(createSymmetricModel());
+            return null;
+        }).when(client).getModel(eq(TestCommonConstants.MODEL_ID), eq(null), Mockito.isA(ActionListener.class));
+        Mockito.doAnswer(invocation -> {
+            final ActionListener<MLOutput> actionListener = invocation.getArgument(2);
+            actionListener.onResponse(createModelTensorOutput(TestCommonConstants.PREDICT_VECTOR_ARRAY));
+            return null;
+        }).when(client).predict(eq(TestCommonConstants.MODEL_ID), Mockito.isA(MLInput.class), Mockito.isA(ActionListener.class));
+        TestUtils.initializeEventStatsManager();
+        InferenceResultCache.getInstance().setMaxEntries(10);
+        InferenceResultCache.getInstance().setTtl(TimeValue.timeValueMinutes(1));
+        try {
+            final MapInferenceRequest queryRequest = MapInferenceRequest.builder()
+                .modelId(TestCommonConstants.MODEL_ID)
+                .inputObjects(TestCommonConstants.SENTENCES_MAP)
+                .embeddingContentType(org.opensearch.neuralsearch.processor.EmbeddingContentType.QUERY)
+                .build();
+
+            accessor.inferenceSentencesMap(queryRequest, singleSentenceResultListener);
+            accessor.inferenceSentencesMap(queryRequest, singleSentenceResultListener);
+
+            verify(client).predict(eq(TestCommonConstants.MODEL_ID), Mockito.isA(MLInput.class), Mockito.isA(ActionListener.class));
+            verify(singleSentenceResultListener, times(2)).onResponse(vector);
+        } finally {
+            InferenceResultCache.getInstance().setMaxEntries(0);
+        }
+    }
+
+    public void testInferenceSentencesMap_whenCachedForOtherUser_thenCacheMissAndModelAccessChecked() {
+        final ThreadContext threadContext = new ThreadContext(Settings.EMPTY);
+        final ThreadPool threadPool = mock(ThreadPool.class);
+        when(threadPool.getThreadContext()).thenReturn(threadContext);
+        final OpenSearchStatusException accessDenied = new OpenSearchStatusException("no access to model", RestStatus.FORBIDDEN);
+        Mockito.doAnswer(invocation -> {
+            final ActionListener<MLModel> actionListener = invocation.getArgument(2);
+            actionListener.onResponse(createSymmetricModel());
+            return null;
+        }).when(client).getModel(eq(TestCommonConstants.MODEL_ID), eq(null), Mockito.isA(ActionListener.class));
+        Mockito.doAnswer(invocation -> {
+            final ActionListener<MLOutput> actionListener = invocation.getArgument(2);
+            if ("alice|ml_users||".equals(threadContext.getTransient(InferenceResultCache.SECURITY_USER_INFO_TRANSIENT))) {
+                actionListener.onResponse(createModelTensorOutput(TestCommonConstants.PREDICT_VECTOR_ARRAY));
+            } else {
+                actionListener.onFailure(accessDenied);
+            }
+            return null;
+        }).when(client).predict(eq(TestCommonConstants.MODEL_ID), Mockito.isA(MLInput.class), Mockito.isA(ActionListener.class));
+        TestUtils.initializeEventStatsManager();
+        InferenceResultCache.getInstance().initialize(threadPool);
+        InferenceResultCache.getInstance().setMaxEntries(10);
+        InferenceResultCache.getInstance().setTtl(TimeValue.timeValueMinutes(1));
+        try {
+            final MapInferenceRequest queryRequest = MapInferenceRequest.builder()
+                .modelId(TestCommonConstants.MODEL_ID)
+                .inputObjects(TestCommonConstants.SENTENCES_MAP)
+                .embeddingContentType(org.opensearch.neuralsearch.processor.EmbeddingContentType.QUERY)
+                .build();
+            final ActionListener<List<Number>> otherUserListener = mock(ActionListener.class);
+
+            try (ThreadContext.StoredContext ignored = threadContext.stashContext()) {
+                threadContext.putTransient(InferenceResultCache.SECURITY_USER_INFO_TRANSIENT, "alice|ml_users||");
+                accessor.inferenceSentencesMap(queryRequest, singleSentenceResultListener);
+            }
+            try (ThreadContext.StoredContext ignored = threadContext.stashContext()) {
+                threadContext.putTransient(InferenceResultCache.SECURITY_USER_INFO_TRANSIENT, "bob|||");
+                accessor.inferenceSentencesMap(queryRequest, otherUserListener);
+            }
+
+            verify(client, times(2)).predict(
+                eq(TestCommonConstants.MODEL_ID),
+                Mockito.isA(MLInput.class),
+                Mockito.isA(ActionListener.class)
+            );
+            verify(singleSentenceResultListener).onResponse(new ArrayList<>(List.of(TestCommonConstants.PREDICT_VECTOR_ARRAY)));
+            verify(otherUserListener).onFailure(accessDenied);
+            Mockito.verify(otherUserListener, Mockito.never()).onResponse(any());
+        } finally {
+            InferenceResultCache.getInstance().setMaxEntries(0);
+        }
+    }
+
     public void testInferenceMultimodal_whenExceptionFromMLClient_thenRetry_thenFailure() {
         final NodeNotConnectedException nodeNodeConnectedException = new NodeNotConnectedException(
             mock(DiscoveryNode.class),
@@ -2357,6 +2462,8 @@ public class MLCommonsClientAccessorTests extends OpenSearchTestCase {
         assertEquals("Should return 2 embeddings", 2, result.size());
         assertEquals("First embedding should have 3 values", 3, result.get(0).size());
         assertEquals("Second embedding should have 3 values", 3, result.get(1).size());
+        assertTrue("Embeddings should be kept as primitive floats", (List<?>) result.get(0) instanceof FloatArrayList);
+        assertEquals(0.4f, ((FloatArrayList) (List<?>) result.get(1)).getFloat(0), 0.0f);
         Mockito.verifyNoMoreInteractions(resultListener);
     }
 
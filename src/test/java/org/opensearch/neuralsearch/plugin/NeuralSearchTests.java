@@ -27,6 +27,7 @@ import org.opensearch.common.util.concurrent.OpenSearchExecutors;
 import org.opensearch.common.util.concurrent.OpenSearchThreadPoolExecutor;
 import org.opensearch.core.common.breaker.CircuitBreaker;
 import org.opensearch.core.common.breaker.CircuitBreakingException;
+import org.opensearch.core.index.Index;
 import org.opensearch.env.Environment;
 import org.opensearch.index.mapper.Mapper;
 import org.opensearch.index.mapper.MappingTransformer;
@@ -126,7 +127,20 @@ public class NeuralSearchTests extends OpenSearchQueryTestCase {
                 NeuralSearchSettings.NEURAL_STATS_ENABLED,
                 NeuralSearchSettings.NEURAL_CIRCUIT_BREAKER_LIMIT,
                 NeuralSearchSettings.NEURAL_CIRCUIT_BREAKER_OVERHEAD,
-                NeuralSearchSettings.SPARSE_ALGO_PARAM_INDEX_THREAD_QTY_SETTING
+                NeuralSearchSettings.SPARSE_ALGO_PARAM_INDEX_THREAD_QTY_SETTING,
+                NeuralSearchSettings.SPARSE_WARM_CACHE_MANIFEST_INTERVAL,
+                NeuralSearchSettings.SPARSE_QUERY_RESULT_CACHE_SIZE,
+                NeuralSearchSettings.INFERENCE_RESULT_CACHE_MAX_ENTRIES,
+                NeuralSearchSettings.INFERENCE_RESULT_CACHE_TTL,
+                NeuralSearchSettings.INFERENCE_COALESCING_ENABLED,
+                NeuralSearchSettings.ML_INFERENCE_RETRY_BUDGET,
+                NeuralSearchSettings.INGEST_INFERENCE_MAX_TOKENS_PER_REQUEST,
+                NeuralSearchSettings.INGEST_INFERENCE_MAX_TEXTS_PER_REQUEST,
+                NeuralSearchSettings.INFERENCE_DISPATCHER_MAX_IN_FLIGHT,
+                NeuralSearchSettings.INFERENCE_DISPATCHER_MAX_QUEUE_SIZE,
+                NeuralSearchSettings.INFERENCE_DISPATCHER_ADAPTIVE_CONCURRENCY,
+                NeuralSearchSettings.INGEST_INFERENCE_MAX_CONCURRENT_MICRO_BATCHES,
+                NeuralSearchSettings.INGEST_INFERENCE_CACHE_SIZE
             )
         );
         when(clusterService.getClusterSettings()).thenReturn(clusterSettings);
@@ -201,7 +215,7 @@ public class NeuralSearchTests extends OpenSearchQueryTestCase {
 
     public void testGetSettings() {
         List<Setting<?>> settings = plugin.getSettings();
-        assertEquals(8, settings.size());
+        assertEquals(25, settings.size());
     }
 
     public void testRequestProcessors() {
@@ -340,10 +354,13 @@ public class NeuralSearchTests extends OpenSearchQueryTestCase {
         IndexModule indexModule = mock(IndexModule.class);
         Settings sparseIndexSettings = Settings.builder().put(SparseSettings.SPARSE_INDEX, true).build();
         when(indexModule.getSettings()).thenReturn(sparseIndexSettings);
+        when(indexModule.getIndex()).thenReturn(new Index("test-index", "test-uuid"));
 
         plugin.onIndexModule(indexModule);
 
         Mockito.verify(indexModule).addIndexEventListener(Mockito.any(SparseIndexEventListener.class));
+        Mockito.verify(indexModule).addSettingsUpdateConsumer(Mockito.eq(SparseSettings.SPARSE_MEMORY_BUDGET_SETTING), Mockito.any());
+        Mockito.verify(indexModule).addSettingsUpdateConsumer(Mockito.eq(SparseSettings.SPARSE_FIELD_MEMORY_BUDGET_SETTING), Mockito.any());
     }
 
     public void testOnIndexModuleWithNonSparseIndexSettings() {
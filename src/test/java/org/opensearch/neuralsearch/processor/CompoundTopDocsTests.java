@@ -11,9 +11,26 @@ import java.util.List;
 import org.apache.commons.lang3.RandomUtils;
 import org.apache.lucene.search.FieldDoc;
 import org.apache.lucene.search.ScoreDoc;
+import org.apache.lucene.search.SortField;
 import org.apache.lucene.search.TopDocs;
 import org.apache.lucene.search.TotalHits;
+import org.apache.lucene.search.grouping.CollapseTopFieldDocs;
+import org.apache.lucene.util.BytesRef;
+import org.opensearch.action.OriginalIndices;
+import org.opensearch.common.lucene.search.TopDocsAndMaxScore;
+import org.opensearch.core.index.shard.ShardId;
 import org.opensearch.neuralsearch.query.OpenSearchQueryTestCase;
+import org.opensearch.search.SearchShardTarget;
+import org.opensearch.search.query.QuerySearchResult;
+
+import static org.opensearch.neuralsearch.search.util.HybridSearchResultFormatUtil.MAGIC_NUMBER_DELIMITER;
+import static org.opensearch.neuralsearch.search.util.HybridSearchResultFormatUtil.MAGIC_NUMBER_START_STOP;
+import static org.opensearch.neuralsearch.search.util.HybridSearchResultFormatUtil.createCollapseValueDelimiterElementForHybridSearchResults;
+import static org.opensearch.neuralsearch.search.util.HybridSearchResultFormatUtil.createCollapseValueStartStopElementForHybridSearchResults;
+import static org.opensearch.neuralsearch.search.util.HybridSearchResultFormatUtil.createDelimiterElementForHybridSearchResults;
+import static org.opensearch.neuralsearch.search.util.HybridSearchResultFormatUtil.createFieldDocDelimiterElementForHybridSearchResults;
+import static org.opensearch.neuralsearch.search.util.HybridSearchResultFormatUtil.createFieldDocStartStopElementForHybridSearchResults;
+import static org.opensearch.neuralsearch.search.util.HybridSearchResultFormatUtil.createStartStopElementForHybridSearchResults;
 
 public class CompoundTopDocsTests extends OpenSearchQueryTestCase {
     private static final SearchShard SEARCH_SHARD = new SearchShard("my_index", 0, "12345678");
@@ -90,6 +107,84 @@ public class CompoundTopDocsTests extends OpenSearchQueryTestCase {
         assertEquals(0, compoundTopDocsWithNullArray.getScoreDocs().size());
     }
 
+    public void testBasics_whenCreateFromHybridQuerySearchResult_thenSubQueryResultsParsed() {
+        QuerySearchResult querySearchResult = createQuerySearchResult(
+            new TopDocs(
+                new TotalHits(3, TotalHits.Relation.EQUAL_TO),
+                new ScoreDoc[] {
+                    createStartStopElementForHybridSearchResults(0),
+                    createDelimiterElementForHybridSearchResults(0),
+                    new ScoreDoc(0, 0.5f),
+                    new ScoreDoc(2, 0.3f),
+                    createDelimiterElementForHybridSearchResults(0),
+                    createDelimiterElementForHybridSearchResults(0),
+                    new ScoreDoc(4, 0.25f),
+                    createStartStopElementForHybridSearchResults(0) }
+            )
+        );
+
+        CompoundTopDocs compoundTopDocs = new CompoundTopDocs(querySearchResult);
+
+        List<TopDocs> topDocs = compoundTopDocs.getTopDocs();
+        assertEquals(3, topDocs.size());
+        assertEquals(2, topDocs.get(0).totalHits.value());
+        assertEquals(0, topDocs.get(0).scoreDocs[0].doc);
+        assertEquals(2, topDocs.get(0).scoreDocs[1].doc);
+        assertEquals(0, topDocs.get(1).scoreDocs.length);
+        assertEquals(1, topDocs.get(2).scoreDocs.length);
+        assertEquals(0.25f, topDocs.get(2).scoreDocs[0].score, 0.0f);
+        assertEquals(new TotalHits(3, TotalHits.Relation.EQUAL_TO), compoundTopDocs.getTotalHits());
+        assertEquals(2, compoundTopDocs.getScoreDocs().size());
+    }
+
+    public void testBasics_whenCreateFromCollapsedHybridQuerySearchResult_thenCollapseValuesSliced() {
+        Object[] delimiterFields = new Object[] { MAGIC_NUMBER_DELIMITER };
+        Object[] startStopFields = new Object[] { MAGIC_NUMBER_START_STOP };
+        QuerySearchResult querySearchResult = createQuerySearchResult(
+            new CollapseTopFieldDocs(
+                "category",
+                new TotalHits(3, TotalHits.Relation.EQUAL_TO),
+                new ScoreDoc[] {
+                    createFieldDocStartStopElementForHybridSearchResults(0, startStopFields),
+                    createFieldDocDelimiterElementForHybridSearchResults(0, delimiterFields),
+                    new FieldDoc(0, 0.5f, new Object[] { 0.5f }),
+                    createFieldDocDelimiterElementForHybridSearchResults(0, delimiterFields),
+                    new FieldDoc(2, 0.3f, new Object[] { 0.3f }),
+                    new FieldDoc(4, 0.2f, new Object[] { 0.2f }),
+                    createFieldDocStartStopElementForHybridSearchResults(0, startStopFields) },
+                new SortField[] { SortField.FIELD_SCORE },
+                new Object[] {
+                    new BytesRef(createCollapseValueStartStopElementForHybridSearchResults()),
+                    new BytesRef(createCollapseValueDelimiterElementForHybridSearchResults()),
+                    new BytesRef("TV"),
+                    new BytesRef(createCollapseValueDelimiterElementForHybridSearchResults()),
+                    new BytesRef("Radio"),
+                    new BytesRef("TV"),
+                    new BytesRef(createCollapseValueStartStopElementForHybridSearchResults()) }
+            )
+        );
+
+        CompoundTopDocs compoundTopDocs = new CompoundTopDocs(querySearchResult);
+
+        List<TopDocs> topDocs = compoundTopDocs.getTopDocs();
+        assertEquals(2, topDocs.size());
+        CollapseTopFieldDocs firstSubQuery = (CollapseTopFieldDocs) topDocs.get(0);
+        CollapseTopFieldDocs secondSubQuery = (CollapseTopFieldDocs) topDocs.get(1);
+        assertEquals("category", firstSubQuery.field);
+        assertArrayEquals(new Object[] { new BytesRef("TV") }, firstSubQuery.collapseValues);
+        assertArrayEquals(new Object[] { new BytesRef("Radio"), new BytesRef("TV") }, secondSubQuery.collapseValues);
+        assertEquals(4, secondSubQuery.scoreDocs[1].doc);
+    }
+
+    private static QuerySearchResult createQuerySearchResult(final TopDocs topDocs) {
+        QuerySearchResult querySearchResult = new QuerySearchResult();
+        querySearchResult.topDocs(new TopDocsAndMaxScore(topDocs, 0.5f), null);
+        querySearchResult.setSearchShardTarget(
+            new SearchShardTarget("node", new ShardId("my_index", "12345678", 0), null, OriginalIndices.NONE)
+        );
+        return querySearchResult;
+    }
+
     public void testEqualsWithIdenticalCompoundTopDocs() {
         TopDocs topDocs1 = new TopDocs(new TotalHits(1, TotalHits.Relation.EQUAL_TO), new ScoreDoc[] { new ScoreDoc(1, 1.0f) });
         TopDocs topDocs2 = new TopDocs(new TotalHits(2, TotalHits.Relation.EQUAL_TO), new ScoreDoc[] { new ScoreDoc(2, 2.0f) });
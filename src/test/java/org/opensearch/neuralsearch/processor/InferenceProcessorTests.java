@@ -20,6 +20,8 @@ import org.opensearch.ingest.IngestDocument;
 import org.opensearch.ingest.IngestDocumentWrapper;
 import org.opensearch.neuralsearch.constants.TestCommonConstants;
 import org.opensearch.neuralsearch.ml.MLCommonsClientAccessor;
+import org.opensearch.neuralsearch.stats.events.EventStatName;
+import org.opensearch.neuralsearch.util.TestUtils;
 
 import java.util.ArrayList;
 import java.util.Arrays;
@@ -69,6 +71,7 @@ public class InferenceProcessorTests extends InferenceProcessorTestCase {
         environment = mock(Environment.class);
         Settings settings = Settings.builder().put("index.mapping.depth.limit", 20).build();
         when(environment.settings()).thenReturn(settings);
+        TestUtils.initializeEventStatsManager();
     }
 
     public void test_batchExecute_emptyInput() {
@@ -153,6 +156,40 @@ public class InferenceProcessorTests extends InferenceProcessorTestCase {
         assertEquals(inferenceResults.get(2), ((Map) doc2Embeddings.get(1)).get("map_key"));
     }
 
+    public void test_batchExecute_duplicateTexts_inferredOnce() {
+        final int docCount = 3;
+        List<List<Float>> inferenceResults = createMockVectorWithLength(2);
+        TestInferenceProcessor processor = new TestInferenceProcessor(inferenceResults, BATCH_SIZE, null);
+        List<IngestDocumentWrapper> wrapperList = createIngestDocumentWrappers(docCount);
+        wrapperList.get(0).getIngestDocument().setFieldValue("key1", Arrays.asList("ccc", "a"));
+        wrapperList.get(1).getIngestDocument().setFieldValue("key1", Arrays.asList("a", "ccc"));
+        wrapperList.get(2).getIngestDocument().setFieldValue("key1", Arrays.asList("ccc", "ccc"));
+        long textsBefore = EventStatName.INGEST_INFERENCE_TEXTS.getEventStat().getValue();
+        long deduplicatedBefore = EventStatName.INGEST_INFERENCE_DEDUPLICATED_TEXTS.getEventStat().getValue();
+        Consumer resultHandler = mock(Consumer.class);
+        processor.batchExecute(wrapperList, resultHandler);
+        ArgumentCaptor<List<IngestDocumentWrapper>> captor = ArgumentCaptor.forClass(List.class);
+        verify(resultHandler).accept(captor.capture());
+        assertEquals(docCount, captor.getValue().size());
+        assertEquals(List.of(List.of("a", "ccc")), processor.getAllInferenceInputs());
+
+        // inferenceResults are results for the unique texts sorted by length ("a", "ccc")
+        List<?> doc1Embeddings = (List) (captor.getValue().get(0).getIngestDocument().getFieldValue("embedding_key1", List.class));
+        List<?> doc2Embeddings = (List) (captor.getValue().get(1).getIngestDocument().getFieldValue("embedding_key1", List.class));
+        List<?> doc3Embeddings = (List) (captor.getValue().get(2).getIngestDocument().getFieldValue("embedding_key1", List.class));
+        assertEquals(inferenceResults.get(1), ((Map) doc1Embeddings.get(0)).get("map_key"));
+        assertEquals(inferenceResults.get(0), ((Map) doc1Embeddings.get(1)).get("map_key"));
+        assertEquals(inferenceResults.get(0), ((Map) doc2Embeddings.get(0)).get("map_key"));
+        assertEquals(inferenceResults.get(1), ((Map) doc2Embeddings.get(1)).get("map_key"));
+        assertEquals(inferenceResults.get(1), ((Map) doc3Embeddings.get(0)).get("map_key"));
+        assertEquals(inferenceResults.get(1), ((Map) doc3Embeddings.get(1)).get("map_key"));
+        // every document gets its own copy of a shared result
+        assertNotSame(((Map) doc1Embeddings.get(0)).get("map_key"), ((Map) doc3Embeddings.get(0)).get("map_key"));
+
+        assertEquals(6, EventStatName.INGEST_INFERENCE_TEXTS.getEventStat().getValue() - textsBefore);
+        assertEquals(4, EventStatName.INGEST_INFERENCE_DEDUPLICATED_TEXTS.getEventStat().getValue() - deduplicatedBefore);
+    }
+
     public void test_doBatchExecute_exception() {
         final int docCount = 2;
         List<List<Float>> inferenceResults = createMockVectorWithLength(6);
@@ -30,6 +30,7 @@ import org.opensearch.common.settings.Settings;
 import org.opensearch.env.Environment;
 import org.opensearch.env.TestEnvironment;
 import org.opensearch.index.analysis.AnalysisRegistry;
+import org.opensearch.neuralsearch.processor.chunker.TokenizerAnalyzerCache;
 import org.opensearch.index.analysis.TokenizerFactory;
 import org.opensearch.index.mapper.IndexFieldMapper;
 import org.opensearch.indices.analysis.AnalysisModule;
@@ -98,7 +99,11 @@ public class TextChunkingProcessorTests extends OpenSearchTestCase {
         when(metadata.index(anyString())).thenReturn(null);
         when(clusterState.metadata()).thenReturn(metadata);
         when(clusterService.state()).thenReturn(clusterState);
-        textChunkingProcessorFactory = new TextChunkingProcessorFactory(environment, clusterService, getAnalysisRegistry());
+        textChunkingProcessorFactory = new TextChunkingProcessorFactory(
+            environment,
+            clusterService,
+            new TokenizerAnalyzerCache(getAnalysisRegistry())
+        );
 
         TestUtils.initializeEventStatsManager();
     }
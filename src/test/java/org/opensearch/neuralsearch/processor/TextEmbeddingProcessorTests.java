@@ -10,6 +10,7 @@ import static org.mockito.Mockito.RETURNS_DEEP_STUBS;
 import static org.mockito.Mockito.doAnswer;
 import static org.mockito.Mockito.doThrow;
 import static org.mockito.Mockito.mock;
+import static org.mockito.Mockito.never;
 import static org.mockito.Mockito.times;
 import static org.mockito.Mockito.when;
 import static org.mockito.Mockito.verify;
@@ -57,6 +58,7 @@ import org.opensearch.ingest.IngestDocumentWrapper;
 import org.opensearch.ingest.Processor;
 import org.opensearch.neuralsearch.ml.MLCommonsClientAccessor;
 import org.opensearch.neuralsearch.processor.factory.TextEmbeddingProcessorFactory;
+import org.opensearch.neuralsearch.processor.optimization.ContentHash;
 
 import com.google.common.collect.ImmutableList;
 import com.google.common.collect.ImmutableMap;
@@ -2689,4 +2691,126 @@ public class TextEmbeddingProcessorTests extends InferenceProcessorTestCase {
         verify(resultHandler).accept(resultCaptor.capture());
         assertEquals(docCount, resultCaptor.getValue().size());
     }
+
+    public void testExecute_withContentHashField_whenNoContentHash_thenEmbeddingsGeneratedAndContentHashStored() {
+        Map<String, Object> sourceAndMetadata = new HashMap<>();
+        sourceAndMetadata.put(IndexFieldMapper.NAME, "my_index");
+        sourceAndMetadata.put("_id", "1");
+        sourceAndMetadata.put("key1", "value1");
+        sourceAndMetadata.put("key2", "value2");
+        IngestDocument ingestDocument = new IngestDocument(sourceAndMetadata, new HashMap<>());
+        List<String> inferenceList = List.of("value1", "value2");
+        TextInferenceRequest ingestRequest = TextInferenceRequest.builder().modelId("mockModelId").inputTexts(inferenceList).build();
+
+        TextEmbeddingProcessor processor = createInstanceWithContentHashConfig(false);
+        mockVectorCreation(ingestRequest, null);
+        BiConsumer handler = mock(BiConsumer.class);
+        processor.execute(ingestDocument, handler);
+
+        verify(handler).accept(any(IngestDocument.class), isNull());
+        verify(mlCommonsClientAccessor).inferenceSentences(inferenceRequestCaptor.capture(), isA(ActionListener.class));
+        assertEquals(inferenceList, inferenceRequestCaptor.getValue().getInputTexts());
+        assertEquals(ContentHash.of("mockModelId", inferenceList), ingestDocument.getSourceAndMetadata().get("content_hash"));
+        assertNotNull(ingestDocument.getSourceAndMetadata().get("key1_knn"));
+        assertNotNull(ingestDocument.getSourceAndMetadata().get("key2_knn"));
+    }
+
+    public void testExecute_withContentHashField_whenContentHashMatches_thenCarriedEmbeddingsReusedWithoutFetch() {
+        List<Float> key1Embedding = List.of(1.0f, 2.0f);
+        List<Float> key2Embedding = List.of(3.0f, 4.0f);
+        Map<String, Object> sourceAndMetadata = new HashMap<>();
+        sourceAndMetadata.put(IndexFieldMapper.NAME, "my_index");
+        sourceAndMetadata.put("_id", "1");
+        sourceAndMetadata.put("key1", "value1");
+        sourceAndMetadata.put("key2", "value2");
+        sourceAndMetadata.put("key1_knn", key1Embedding);
+        sourceAndMetadata.put("key2_knn", key2Embedding);
+        sourceAndMetadata.put("content_hash", ContentHash.of("mockModelId", List.of("value1", "value2")));
+        IngestDocument ingestDocument = new IngestDocument(sourceAndMetadata, new HashMap<>());
+
+        TextEmbeddingProcessor processor = createInstanceWithContentHashConfig(true);
+        BiConsumer handler = mock(BiConsumer.class);
+        processor.execute(ingestDocument, handler);
+
+        verify(handler).accept(any(IngestDocument.class), isNull());
+        verify(openSearchClient, never()).execute(isA(GetAction.class), isA(GetRequest.class), isA(ActionListener.class));
+        verify(mlCommonsClientAccessor, never()).inferenceSentences(isA(TextInferenceRequest.class), isA(ActionListener.class));
+        assertEquals(key1Embedding, ingestDocument.getSourceAndMetadata().get("key1_knn"));
+        assertEquals(key2Embedding, ingestDocument.getSourceAndMetadata().get("key2_knn"));
+    }
+
+    public void testExecute_withContentHashField_whenTextChanged_thenExistingDocumentFetched() {
+        Map<String, Object> sourceAndMetadata = new HashMap<>();
+        sourceAndMetadata.put(IndexFieldMapper.NAME, "my_index");
+        sourceAndMetadata.put("_id", "1");
+        sourceAndMetadata.put("key1", "value1");
+        sourceAndMetadata.put("key2", "newValue");
+        sourceAndMetadata.put("key1_knn", List.of(1.0f, 2.0f));
+        sourceAndMetadata.put("key2_knn", List.of(3.0f, 4.0f));
+        sourceAndMetadata.put("content_hash", ContentHash.of("mockModelId", List.of("value1", "value2")));
+        IngestDocument ingestDocument = new IngestDocument(sourceAndMetadata, new HashMap<>());
+        List<String> inferenceList = List.of("value1", "newValue");
+        TextInferenceRequest ingestRequest = TextInferenceRequest.builder().modelId("mockModelId").inputTexts(inferenceList).build();
+
+        TextEmbeddingProcessor processor = createInstanceWithContentHashConfig(true);
+        mockUpdateDocument(ingestDocument);
+        mockVectorCreation(ingestRequest, null);
+        BiConsumer handler = mock(BiConsumer.class);
+        processor.execute(ingestDocument, handler);
+
+        verify(handler).accept(any(IngestDocument.class), isNull());
+        verify(openSearchClient).execute(isA(GetAction.class), isA(GetRequest.class), isA(ActionListener.class));
+        verify(mlCommonsClientAccessor).inferenceSentences(inferenceRequestCaptor.capture(), isA(ActionListener.class));
+        assertEquals(inferenceList, inferenceRequestCaptor.getValue().getInputTexts());
+        assertEquals(ContentHash.of("mockModelId", inferenceList), ingestDocument.getSourceAndMetadata().get("content_hash"));
+    }
+
+    public void testBatchExecute_withContentHashField_whenContentHashMatches_thenOnlyOtherDocumentsFetched() {
+        List<IngestDocumentWrapper> ingestDocumentWrappers = createIngestDocumentWrappers(2, "key1", "value1", "key2", "value2");
+        Map<String, Object> carryingSource = ingestDocumentWrappers.get(0).getIngestDocument().getSourceAndMetadata();
+        carryingSource.put("key1_knn", List.of(1.0f, 2.0f));
+        carryingSource.put("key2_knn", List.of(3.0f, 4.0f));
+        carryingSource.put("content_hash", ContentHash.of("mockModelId", List.of("value1", "value2")));
+        TextEmbeddingProcessor processor = createInstanceWithContentHashConfig(true);
+
+        ArgumentCaptor<MultiGetRequest> multiGetRequestCaptor = ArgumentCaptor.forClass(MultiGetRequest.class);
+        doAnswer(invocation -> {
+            ActionListener<MultiGetResponse> listener = invocation.getArgument(2);
+            listener.onResponse(mockEmptyMultiGetItemResponse());
+            return null;
+        }).when(openSearchClient).execute(isA(MultiGetAction.class), multiGetRequestCaptor.capture(), isA(ActionListener.class));
+        doAnswer(invocation -> {
+            TextInferenceRequest request = invocation.getArgument(0);
+            ActionListener<List<List<Float>>> listener = invocation.getArgument(1);
+            listener.onResponse(createRandomOneDimensionalMockVector(request.getInputTexts().size(), 2, 0.0f, 1.0f));
+            return null;
+        }).when(mlCommonsClientAccessor).inferenceSentences(inferenceRequestCaptor.capture(), isA(ActionListener.class));
+
+        Consumer resultHandler = mock(Consumer.class);
+        processor.batchExecute(ingestDocumentWrappers, resultHandler);
+
+        verify(resultHandler).accept(any());
+        assertEquals(1, multiGetRequestCaptor.getValue().getItems().size());
+        assertEquals("2", multiGetRequestCaptor.getValue().getItems().get(0).id());
+        assertEquals(List.of("value1", "value2"), inferenceRequestCaptor.getValue().getInputTexts());
+        assertEquals(List.of(1.0f, 2.0f), carryingSource.get("key1_knn"));
+        for (IngestDocumentWrapper ingestDocumentWrapper : ingestDocumentWrappers) {
+            Map<String, Object> source = ingestDocumentWrapper.getIngestDocument().getSourceAndMetadata();
+            assertNull(ingestDocumentWrapper.getException());
+            assertEquals(ContentHash.of("mockModelId", List.of("value1", "value2")), source.get("content_hash"));
+            assertNotNull(source.get("key2_knn"));
+        }
+    }
+
+    @SneakyThrows
+    private TextEmbeddingProcessor createInstanceWithContentHashConfig(boolean skipExisting) {
+        Map<String, Processor.Factory> registry = new HashMap<>();
+        Map<String, Object> config = new HashMap<>();
+        config.put(TextEmbeddingProcessor.MODEL_ID_FIELD, "mockModelId");
+        config.put(TextEmbeddingProcessor.FIELD_MAP_FIELD, ImmutableMap.of("key1", "key1_knn", "key2", "key2_knn"));
+        config.put(TextEmbeddingProcessor.SKIP_EXISTING, skipExisting);
+        config.put(TextEmbeddingProcessor.CONTENT_HASH_FIELD, "content_hash");
+        config.put(AbstractBatchingProcessor.BATCH_SIZE_FIELD, 2);
+        return (TextEmbeddingProcessor) textEmbeddingProcessorFactory.create(registry, PROCESSOR_TAG, DESCRIPTION, config);
+    }
 }
@@ -4,19 +4,18 @@
  */
 package org.opensearch.neuralsearch.processor.chunker;
 
-import org.mockito.Mock;
 import org.opensearch.index.analysis.AnalysisRegistry;
 import org.opensearch.test.OpenSearchTestCase;
 
 import java.util.HashMap;
 import java.util.Map;
 
-import static org.opensearch.neuralsearch.processor.chunker.FixedTokenLengthChunker.ANALYSIS_REGISTRY_FIELD;
+import static org.mockito.Mockito.mock;
+import static org.opensearch.neuralsearch.processor.chunker.FixedTokenLengthChunker.ANALYZER_CACHE_FIELD;
 
 public class ChunkerFactoryTests extends OpenSearchTestCase {
 
-    @Mock
-    private AnalysisRegistry analysisRegistry;
+    private final TokenizerAnalyzerCache analyzerCache = new TokenizerAnalyzerCache(mock(AnalysisRegistry.class));
 
     public void testCreate_FixedTokenLength() {
         Chunker chunker = ChunkerFactory.create(FixedTokenLengthChunker.ALGORITHM_NAME, createChunkParameters());
@@ -43,7 +42,7 @@ public class ChunkerFactoryTests extends OpenSearchTestCase {
 
     private Map<String, Object> createChunkParameters() {
         Map<String, Object> parameters = new HashMap<>();
-        parameters.put(ANALYSIS_REGISTRY_FIELD, analysisRegistry);
+        parameters.put(ANALYZER_CACHE_FIELD, analyzerCache);
         return parameters;
     }
 }
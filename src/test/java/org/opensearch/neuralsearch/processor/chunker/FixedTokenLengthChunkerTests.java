@@ -26,7 +26,7 @@ import static java.util.Collections.singletonMap;
 import static org.opensearch.neuralsearch.processor.chunker.Chunker.MAX_CHUNK_LIMIT_FIELD;
 import static org.opensearch.neuralsearch.processor.chunker.Chunker.CHUNK_STRING_COUNT_FIELD;
 import static org.opensearch.neuralsearch.processor.chunker.FixedTokenLengthChunker.ALGORITHM_NAME;
-import static org.opensearch.neuralsearch.processor.chunker.FixedTokenLengthChunker.ANALYSIS_REGISTRY_FIELD;
+import static org.opensearch.neuralsearch.processor.chunker.FixedTokenLengthChunker.ANALYZER_CACHE_FIELD;
 import static org.opensearch.neuralsearch.processor.chunker.FixedTokenLengthChunker.TOKEN_LIMIT_FIELD;
 import static org.opensearch.neuralsearch.processor.chunker.FixedTokenLengthChunker.OVERLAP_RATE_FIELD;
 import static org.opensearch.neuralsearch.processor.chunker.FixedTokenLengthChunker.TOKENIZER_FIELD;
@@ -69,7 +69,7 @@ public class FixedTokenLengthChunkerTests extends OpenSearchTestCase {
             }
         };
         AnalysisRegistry analysisRegistry = new AnalysisModule(environment, singletonList(plugin)).getAnalysisRegistry();
-        nonRuntimeParameters.put(ANALYSIS_REGISTRY_FIELD, analysisRegistry);
+        nonRuntimeParameters.put(ANALYZER_CACHE_FIELD, new TokenizerAnalyzerCache(analysisRegistry));
         return new FixedTokenLengthChunker(nonRuntimeParameters);
     }
 
@@ -77,6 +77,14 @@ public class FixedTokenLengthChunkerTests extends OpenSearchTestCase {
         fixedTokenLengthChunker.parse(Map.of());
     }
 
+    public void testConstruct_whenAnalyzerCacheMissing_thenFail() {
+        NullPointerException exception = assertThrows(NullPointerException.class, () -> new FixedTokenLengthChunker(new HashMap<>()));
+        assertEquals(
+            String.format(Locale.ROOT, "Parameter [%s] is required to create the %s chunker", ANALYZER_CACHE_FIELD, ALGORITHM_NAME),
+            exception.getMessage()
+        );
+    }
+
     public void testParseParameters_whenIllegalTokenLimitType_thenFail() {
         Map<String, Object> parameters = new HashMap<>();
         parameters.put(TOKEN_LIMIT_FIELD, "invalid token limit");
@@ -310,6 +318,38 @@ public class FixedTokenLengthChunkerTests extends OpenSearchTestCase {
         assertEquals(expectedPassages, passages);
     }
 
+    public void testChunk_whenExceedMaxTokenCount_thenFail() {
+        Map<String, Object> runtimeParameters = new HashMap<>(this.runtimeParameters);
+        runtimeParameters.put(MAX_TOKEN_COUNT_FIELD, 10);
+        String content =
+            "This is an example document to be chunked. The document contains a single paragraph, two sentences and 24 tokens by standard tokenizer in OpenSearch.";
+        IllegalStateException illegalStateException = assertThrows(
+            IllegalStateException.class,
+            () -> fixedTokenLengthChunker.chunk(content, runtimeParameters)
+        );
+        assertTrue(
+            illegalStateException.getMessage()
+                .contains("The number of tokens produced by calling _analyze has exceeded the allowed maximum of [10].")
+        );
+    }
+
+    public void testChunk_whenChunkedRepeatedly_thenAnalyzerReused() {
+        Map<String, Object> parameters = new HashMap<>();
+        parameters.put(TOKEN_LIMIT_FIELD, 10);
+        FixedTokenLengthChunker fixedTokenLengthChunker = createFixedTokenLengthChunker(parameters);
+        String content =
+            "This is an example document to be chunked. The document contains a single paragraph, two sentences and 24 tokens by standard tokenizer in OpenSearch.";
+        List<String> expectedPassages = List.of(
+            "This is an example document to be chunked. The document ",
+            "contains a single paragraph, two sentences and 24 tokens by ",
+            "standard tokenizer in OpenSearch."
+        );
+        for (int i = 0; i < 3; i++) {
+            assertEquals(expectedPassages, fixedTokenLengthChunker.chunk(content, runtimeParameters));
+        }
+        assertEquals(List.of("Another short document."), fixedTokenLengthChunker.chunk("Another short document.", runtimeParameters));
+    }
+
     public void testValidateParameters_whenInvalidTokenizer_thenThrowException() {
         final Validator validator = new FixedTokenLengthChunker();
         final IllegalArgumentException exception = assertThrows(
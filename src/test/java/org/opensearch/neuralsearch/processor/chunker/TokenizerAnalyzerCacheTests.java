@@ -0,0 +1,38 @@
+/*
+ * Copyright OpenSearch Contributors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+package org.opensearch.neuralsearch.processor.chunker;
+
+import lombok.SneakyThrows;
+import org.apache.lucene.analysis.Analyzer;
+import org.opensearch.test.OpenSearchTestCase;
+
+import static org.opensearch.neuralsearch.processor.TextChunkingProcessorTests.getAnalysisRegistry;
+
+public class TokenizerAnalyzerCacheTests extends OpenSearchTestCase {
+
+    @SneakyThrows
+    public void testGetAnalyzer_whenSameTokenizer_thenAnalyzerBuiltOnce() {
+        try (TokenizerAnalyzerCache analyzerCache = new TokenizerAnalyzerCache(getAnalysisRegistry())) {
+            Analyzer analyzer = analyzerCache.getAnalyzer("standard");
+
+            assertSame(analyzer, analyzerCache.getAnalyzer("standard"));
+            assertEquals(1, analyzerCache.size());
+            assertNotSame(analyzer, analyzerCache.getAnalyzer("keyword"));
+            assertEquals(2, analyzerCache.size());
+        }
+    }
+
+    @SneakyThrows
+    public void testClose_thenAnalyzersReleasedAndCacheUnusable() {
+        TokenizerAnalyzerCache analyzerCache = new TokenizerAnalyzerCache(getAnalysisRegistry());
+        analyzerCache.getAnalyzer("standard");
+
+        analyzerCache.close();
+
+        assertEquals(0, analyzerCache.size());
+        IllegalStateException exception = assertThrows(IllegalStateException.class, () -> analyzerCache.getAnalyzer("standard"));
+        assertEquals("tokenizer analyzer cache is closed", exception.getMessage());
+    }
+}
@@ -0,0 +1,114 @@
+/*
+ * Copyright OpenSearch Contributors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+package org.opensearch.neuralsearch.processor.combination;
+
+import org.apache.lucene.search.ScoreDoc;
+import org.apache.lucene.search.TopDocs;
+import org.apache.lucene.search.TotalHits;
+import org.opensearch.neuralsearch.query.OpenSearchQueryTestCase;
+
+import java.util.ArrayList;
+import java.util.Comparator;
+import java.util.HashMap;
+import java.util.List;
+import java.util.Map;
+
+public class DocScoresTableTests extends OpenSearchQueryTestCase {
+    private final ScoreCombinationTechnique sumTechnique = new ScoreCombinationTechnique() {
+        @Override
+        public float combine(final float[] scores) {
+            float sum = 0.0f;
+            for (float score : scores) {
+                sum += score;
+            }
+            return sum;
+        }
+
+        @Override
+        public String techniqueName() {
+            return "sum";
+        }
+    };
+
+    public void testCombine_whenDocInSeveralSubQueries_thenScoresCombined() {
+        DocScoresTable table = DocScoresTable.of(
+            List.of(
+                topDocs(new ScoreDoc(1, 0.5f), new ScoreDoc(2, 0.2f)),
+                topDocs(new ScoreDoc(2, 0.6f), new ScoreDoc(3, 0.1f)),
+                topDocs()
+            )
+        );
+
+        table.combine(sumTechnique, null);
+
+        assertEquals(3, table.size());
+        assertEquals(3, table.matchingSize());
+        assertEquals(0.5f, table.getCombinedScore(1), DELTA_FOR_ASSERTION);
+        assertEquals(0.8f, table.getCombinedScore(2), DELTA_FOR_ASSERTION);
+        assertEquals(0.1f, table.getCombinedScore(3), DELTA_FOR_ASSERTION);
+        assertArrayEquals(new int[] { 2, 1, 3 }, table.getTopDocIds(Long.MAX_VALUE));
+        expectThrows(IllegalArgumentException.class, () -> table.getCombinedScore(4));
+    }
+
+    public void testCombine_whenMinScore_thenOnlyMatchingDocsSelected() {
+        DocScoresTable table = DocScoresTable.of(List.of(topDocs(new ScoreDoc(1, 0.5f), new ScoreDoc(2, 0.2f), new ScoreDoc(3, 0.3f))));
+
+        table.combine(sumTechnique, 0.3f);
+
+        assertEquals(3, table.size());
+        assertEquals(2, table.matchingSize());
+        assertTrue(table.isMatching(1));
+        assertFalse(table.isMatching(2));
+        assertTrue(table.isMatching(3));
+        assertFalse(table.isMatching(4));
+        assertArrayEquals(new int[] { 1, 3 }, table.getTopDocIds(10));
+    }
+
+    public void testGetTopDocIds_whenTiedScores_thenOrderedByDocId() {
+        DocScoresTable table = DocScoresTable.of(List.of(topDocs(new ScoreDoc(7, 0.5f), new ScoreDoc(3, 0.5f), new ScoreDoc(5, 0.9f))));
+
+        table.combine(sumTechnique, null);
+
+        assertArrayEquals(new int[] { 5, 3, 7 }, table.getTopDocIds(3));
+        assertArrayEquals(new int[] { 5, 3 }, table.getTopDocIds(2));
+        assertArrayEquals(new int[0], table.getTopDocIds(0));
+    }
+
+    public void testGetTopDocIds_whenManyDocs_thenSameAsFullSort() {
+        int numberOfSubQueries = randomIntBetween(1, 4);
+        List<TopDocs> topDocsPerSubQuery = new ArrayList<>();
+        Map<Integer, Float> expectedScores = new HashMap<>();
+        for (int subQueryIndex = 0; subQueryIndex < numberOfSubQueries; subQueryIndex++) {
+            List<ScoreDoc> scoreDocs = new ArrayList<>();
+            for (int doc = 0; doc < 2000; doc++) {
+                if (randomBoolean()) {
+                    // coarse scores produce ties
+                    float score = randomIntBetween(0, 20) / 20.0f;
+                    scoreDocs.add(new ScoreDoc(doc * 31, score));
+                    expectedScores.merge(doc * 31, score, Float::sum);
+                }
+            }
+            topDocsPerSubQuery.add(topDocs(scoreDocs.toArray(new ScoreDoc[0])));
+        }
+        List<Integer> expectedDocIds = new ArrayList<>(expectedScores.keySet());
+        expectedDocIds.sort(Comparator.comparing((Integer docId) -> expectedScores.get(docId)).reversed().thenComparing(docId -> docId));
+        int maxDocs = randomIntBetween(0, expectedDocIds.size() + 10);
+
+        DocScoresTable table = DocScoresTable.of(topDocsPerSubQuery);
+        table.combine(sumTechnique, null);
+        int[] topDocIds = table.getTopDocIds(maxDocs);
+
+        assertEquals(expectedScores.size(), table.size());
+        assertEquals(Math.min(maxDocs, expectedDocIds.size()), topDocIds.length);
+        for (int i = 0; i < topDocIds.length; i++) {
+            assertEquals(expectedDocIds.get(i).intValue(), topDocIds[i]);
+            assertEquals(expectedScores.get(topDocIds[i]), table.getCombinedScore(topDocIds[i]), DELTA_FOR_ASSERTION);
+        }
+    }
+
+    private static TopDocs topDocs(ScoreDoc... scoreDocs) {
+        return new TopDocs(new TotalHits(scoreDocs.length, TotalHits.Relation.EQUAL_TO), scoreDocs);
+    }
+}
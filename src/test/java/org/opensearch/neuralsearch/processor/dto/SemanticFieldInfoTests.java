@@ -5,6 +5,7 @@
 package org.opensearch.neuralsearch.processor.dto;
 
 import org.opensearch.index.analysis.AnalysisRegistry;
+import org.opensearch.neuralsearch.processor.chunker.TokenizerAnalyzerCache;
 import org.opensearch.neuralsearch.mapper.dto.ChunkingConfig;
 import org.opensearch.neuralsearch.processor.TextChunkingProcessorTests;
 import org.opensearch.neuralsearch.processor.chunker.FixedTokenLengthChunker;
@@ -75,7 +76,7 @@ public class SemanticFieldInfoTests extends OpenSearchTestCase {
             .configs(List.of(Map.of(ALGORITHM_FIELD, FixedTokenLengthChunker.ALGORITHM_NAME)))
             .build();
         SemanticFieldInfo semanticFieldInfo = SemanticFieldInfo.builder().build();
-        semanticFieldInfo.setChunkingConfig(chunkingConfig, analysisRegistry);
+        semanticFieldInfo.setChunkingConfig(chunkingConfig, new TokenizerAnalyzerCache(analysisRegistry));
 
         assertTrue(semanticFieldInfo.getChunkingEnabled());
         assertEquals(1, semanticFieldInfo.getChunkers().size());
@@ -10,9 +10,9 @@ import org.mockito.MockitoAnnotations;
 import org.opensearch.cluster.service.ClusterService;
 import org.opensearch.common.settings.Settings;
 import org.opensearch.env.Environment;
-import org.opensearch.index.analysis.AnalysisRegistry;
 import org.opensearch.neuralsearch.mapper.SemanticFieldMapper;
 import org.opensearch.neuralsearch.ml.MLCommonsClientAccessor;
+import org.opensearch.neuralsearch.processor.chunker.TokenizerAnalyzerCache;
 import org.opensearch.neuralsearch.processor.semantic.SemanticFieldProcessor;
 import org.opensearch.test.OpenSearchTestCase;
 import org.opensearch.transport.client.OpenSearchClient;
@@ -47,8 +47,8 @@ public class SemanticFieldProcessorFactoryTests extends OpenSearchTestCase {
     public void setup() {
         MockitoAnnotations.openMocks(this);
         // analysisRegistry is a final class so use a real one
-        AnalysisRegistry analysisRegistry = getAnalysisRegistry();
-        factory = new SemanticFieldProcessorFactory(mlClientAccessor, environment, clusterService, analysisRegistry, openSearchClient);
+        TokenizerAnalyzerCache analyzerCache = new TokenizerAnalyzerCache(getAnalysisRegistry());
+        factory = new SemanticFieldProcessorFactory(mlClientAccessor, environment, clusterService, analyzerCache, openSearchClient);
     }
 
     public void testNewProcessor_noMappings_thenReturnNull() {
@@ -18,6 +18,7 @@ import org.opensearch.common.settings.Settings;
 import org.opensearch.env.Environment;
 import org.opensearch.env.TestEnvironment;
 import org.opensearch.index.analysis.AnalysisRegistry;
+import org.opensearch.neuralsearch.processor.chunker.TokenizerAnalyzerCache;
 import org.opensearch.index.analysis.TokenizerFactory;
 import org.opensearch.indices.analysis.AnalysisModule;
 import org.opensearch.ingest.Processor;
@@ -61,7 +62,11 @@ public class TextChunkingProcessorFactoryTests extends OpenSearchTestCase {
     public void setup() {
         Environment environment = mock(Environment.class);
         ClusterService clusterService = mock(ClusterService.class);
-        this.textChunkingProcessorFactory = new TextChunkingProcessorFactory(environment, clusterService, getAnalysisRegistry());
+        this.textChunkingProcessorFactory = new TextChunkingProcessorFactory(
+            environment,
+            clusterService,
+            new TokenizerAnalyzerCache(getAnalysisRegistry())
+        );
     }
 
     @SneakyThrows
@@ -21,8 +21,11 @@ import org.opensearch.search.SearchShardTarget;
 
 import java.math.BigDecimal;
 import java.math.RoundingMode;
+import java.util.ArrayList;
 import java.util.Arrays;
 import java.util.Collections;
+import java.util.Comparator;
+import java.util.HashMap;
 import java.util.List;
 import java.util.Map;
 
@@ -245,6 +248,56 @@ public class RRFNormalizationTechniqueTests extends OpenSearchQueryTestCase {
         }
     }
 
+    public void testNormalization_whenManyShards_thenRanksMatchGlobalSortOrder() {
+        RRFNormalizationTechnique normalizationTechnique = new RRFNormalizationTechnique(Map.of(), scoreNormalizationUtil);
+        int numberOfShards = randomIntBetween(2, 20);
+        int numberOfSubQueries = randomIntBetween(1, 3);
+        List<CompoundTopDocs> compoundTopDocs = new ArrayList<>();
+        for (int shard = 0; shard < numberOfShards; shard++) {
+            List<TopDocs> topDocsList = new ArrayList<>();
+            for (int subQuery = 0; subQuery < numberOfSubQueries; subQuery++) {
+                // coarse scores and overlapping doc ids produce ties across shards
+                ScoreDoc[] scoreDocs = new ScoreDoc[randomIntBetween(0, 10)];
+                for (int i = 0; i < scoreDocs.length; i++) {
+                    scoreDocs[i] = new ScoreDoc(i, randomIntBetween(0, 4) / 4.0f);
+                }
+                // shard results with a random order must be ranked like sorted ones
+                if (randomBoolean()) {
+                    Arrays.sort(scoreDocs, ScoreDoc.COMPARATOR);
+                }
+                topDocsList.add(new TopDocs(new TotalHits(scoreDocs.length, TotalHits.Relation.EQUAL_TO), scoreDocs));
+            }
+            compoundTopDocs.add(new CompoundTopDocs(new TotalHits(0, TotalHits.Relation.EQUAL_TO), topDocsList, false, SEARCH_SHARD));
+        }
+        // expected rank of every document by sorting the documents of a subquery of all shards
+        Map<ScoreDoc, Float> expectedScores = new HashMap<>();
+        for (int subQuery = 0; subQuery < numberOfSubQueries; subQuery++) {
+            List<Pair<Integer, ScoreDoc>> subQueryScoreDocs = new ArrayList<>();
+            for (int shard = 0; shard < numberOfShards; shard++) {
+                ScoreDoc[] scoreDocs = compoundTopDocs.get(shard).getTopDocs().get(subQuery).scoreDocs;
+                for (ScoreDoc scoreDoc : scoreDocs) {
+                    subQueryScoreDocs.add(Pair.of(shard, scoreDoc));
+                }
+            }
+            subQueryScoreDocs.sort(
+                Comparator.comparing((Pair<Integer, ScoreDoc> pair) -> pair.getRight(), ScoreDoc.COMPARATOR)
+                    .thenComparing(Pair::getLeft)
+            );
+            for (int rank = 0; rank < subQueryScoreDocs.size(); rank++) {
+                expectedScores.put(subQueryScoreDocs.get(rank).getRight(), (float) (1.0d / (RANK_CONSTANT + rank + 1)));
+            }
+        }
+
+        normalizationTechnique.normalize(
+            NormalizeScoresDTO.builder().queryTopDocs(compoundTopDocs).normalizationTechnique(normalizationTechnique).build()
+        );
+
+        for (Map.Entry<ScoreDoc, Float> expectedScore : expectedScores.entrySet()) {
+            // scores of adjacent ranks differ by less than the usual assertion delta
+            assertEquals(expectedScore.getValue(), expectedScore.getKey().score, 0.0f);
+        }
+    }
+
     public void testNormalizedScoresAreSetAtCorrectIndices() {
         // Setup test data
         SearchShardTarget shardTarget = new SearchShardTarget("node1", new ShardId("index", "_na_", 0), null, null);
@@ -0,0 +1,59 @@
+/*
+ * Copyright OpenSearch Contributors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+package org.opensearch.neuralsearch.processor.normalization;
+
+import org.apache.commons.math3.stat.descriptive.DescriptiveStatistics;
+import org.opensearch.test.OpenSearchTestCase;
+
+public class ScoreStatisticsTests extends OpenSearchTestCase {
+
+    public void testAdd_whenRangesOfManyShards_thenSameAsDescriptiveStatistics() {
+        float[] scores = new float[randomIntBetween(1, 1000)];
+        DescriptiveStatistics expected = new DescriptiveStatistics();
+        for (int i = 0; i < scores.length; i++) {
+            scores[i] = 50.0f + randomFloat();
+            expected.addValue(scores[i]);
+        }
+        ScoreStatistics statistics = new ScoreStatistics();
+
+        int from = 0;
+        while (from < scores.length) {
+            int to = randomIntBetween(from, scores.length);
+            statistics.add(scores, from, to);
+            from = to;
+        }
+
+        assertEquals(scores.length, statistics.getCount());
+        assertEquals((float) expected.getMin(), statistics.getMin(), 0.0f);
+        assertEquals((float) expected.getMax(), statistics.getMax(), 0.0f);
+        float expectedMean = (float) expected.getMean();
+        assertEquals(expectedMean, statistics.getMean(), 2 * Math.ulp(expectedMean));
+        assertEquals((float) expected.getStandardDeviation(), statistics.getStandardDeviation(), 0.0001f);
+    }
+
+    public void testAdd_whenEqualScoresAcrossShards_thenExactMeanAndNoDeviation() {
+        float[] scores = new float[] { 0.7f, 0.7f, 0.7f };
+        ScoreStatistics statistics = new ScoreStatistics();
+
+        statistics.add(scores, 0, 1);
+        statistics.add(scores, 1, 3);
+
+        assertEquals(0.7f, statistics.getMean(), 0.0f);
+        assertEquals(0.0f, statistics.getStandardDeviation(), 0.0f);
+    }
+
+    public void testGetters_whenNoScores_thenEmptyStatistics() {
+        ScoreStatistics statistics = new ScoreStatistics();
+
+        statistics.add(new float[] { 1.0f }, 1, 1);
+
+        assertEquals(0, statistics.getCount());
+        assertEquals(Float.POSITIVE_INFINITY, statistics.getMin(), 0.0f);
+        assertEquals(Float.NEGATIVE_INFINITY, statistics.getMax(), 0.0f);
+        assertEquals(0.0f, statistics.getL2Norm(), 0.0f);
+        assertTrue(Float.isNaN(statistics.getMean()));
+        assertTrue(Float.isNaN(statistics.getStandardDeviation()));
+    }
+}
@@ -0,0 +1,136 @@
+/*
+ * Copyright OpenSearch Contributors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+package org.opensearch.neuralsearch.processor.normalization;
+
+import org.apache.commons.math3.stat.descriptive.DescriptiveStatistics;
+import org.apache.lucene.search.ScoreDoc;
+import org.apache.lucene.search.TopDocs;
+import org.apache.lucene.search.TotalHits;
+import org.opensearch.neuralsearch.processor.CompoundTopDocs;
+import org.opensearch.neuralsearch.processor.SearchShard;
+import org.opensearch.neuralsearch.query.OpenSearchQueryTestCase;
+
+import java.util.ArrayList;
+import java.util.Arrays;
+import java.util.List;
+
+public class SubQueryScoresTests extends OpenSearchQueryTestCase {
+    private static final float DELTA_FOR_STATISTICS = 0.0001f;
+
+    public void testOf_whenManyShards_thenScoresGatheredInShardOrderAndNullsSkipped() {
+        List<CompoundTopDocs> queryTopDocs = Arrays.asList(
+            compoundTopDocs(0, topDocs(0.5f, 0.2f), topDocs(0.9f)),
+            null,
+            compoundTopDocs(1, topDocs(0.7f), topDocs())
+        );
+
+        SubQueryScores subQueryScores = SubQueryScores.of(queryTopDocs);
+
+        assertEquals(2, subQueryScores.getNumberOfSubQueries());
+        assertArrayEquals(new float[] { 0.5f, 0.2f, 0.7f }, subQueryScores.getScores(0), 0.0f);
+        assertArrayEquals(new float[] { 0.9f }, subQueryScores.getScores(1), 0.0f);
+        assertEquals(0.2f, subQueryScores.getStatistics(0).getMin(), 0.0f);
+        assertEquals(0.7f, subQueryScores.getStatistics(0).getMax(), 0.0f);
+        assertEquals(0.9f, subQueryScores.getStatistics(1).getMean(), 0.0f);
+        assertEquals(0.0f, subQueryScores.getStatistics(1).getStandardDeviation(), 0.0f);
+    }
+
+    public void testOf_whenSubQueryHasNoScores_thenNoStatistics() {
+        SubQueryScores subQueryScores = SubQueryScores.of(List.of(compoundTopDocs(0, topDocs(0.5f), topDocs())));
+
+        assertEquals(0, subQueryScores.getScores(1).length);
+        assertEquals(Float.POSITIVE_INFINITY, subQueryScores.getStatistics(1).getMin(), 0.0f);
+        assertEquals(Float.NEGATIVE_INFINITY, subQueryScores.getStatistics(1).getMax(), 0.0f);
+        assertEquals(0.0f, subQueryScores.getStatistics(1).getL2Norm(), 0.0f);
+        assertTrue(Float.isNaN(subQueryScores.getStatistics(1).getMean()));
+        assertTrue(Float.isNaN(subQueryScores.getStatistics(1).getStandardDeviation()));
+    }
+
+    public void testOf_whenRandomScores_thenStatisticsSameAsDescriptiveStatistics() {
+        int numberOfSubQueries = randomIntBetween(1, 5);
+        int numberOfShards = randomIntBetween(1, 20);
+        // a large mean and a small spread is the worst case for single pass variance
+        float offset = randomBoolean() ? 0.0f : 1000.0f;
+        DescriptiveStatistics[] expectedStatistics = new DescriptiveStatistics[numberOfSubQueries];
+        for (int subQueryIndex = 0; subQueryIndex < numberOfSubQueries; subQueryIndex++) {
+            expectedStatistics[subQueryIndex] = new DescriptiveStatistics();
+        }
+        List<CompoundTopDocs> queryTopDocs = new ArrayList<>();
+        for (int shard = 0; shard < numberOfShards; shard++) {
+            TopDocs[] topDocsPerSubQuery = new TopDocs[numberOfSubQueries];
+            for (int subQueryIndex = 0; subQueryIndex < numberOfSubQueries; subQueryIndex++) {
+                float[] scores = new float[randomIntBetween(1, 100)];
+                for (int i = 0; i < scores.length; i++) {
+                    scores[i] = offset + randomFloat();
+                    expectedStatistics[subQueryIndex].addValue(scores[i]);
+                }
+                topDocsPerSubQuery[subQueryIndex] = topDocs(scores);
+            }
+            queryTopDocs.add(compoundTopDocs(shard, topDocsPerSubQuery));
+        }
+
+        SubQueryScores subQueryScores = SubQueryScores.of(queryTopDocs);
+
+        for (int subQueryIndex = 0; subQueryIndex < numberOfSubQueries; subQueryIndex++) {
+            DescriptiveStatistics expected = expectedStatistics[subQueryIndex];
+            double sumOfSquares = 0;
+            for (double value : expected.getValues()) {
+                sumOfSquares += value * value;
+            }
+            assertEquals((float) expected.getMin(), subQueryScores.getStatistics(subQueryIndex).getMin(), 0.0f);
+            assertEquals((float) expected.getMax(), subQueryScores.getStatistics(subQueryIndex).getMax(), 0.0f);
+            float expectedL2Norm = (float) Math.sqrt(sumOfSquares);
+            // both sides are rounded to float from doubles summed in a different order
+            assertEquals(expectedL2Norm, subQueryScores.getStatistics(subQueryIndex).getL2Norm(), 2 * Math.ulp(expectedL2Norm));
+            float expectedMean = (float) expected.getMean();
+            assertEquals(expectedMean, subQueryScores.getStatistics(subQueryIndex).getMean(), 2 * Math.ulp(expectedMean));
+            assertEquals(
+                (float) expected.getStandardDeviation(),
+                subQueryScores.getStatistics(subQueryIndex).getStandardDeviation(),
+                DELTA_FOR_STATISTICS
+            );
+        }
+    }
+
+    public void testWriteBack_whenScoresModified_thenWrittenToScoreDocsTheyCameFrom() {
+        List<CompoundTopDocs> queryTopDocs = Arrays.asList(
+            compoundTopDocs(0, topDocs(0.5f, 0.2f), topDocs(0.9f)),
+            null,
+            compoundTopDocs(1, topDocs(0.7f), topDocs(0.4f))
+        );
+        SubQueryScores subQueryScores = SubQueryScores.of(queryTopDocs);
+        for (int subQueryIndex = 0; subQueryIndex < subQueryScores.getNumberOfSubQueries(); subQueryIndex++) {
+            float[] scores = subQueryScores.getScores(subQueryIndex);
+            for (int i = 0; i < scores.length; i++) {
+                scores[i] = subQueryIndex * 10 + i;
+            }
+        }
+
+        subQueryScores.writeBack(queryTopDocs);
+
+        assertEquals(0.0f, queryTopDocs.get(0).getTopDocs().get(0).scoreDocs[0].score, 0.0f);
+        assertEquals(1.0f, queryTopDocs.get(0).getTopDocs().get(0).scoreDocs[1].score, 0.0f);
+        assertEquals(10.0f, queryTopDocs.get(0).getTopDocs().get(1).scoreDocs[0].score, 0.0f);
+        assertEquals(2.0f, queryTopDocs.get(2).getTopDocs().get(0).scoreDocs[0].score, 0.0f);
+        assertEquals(11.0f, queryTopDocs.get(2).getTopDocs().get(1).scoreDocs[0].score, 0.0f);
+    }
+
+    private static TopDocs topDocs(float... scores) {
+        ScoreDoc[] scoreDocs = new ScoreDoc[scores.length];
+        for (int i = 0; i < scores.length; i++) {
+            scoreDocs[i] = new ScoreDoc(i, scores[i]);
+        }
+        return new TopDocs(new TotalHits(scores.length, TotalHits.Relation.EQUAL_TO), scoreDocs);
+    }
+
+    private static CompoundTopDocs compoundTopDocs(int shard, TopDocs... topDocsPerSubQuery) {
+        return new CompoundTopDocs(
+            new TotalHits(topDocsPerSubQuery.length, TotalHits.Relation.EQUAL_TO),
+            List.of(topDocsPerSubQuery),
+            false,
+            new SearchShard("my_index", shard, "12345678")
+        );
+    }
+}
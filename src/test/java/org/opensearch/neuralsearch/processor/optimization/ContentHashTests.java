@@ -0,0 +1,41 @@
+/*
+ * Copyright OpenSearch Contributors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+package org.opensearch.neuralsearch.processor.optimization;
+
+import org.opensearch.test.OpenSearchTestCase;
+
+import java.util.Arrays;
+import java.util.List;
+
+public class ContentHashTests extends OpenSearchTestCase {
+
+    public void testOf_whenSameInput_thenSameHash() {
+        assertEquals(ContentHash.of("model_id", List.of("a", "b")), ContentHash.of("model_id", List.of("a", "b")));
+    }
+
+    public void testOf_whenInputDiffers_thenDifferentHash() {
+        String hash = ContentHash.of("model_id", List.of("a", "b"));
+
+        assertNotEquals(hash, ContentHash.of("other_model_id", List.of("a", "b")));
+        assertNotEquals(hash, ContentHash.of("model_id", List.of("a", "c")));
+        assertNotEquals(hash, ContentHash.of("model_id", List.of("b", "a")));
+        assertNotEquals(hash, ContentHash.of("model_id", List.of("ab")));
+        assertNotEquals(hash, ContentHash.of("model_id", List.of("a", "b", "")));
+    }
+
+    public void testOf_whenNullText_thenHashed() {
+        String hash = ContentHash.of("model_id", Arrays.asList("a", null));
+
+        assertEquals(hash, ContentHash.of("model_id", Arrays.asList("a", null)));
+        assertNotEquals(hash, ContentHash.of("model_id", List.of("a", "")));
+    }
+
+    public void testOf_thenCompactUrlSafeHash() {
+        String hash = ContentHash.of("model_id", List.of("text"));
+
+        assertEquals(22, hash.length());
+        assertTrue(hash.matches("[A-Za-z0-9_-]+"));
+    }
+}
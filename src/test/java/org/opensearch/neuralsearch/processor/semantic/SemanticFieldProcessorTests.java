@@ -22,18 +22,19 @@ import org.opensearch.common.xcontent.XContentType;
 import org.opensearch.core.action.ActionListener;
 import org.opensearch.env.Environment;
 import org.opensearch.index.VersionType;
-import org.opensearch.index.analysis.AnalysisRegistry;
 import org.opensearch.ingest.IngestDocument;
 import org.opensearch.ingest.IngestDocumentWrapper;
 import org.opensearch.ml.common.FunctionName;
 import org.opensearch.ml.common.MLModel;
 import org.opensearch.ml.common.model.TextEmbeddingModelConfig;
 import org.opensearch.neuralsearch.mapper.SemanticFieldMapper;
+import org.opensearch.neuralsearch.ml.InferenceMicroBatcher;
 import org.opensearch.neuralsearch.ml.MLCommonsClientAccessor;
 import org.opensearch.neuralsearch.processor.TextInferenceRequest;
 import org.opensearch.neuralsearch.processor.chunker.Chunker;
 import org.opensearch.neuralsearch.processor.chunker.ChunkerFactory;
 import org.opensearch.neuralsearch.processor.chunker.FixedTokenLengthChunker;
+import org.opensearch.neuralsearch.processor.chunker.TokenizerAnalyzerCache;
 import org.opensearch.neuralsearch.util.prune.PruneType;
 import org.opensearch.neuralsearch.util.prune.PruneUtils;
 import org.opensearch.test.OpenSearchTestCase;
@@ -69,7 +70,7 @@ public class SemanticFieldProcessorTests extends OpenSearchTestCase {
     @Mock
     private MLCommonsClientAccessor mlCommonsClientAccessor;
 
-    private AnalysisRegistry analysisRegistry;
+    private TokenizerAnalyzerCache analyzerCache;
     @Mock
     private Environment environment;
     @Mock
@@ -111,8 +112,8 @@ public class SemanticFieldProcessorTests extends OpenSearchTestCase {
         when(metadata.index(anyString())).thenReturn(null);
         when(clusterState.metadata()).thenReturn(metadata);
         when(clusterService.state()).thenReturn(clusterState);
-        // mock analysisRegistry
-        analysisRegistry = getAnalysisRegistry();
+        // analysisRegistry is a final class so use a real one
+        analyzerCache = new TokenizerAnalyzerCache(getAnalysisRegistry());
 
         // two semantic fields with different model ids
         // one field enable the chunking and one field disable the chunking
@@ -150,7 +151,7 @@ public class SemanticFieldProcessorTests extends OpenSearchTestCase {
         final Map<String, Object> chunkerParameters = new HashMap<>();
         chunkerParameters.put(FixedTokenLengthChunker.TOKEN_LIMIT_FIELD, 50);
         chunkerParameters.put(FixedTokenLengthChunker.OVERLAP_RATE_FIELD, 0.2);
-        chunkerParameters.put(FixedTokenLengthChunker.ANALYSIS_REGISTRY_FIELD, analysisRegistry);
+        chunkerParameters.put(FixedTokenLengthChunker.ANALYZER_CACHE_FIELD, analyzerCache);
         chunker = ChunkerFactory.create(FixedTokenLengthChunker.ALGORITHM_NAME, chunkerParameters);
 
         semanticFieldProcessor = new SemanticFieldProcessor(
@@ -162,7 +163,7 @@ public class SemanticFieldProcessorTests extends OpenSearchTestCase {
             environment,
             clusterService,
             chunker,
-            analysisRegistry,
+            analyzerCache,
             openSearchClient
         );
     }
@@ -241,7 +242,7 @@ public class SemanticFieldProcessorTests extends OpenSearchTestCase {
             environment,
             clusterService,
             chunker,
-            analysisRegistry,
+            analyzerCache,
             openSearchClient
         );
         // prepare ingest doc
@@ -429,7 +430,7 @@ public class SemanticFieldProcessorTests extends OpenSearchTestCase {
             environment,
             clusterService,
             chunker,
-            analysisRegistry,
+            analyzerCache,
             openSearchClient
         );
         // prepare ingest doc 1
@@ -604,6 +605,51 @@ public class SemanticFieldProcessorTests extends OpenSearchTestCase {
             .isEqualTo(expectedIngestedDoc1);
     }
 
+    public void testSubBatchExecute_whenSliceFails_thenOnlyDocsOfSliceFail() throws URISyntaxException, IOException {
+        final Map<String, Object> failingDocSource = new HashMap<>(Map.of(FIELD_NAME_GEO_DATA, "failing"));
+        final IngestDocumentWrapper ingestDocumentWrapper1 = createIngestDocWrapper("1", failingDocSource);
+        final Map<String, Object> ingestDocSource2 = readDocSourceFromFile("processor/semantic/ingest_doc3.json");
+        final IngestDocumentWrapper ingestDocumentWrapper2 = createIngestDocWrapper("2", ingestDocSource2);
+        final Consumer<List<IngestDocumentWrapper>> handler = mock(Consumer.class);
+        final String exceptionMsg = "Failed to inference by sparse model.";
+
+        doAnswer(invocationOnMock -> {
+            final Consumer<Map<String, MLModel>> onSuccess = invocationOnMock.getArgument(1);
+            onSuccess.accept(Map.of(DUMMY_MODEL_ID_1, textEmbeddingModel, DUMMY_MODEL_ID_2, sparseEmbeddingModel));
+            return null;
+        }).when(mlCommonsClientAccessor).getModels(any(), any(), any());
+        doAnswer(invocationOnMock -> {
+            final TextInferenceRequest textInferenceRequest = invocationOnMock.getArgument(0);
+            final ActionListener<List<Map<String, ?>>> listener = invocationOnMock.getArgument(1);
+            assertEquals(1, textInferenceRequest.getInputTexts().size());
+            if (textInferenceRequest.getInputTexts().contains("failing")) {
+                listener.onFailure(new RuntimeException(exceptionMsg));
+            } else {
+                listener.onResponse(List.of(Map.of("response", List.of(Map.of("high score token", 1.0)))));
+            }
+            return null;
+        }).when(mlCommonsClientAccessor).inferenceSentencesWithMapResult(any(), any());
+
+        // one text per predict request
+        InferenceMicroBatcher.getInstance().setMaxTextsPerRequest(1);
+        try {
+            semanticFieldProcessor.subBatchExecute(List.of(ingestDocumentWrapper1, ingestDocumentWrapper2), handler);
+        } finally {
+            InferenceMicroBatcher.getInstance().setMaxTextsPerRequest(0);
+        }
+
+        final ArgumentCaptor<List<IngestDocumentWrapper>> handlerCaptor = ArgumentCaptor.forClass(List.class);
+        verify(handler).accept(handlerCaptor.capture());
+        verify(mlCommonsClientAccessor, times(2)).inferenceSentencesWithMapResult(any(), any());
+
+        final List<IngestDocumentWrapper> ingestedDocs = handlerCaptor.getValue();
+        assertTrue(ingestedDocs.get(0).getException().getMessage().contains(exceptionMsg));
+        assertNull(ingestedDocs.get(1).getException());
+        final Map<String, Object> expectedIngestedDoc2 = readExpectedDocFromFile("processor/semantic/ingested_doc3.json");
+        org.assertj.core.api.Assertions.assertThat(ingestedDocs.get(1).getIngestDocument().getSourceAndMetadata())
+            .isEqualTo(expectedIngestedDoc2);
+    }
+
     private void mockGetModelAndInferenceAPI() {
         // mock get model API
         doAnswer(invocationOnMock -> {
@@ -5,18 +5,27 @@
 package org.opensearch.neuralsearch.query;
 
 import org.apache.lucene.search.DocIdSetIterator;
+import org.apache.lucene.search.DocIdStream;
 import org.apache.lucene.search.LeafCollector;
+import org.apache.lucene.search.ScoreMode;
 import org.apache.lucene.search.Scorer;
 import org.apache.lucene.util.FixedBitSet;
 import org.junit.Before;
 import org.opensearch.test.OpenSearchTestCase;
 
 import java.io.IOException;
+import java.util.ArrayList;
 import java.util.Arrays;
 import java.util.Collections;
 import java.util.List;
 
+import static org.mockito.ArgumentMatchers.any;
+import static org.mockito.ArgumentMatchers.anyFloat;
+import static org.mockito.ArgumentMatchers.anyInt;
+import static org.mockito.Mockito.doAnswer;
 import static org.mockito.Mockito.mock;
+import static org.mockito.Mockito.never;
+import static org.mockito.Mockito.verify;
 import static org.mockito.Mockito.when;
 
 public class HybridBulkScorerTests extends OpenSearchTestCase {
@@ -65,16 +74,15 @@ public class HybridBulkScorerTests extends OpenSearchTestCase {
         HybridBulkScorer bulkScorer = new HybridBulkScorer(scorers, true, MAX_DOC);
 
         assertNotNull(bulkScorer);
-        assertEquals(1, bulkScorer.getWindowScores().length);
+        assertEquals(4096, bulkScorer.getWindowScores().length);
     }
 
     public void testWindowScoresInitialization() {
         List<Scorer> scorers = Arrays.asList(mockScorer1, mockScorer2);
         HybridBulkScorer bulkScorer = new HybridBulkScorer(scorers, true, MAX_DOC);
 
-        float[][] windowScores = bulkScorer.getWindowScores();
-        assertEquals(2, windowScores.length);
-        assertEquals(4096, windowScores[0].length); // 2^12 (WINDOW_SIZE)
+        // doc-major scores of 2 sub-queries for a window of 2^12 docs
+        assertEquals(2 * 4096, bulkScorer.getWindowScores().length);
     }
 
     public void testMatchingBitSetInitialization() {
@@ -241,4 +249,116 @@ public class HybridBulkScorerTests extends OpenSearchTestCase {
             docIds[1]
         );
     }
+
+    public void testScoreWindow_whenTopScoresAndWindowNotCompetitive_thenSubQuerySkipsWindow() throws IOException {
+        List<Scorer> scorers = Arrays.asList(mockScorer1, mockScorer2);
+        HybridBulkScorer bulkScorer = new HybridBulkScorer(scorers, ScoreMode.TOP_SCORES, 30000);
+        bulkScorer.getHybridSubQueryScorer().getMinScores()[0] = 0.5f;
+        LeafCollector mockLeafCollector = mock(LeafCollector.class);
+
+        when(mockScorer1.getMaxScore(4095)).thenReturn(0.3f);
+        when(mockIterator1.advance(4096)).thenReturn(5000);
+        when(mockIterator2.nextDoc()).thenReturn(DocIdSetIterator.NO_MORE_DOCS);
+        when(mockScorer2.score()).thenReturn(0.8f);
+
+        int[] docIds = { 10, 20 };
+        bulkScorer.scoreWindow(mockLeafCollector, null, 0, 30000, docIds);
+
+        verify(mockScorer1).setMinCompetitiveScore(0.5f);
+        verify(mockScorer1).advanceShallow(10);
+        verify(mockScorer1, never()).score();
+        verify(mockScorer2, never()).setMinCompetitiveScore(anyFloat());
+        assertEquals(5000, docIds[0]);
+        assertEquals(DocIdSetIterator.NO_MORE_DOCS, docIds[1]);
+    }
+
+    public void testScoreWindow_whenTopScoresAndWindowCompetitive_thenSubQueryScored() throws IOException {
+        List<Scorer> scorers = Collections.singletonList(mockScorer1);
+        HybridBulkScorer bulkScorer = new HybridBulkScorer(scorers, ScoreMode.TOP_SCORES, 30000);
+        bulkScorer.getHybridSubQueryScorer().getMinScores()[0] = 0.5f;
+        LeafCollector mockLeafCollector = mock(LeafCollector.class);
+
+        when(mockScorer1.getMaxScore(4095)).thenReturn(0.9f);
+        when(mockIterator1.nextDoc()).thenReturn(DocIdSetIterator.NO_MORE_DOCS);
+        when(mockScorer1.score()).thenReturn(0.7f);
+
+        int[] docIds = { 10 };
+        bulkScorer.scoreWindow(mockLeafCollector, null, 0, 30000, docIds);
+
+        verify(mockScorer1).setMinCompetitiveScore(0.5f);
+        verify(mockScorer1).score();
+        assertEquals(DocIdSetIterator.NO_MORE_DOCS, docIds[0]);
+    }
+
+    public void testScoreWindow_whenCompleteScoreMode_thenNoSkipping() throws IOException {
+        List<Scorer> scorers = Collections.singletonList(mockScorer1);
+        HybridBulkScorer bulkScorer = new HybridBulkScorer(scorers, true, 30000);
+        bulkScorer.getHybridSubQueryScorer().getMinScores()[0] = 0.5f;
+        LeafCollector mockLeafCollector = mock(LeafCollector.class);
+
+        when(mockIterator1.nextDoc()).thenReturn(DocIdSetIterator.NO_MORE_DOCS);
+        when(mockScorer1.score()).thenReturn(0.3f);
+
+        int[] docIds = { 10 };
+        bulkScorer.scoreWindow(mockLeafCollector, null, 0, 30000, docIds);
+
+        verify(mockScorer1, never()).setMinCompetitiveScore(anyFloat());
+        verify(mockScorer1, never()).getMaxScore(anyInt());
+        verify(mockScorer1).score();
+    }
+
+    public void testScoreWindow_whenDocsMatched_thenOnlyScoresOfMatchedDocsReset() throws IOException {
+        List<Scorer> scorers = Arrays.asList(mockScorer1, mockScorer2);
+        HybridBulkScorer bulkScorer = new HybridBulkScorer(scorers, true, MAX_DOC);
+        LeafCollector mockLeafCollector = mock(LeafCollector.class);
+        List<float[]> collectedScores = new ArrayList<>();
+        doAnswer(invocation -> {
+            DocIdStream stream = invocation.getArgument(0);
+            stream.forEach(doc -> collectedScores.add(bulkScorer.getHybridSubQueryScorer().getSubQueryScores().clone()));
+            return null;
+        }).when(mockLeafCollector).collect(any(DocIdStream.class));
+
+        when(mockIterator1.nextDoc()).thenReturn(7, DocIdSetIterator.NO_MORE_DOCS);
+        when(mockIterator2.nextDoc()).thenReturn(DocIdSetIterator.NO_MORE_DOCS);
+        when(mockScorer1.score()).thenReturn(0.5f, 0.7f);
+        when(mockScorer2.score()).thenReturn(0.9f);
+
+        int[] docIds = { 3, 7 };
+        bulkScorer.scoreWindow(mockLeafCollector, null, 0, MAX_DOC, docIds);
+
+        assertEquals(2, collectedScores.size());
+        assertArrayEquals(new float[] { 0.5f, 0.0f }, collectedScores.get(0), 0.0f);
+        assertArrayEquals(new float[] { 0.7f, 0.9f }, collectedScores.get(1), 0.0f);
+        assertEquals(0, bulkScorer.getMatching().cardinality());
+        for (float score : bulkScorer.getWindowScores()) {
+            assertEquals(0.0f, score, 0.0f);
+        }
+    }
+
+    public void testScoreWindow_whenScorerSharedByEqualSubQueries_thenScoresFannedOutToEverySubQuery() throws IOException {
+        List<Scorer> scorers = Arrays.asList(mockScorer1, mockScorer2, mockScorer1);
+        HybridBulkScorer bulkScorer = new HybridBulkScorer(scorers, true, MAX_DOC);
+        LeafCollector mockLeafCollector = mock(LeafCollector.class);
+        List<float[]> collectedScores = new ArrayList<>();
+        doAnswer(invocation -> {
+            DocIdStream stream = invocation.getArgument(0);
+            stream.forEach(doc -> collectedScores.add(bulkScorer.getHybridSubQueryScorer().getSubQueryScores().clone()));
+            return null;
+        }).when(mockLeafCollector).collect(any(DocIdStream.class));
+
+        when(mockIterator1.nextDoc()).thenReturn(DocIdSetIterator.NO_MORE_DOCS);
+        when(mockIterator2.nextDoc()).thenReturn(DocIdSetIterator.NO_MORE_DOCS);
+        when(mockScorer1.score()).thenReturn(0.5f);
+        when(mockScorer2.score()).thenReturn(0.9f);
+
+        int[] docIds = { 3, 3, DocIdSetIterator.NO_MORE_DOCS };
+        bulkScorer.scoreWindow(mockLeafCollector, null, 0, MAX_DOC, docIds);
+
+        assertEquals(2, bulkScorer.cost());
+        assertEquals(1, collectedScores.size());
+        assertArrayEquals(new float[] { 0.5f, 0.9f, 0.5f }, collectedScores.get(0), 0.0f);
+        // shared scorer is iterated once
+        verify(mockScorer1).score();
+        verify(mockIterator1).nextDoc();
+    }
 }
@@ -0,0 +1,189 @@
+/*
+ * Copyright OpenSearch Contributors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+package org.opensearch.neuralsearch.query;
+
+import lombok.SneakyThrows;
+import org.apache.lucene.document.Document;
+import org.apache.lucene.document.Field;
+import org.apache.lucene.document.TextField;
+import org.apache.lucene.index.DirectoryReader;
+import org.apache.lucene.index.IndexWriter;
+import org.apache.lucene.index.LeafReaderContext;
+import org.apache.lucene.index.Term;
+import org.apache.lucene.search.BulkScorer;
+import org.apache.lucene.search.DocIdSetIterator;
+import org.apache.lucene.search.IndexSearcher;
+import org.apache.lucene.search.LeafCollector;
+import org.apache.lucene.search.Scorable;
+import org.apache.lucene.search.ScoreMode;
+import org.apache.lucene.search.TaskExecutor;
+import org.apache.lucene.search.TermQuery;
+import org.apache.lucene.store.Directory;
+import org.apache.lucene.util.Bits;
+import org.apache.lucene.util.FixedBitSet;
+import org.opensearch.neuralsearch.executors.HybridQueryExecutor;
+
+import java.util.ArrayList;
+import java.util.Arrays;
+import java.util.List;
+import java.util.concurrent.ExecutorService;
+import java.util.concurrent.Executors;
+import java.util.concurrent.TimeUnit;
+
+public class HybridParallelBulkScorerTests extends OpenSearchQueryTestCase {
+
+    private static final String FIELD_NAME = "text";
+    private static final String[] TERMS = { "alpha", "beta", "gamma" };
+    // more docs than the largest window of the hybrid bulk scorer, so several windows are merged
+    private static final int NUM_DOCS = 10_000;
+
+    @SneakyThrows
+    public void testScore_whenParallelSubQueryScoring_thenSameHitsAsSerialScoring() {
+        try (Directory directory = newDirectory(); IndexWriter writer = new IndexWriter(directory, newIndexWriterConfig())) {
+            indexRandomDocs(writer);
+            try (DirectoryReader reader = DirectoryReader.open(writer)) {
+                IndexSearcher searcher = newSearcher(reader);
+                HybridQueryWeight weight = createHybridQueryWeight(searcher, ScoreMode.COMPLETE);
+                for (LeafReaderContext context : searcher.getIndexReader().leaves()) {
+                    if (weight.scorerSupplier(context) == null) {
+                        continue;
+                    }
+                    List<String> serialHits = collectHits(weight.scorerSupplier(context).bulkScorer(), null);
+
+                    HybridQueryExecutor.setParallelSubQueryScoringEnabled(true);
+                    try {
+                        BulkScorer parallelBulkScorer = weight.scorerSupplier(context).bulkScorer();
+                        assertTrue(parallelBulkScorer instanceof HybridParallelBulkScorer);
+                        assertEquals(serialHits, collectHits(parallelBulkScorer, null));
+                    } finally {
+                        HybridQueryExecutor.setParallelSubQueryScoringEnabled(false);
+                    }
+                }
+            }
+        }
+    }
+
+    @SneakyThrows
+    public void testScore_whenSubQueriesScoredOnOtherThreads_thenSameHitsAsSerialScoring() {
+        ExecutorService executorService = Executors.newFixedThreadPool(2);
+        try (Directory directory = newDirectory(); IndexWriter writer = new IndexWriter(directory, newIndexWriterConfig())) {
+            indexRandomDocs(writer);
+            writer.forceMerge(1);
+            try (DirectoryReader reader = DirectoryReader.open(writer)) {
+                IndexSearcher searcher = new IndexSearcher(reader);
+                ScoreMode scoreMode = randomFrom(ScoreMode.COMPLETE, ScoreMode.TOP_SCORES, ScoreMode.COMPLETE_NO_SCORES);
+                HybridQueryWeight weight = createHybridQueryWeight(searcher, scoreMode);
+                LeafReaderContext context = searcher.getIndexReader().leaves().get(0);
+                FixedBitSet acceptDocs = new FixedBitSet(context.reader().maxDoc());
+                for (int doc = 0; doc < acceptDocs.length(); doc++) {
+                    if (randomInt(9) > 0) {
+                        acceptDocs.set(doc);
+                    }
+                }
+
+                List<String> serialHits = collectHits(weight.scorerSupplier(context).bulkScorer(), acceptDocs);
+                BulkScorer parallelBulkScorer = new HybridParallelBulkScorer(
+                    weight.getWeights(),
+                    context,
+                    scoreMode,
+                    weight.scorerSupplier(context).cost(),
+                    new TaskExecutor(executorService)
+                );
+
+                assertEquals(serialHits, collectHits(parallelBulkScorer, acceptDocs));
+            }
+        } finally {
+            executorService.shutdown();
+            assertTrue(executorService.awaitTermination(10, TimeUnit.SECONDS));
+        }
+    }
+
+    @SneakyThrows
+    public void testScore_whenRangeEndsBeforeLastMatch_thenNextMatchingDocReturned() {
+        try (Directory directory = newDirectory(); IndexWriter writer = new IndexWriter(directory, newIndexWriterConfig())) {
+            indexRandomDocs(writer);
+            writer.forceMerge(1);
+            try (DirectoryReader reader = DirectoryReader.open(writer)) {
+                IndexSearcher searcher = new IndexSearcher(reader);
+                HybridQueryWeight weight = createHybridQueryWeight(searcher, ScoreMode.COMPLETE);
+                LeafReaderContext context = searcher.getIndexReader().leaves().get(0);
+                int max = NUM_DOCS / 2;
+
+                int serialNextDoc = weight.scorerSupplier(context).bulkScorer().score(new NoOpLeafCollector(), null, 0, max);
+                BulkScorer parallelBulkScorer = new HybridParallelBulkScorer(
+                    weight.getWeights(),
+                    context,
+                    ScoreMode.COMPLETE,
+                    weight.scorerSupplier(context).cost(),
+                    new TaskExecutor(Runnable::run)
+                );
+
+                int parallelNextDoc = parallelBulkScorer.score(new NoOpLeafCollector(), null, 0, max);
+                assertTrue(parallelNextDoc >= max);
+                assertNotEquals(DocIdSetIterator.NO_MORE_DOCS, parallelNextDoc);
+                assertEquals(serialNextDoc, parallelNextDoc);
+            }
+        }
+    }
+
+    private void indexRandomDocs(IndexWriter writer) throws Exception {
+        for (int i = 0; i < NUM_DOCS; i++) {
+            Document document = new Document();
+            StringBuilder text = new StringBuilder();
+            for (String term : TERMS) {
+                int frequency = randomInt(3);
+                for (int j = 0; j < frequency; j++) {
+                    text.append(term).append(' ');
+                }
+            }
+            document.add(new TextField(FIELD_NAME, text.toString(), Field.Store.NO));
+            writer.addDocument(document);
+        }
+        writer.commit();
+    }
+
+    private HybridQueryWeight createHybridQueryWeight(IndexSearcher searcher, ScoreMode scoreMode) throws Exception {
+        // the last sub-query equals the first one, so they share one scorer
+        HybridQuery hybridQuery = new HybridQuery(
+            List.of(
+                new TermQuery(new Term(FIELD_NAME, TERMS[0])),
+                new TermQuery(new Term(FIELD_NAME, TERMS[1])),
+                new TermQuery(new Term(FIELD_NAME, TERMS[2])),
+                new TermQuery(new Term(FIELD_NAME, TERMS[0]))
+            ),
+            new HybridQueryContext(10)
+        );
+        return (HybridQueryWeight) hybridQuery.createWeight(searcher, scoreMode, 1.0f);
+    }
+
+    /**
+     * @return every collected doc with the scores of all sub-queries, in the order of collection
+     */
+    private List<String> collectHits(BulkScorer bulkScorer, Bits acceptDocs) throws Exception {
+        List<String> hits = new ArrayList<>();
+        bulkScorer.score(new LeafCollector() {
+            private HybridSubQueryScorer scorer;
+
+            @Override
+            public void setScorer(Scorable scorer) {
+                this.scorer = (HybridSubQueryScorer) scorer;
+            }
+
+            @Override
+            public void collect(int doc) {
+                hits.add(doc + ":" + Arrays.toString(scorer.getSubQueryScores()));
+            }
+        }, acceptDocs, 0, DocIdSetIterator.NO_MORE_DOCS);
+        return hits;
+    }
+
+    private static final class NoOpLeafCollector implements LeafCollector {
+        @Override
+        public void setScorer(Scorable scorer) {}
+
+        @Override
+        public void collect(int doc) {}
+    }
+}
@@ -237,10 +237,11 @@ public class HybridQueryDocIdStreamTests extends OpenSearchTestCase {
         when(mockScorer.getMatching()).thenReturn(matchingDocs);
         when(mockScorer.getMaxDoc()).thenReturn(200);
 
-        float[][] windowScores = new float[2][NUM_DOCS];
+        // doc-major scores of 2 sub-queries
+        float[] windowScores = new float[2 * NUM_DOCS];
         for (int i = 0; i < NUM_DOCS; i++) {
-            windowScores[0][i] = 1.0f + i;
-            windowScores[1][i] = 2.0f + i;
+            windowScores[2 * i] = 1.0f + i;
+            windowScores[2 * i + 1] = 2.0f + i;
         }
         when(mockScorer.getWindowScores()).thenReturn(windowScores);
 
@@ -322,10 +323,9 @@ public class HybridQueryDocIdStreamTests extends OpenSearchTestCase {
         when(mockScorer.getMaxDoc()).thenReturn(200);
 
         // setup window scores with the specified number of docs
-        float[][] windowScores = new float[2][numDocs];
-        for (int i = 0; i < numDocs; i++) {
-            windowScores[0][i] = random().nextFloat();
-            windowScores[1][i] = random().nextFloat();
+        float[] windowScores = new float[2 * numDocs];
+        for (int i = 0; i < windowScores.length; i++) {
+            windowScores[i] = random().nextFloat();
         }
         when(mockScorer.getWindowScores()).thenReturn(windowScores);
 
@@ -343,10 +343,9 @@ public class HybridQueryDocIdStreamTests extends OpenSearchTestCase {
         when(mockScorer.getMaxDoc()).thenReturn(200);
 
         // setup window scores
-        float[][] windowScores = new float[2][NUM_DOCS]; // 2 sub-queries
-        for (int i = 0; i < NUM_DOCS; i++) {
-            windowScores[0][i] = random().nextFloat();
-            windowScores[1][i] = random().nextFloat();
+        float[] windowScores = new float[2 * NUM_DOCS]; // doc-major scores of 2 sub-queries
+        for (int i = 0; i < windowScores.length; i++) {
+            windowScores[i] = random().nextFloat();
         }
         when(mockScorer.getWindowScores()).thenReturn(windowScores);
 
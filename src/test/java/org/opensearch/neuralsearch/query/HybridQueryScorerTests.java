@@ -152,6 +152,25 @@ public class HybridQueryScorerTests extends OpenSearchQueryTestCase {
         }
     }
 
+    @SneakyThrows
+    public void testScore_whenScorerSharedByEqualSubQueries_thenScoreCountedForEverySubQuery() {
+        final int maxDoc = TestUtil.nextInt(random(), 10, 1_000);
+        final int[] docs = new int[] { 0, maxDoc - 1 };
+        final float[] scores1 = new float[] { random().nextFloat(), random().nextFloat() };
+        final float[] scores2 = new float[] { random().nextFloat(), random().nextFloat() };
+        Scorer sharedScorer = scorerWithTwoPhaseIterator(docs, scores1, fakeWeight(new MatchAllDocsQuery()), maxDoc);
+
+        HybridQueryScorer queryScorer = new HybridQueryScorer(
+            Arrays.asList(sharedScorer, scorerWithTwoPhaseIterator(docs, scores2, fakeWeight(new MatchNoDocsQuery()), maxDoc), sharedScorer)
+        );
+
+        for (int idx = 0; idx < docs.length; idx++) {
+            assertEquals(docs[idx], queryScorer.iterator().nextDoc());
+            assertEquals(2 * scores1[idx] + scores2[idx], queryScorer.score(), DELTA_FOR_SCORE_ASSERTION);
+        }
+        assertEquals(DocIdSetIterator.NO_MORE_DOCS, queryScorer.iterator().nextDoc());
+    }
+
     @SneakyThrows
     public void testScore_whenMultipleSubScorers_thenSumScores() {
         // Create mock scorers with iterators
@@ -187,6 +187,59 @@ public class HybridQueryTests extends OpenSearchQueryTestCase {
         dir.close();
     }
 
+    public void testGetFirstEqualSubQueryIndexes_whenEqualSubQueries_thenIndexOfFirstEqualSubQuery() {
+        HybridQuery query = new HybridQuery(
+            List.of(
+                new TermQuery(new Term(TEXT_FIELD_NAME, "text1")),
+                new TermQuery(new Term(TEXT_FIELD_NAME, "text2")),
+                new TermQuery(new Term(TEXT_FIELD_NAME, "text1")),
+                new TermQuery(new Term(TEXT_FIELD_NAME, "text2")),
+                new TermQuery(new Term(TEXT_FIELD_NAME, "text3"))
+            ),
+            new HybridQueryContext(10)
+        );
+
+        assertArrayEquals(new int[] { 0, 1, 0, 1, 4 }, query.getFirstEqualSubQueryIndexes());
+    }
+
+    @SneakyThrows
+    public void testWithRandomDocuments_whenEqualTermSubQueries_thenScoresOfEverySubQueryCounted() {
+        String field1Value = "text1";
+        String field2Value = "text2";
+
+        final Directory dir = newDirectory();
+        final IndexWriter w = new IndexWriter(dir, newIndexWriterConfig());
+        FieldType ft = new FieldType(TextField.TYPE_NOT_STORED);
+        ft.freeze();
+
+        w.addDocument(getDocument(TEXT_FIELD_NAME, RandomizedTest.randomInt(), field1Value, ft));
+        w.addDocument(getDocument(TEXT_FIELD_NAME, RandomizedTest.randomInt(), field2Value, ft));
+        w.commit();
+
+        DirectoryReader reader = DirectoryReader.open(w);
+        IndexSearcher searcher = new IndexSearcher(reader);
+        TermQuery termQuery1 = new TermQuery(new Term(TEXT_FIELD_NAME, field1Value));
+        TermQuery termQuery2 = new TermQuery(new Term(TEXT_FIELD_NAME, field2Value));
+
+        HybridQuery query = new HybridQuery(
+            List.of(termQuery1, termQuery2, new TermQuery(new Term(TEXT_FIELD_NAME, field1Value))),
+            new HybridQueryContext(10)
+        );
+        TopDocs hybridQueryResult = searcher.search(query, 3);
+        TopDocs termQuery1Result = searcher.search(termQuery1, 1);
+        TopDocs termQuery2Result = searcher.search(termQuery2, 1);
+
+        // the equal sub-query is executed once, its score is still counted for both of its slots
+        assertEquals(2, hybridQueryResult.scoreDocs.length);
+        assertEquals(termQuery1Result.scoreDocs[0].doc, hybridQueryResult.scoreDocs[0].doc);
+        assertEquals(2 * termQuery1Result.scoreDocs[0].score, hybridQueryResult.scoreDocs[0].score, DELTA_FOR_ASSERTION);
+        assertEquals(termQuery2Result.scoreDocs[0].doc, hybridQueryResult.scoreDocs[1].doc);
+        assertEquals(termQuery2Result.scoreDocs[0].score, hybridQueryResult.scoreDocs[1].score, DELTA_FOR_ASSERTION);
+        w.close();
+        reader.close();
+        dir.close();
+    }
+
     @SneakyThrows
     public void testWithRandomDocuments_whenOneTermSubQueryWithoutMatch_thenReturnSuccessfully() {
         int docId1 = RandomizedTest.randomInt();
@@ -138,6 +138,12 @@ public class HybridQueryWeightTests extends OpenSearchQueryTestCase {
         Scorer scorer = weight.scorer(leafReaderContext);
 
         assertNotNull(scorer);
+        // equal sub-queries share one weight and one scorer
+        List<Weight> subQueryWeights = ((HybridQueryWeight) weight).getWeights();
+        assertSame(subQueryWeights.get(0), subQueryWeights.get(2));
+        assertNotSame(subQueryWeights.get(0), subQueryWeights.get(1));
+        List<Scorer> subScorers = ((HybridQueryScorer) scorer).getSubScorers();
+        assertSame(subScorers.get(0), subScorers.get(2));
 
         DocIdSetIterator iterator = scorer.iterator();
         int actualDoc = iterator.nextDoc();
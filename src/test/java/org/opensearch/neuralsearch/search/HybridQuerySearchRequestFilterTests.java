@@ -8,16 +8,25 @@ import static org.mockito.ArgumentMatchers.eq;
 import static org.mockito.Mockito.mock;
 import static org.mockito.Mockito.verify;
 
+import java.util.List;
+
+import org.opensearch.Version;
 import org.opensearch.action.bulk.BulkAction;
 import org.opensearch.action.bulk.BulkRequest;
 import org.opensearch.action.search.SearchAction;
 import org.opensearch.action.search.SearchRequest;
 import org.opensearch.action.support.ActionFilterChain;
+import org.opensearch.cluster.metadata.IndexMetadata;
+import org.opensearch.common.UUIDs;
+import org.opensearch.common.settings.Settings;
+import org.opensearch.common.unit.TimeValue;
 import org.opensearch.core.action.ActionListener;
 import org.opensearch.core.action.ActionResponse;
+import org.opensearch.index.IndexNotFoundException;
 import org.opensearch.index.query.MatchAllQueryBuilder;
 import org.opensearch.index.query.MatchQueryBuilder;
 import org.opensearch.neuralsearch.query.HybridQueryBuilder;
+import org.opensearch.indices.IndicesRequestCache;
 import org.opensearch.neuralsearch.query.OpenSearchQueryTestCase;
 import org.opensearch.search.builder.SearchSourceBuilder;
 import org.opensearch.tasks.Task;
@@ -270,4 +279,110 @@ public class HybridQuerySearchRequestFilterTests extends OpenSearchQueryTestCase
         assertEquals(Integer.MAX_VALUE, searchRequest.getBatchedReduceSize());
         verify(chain).proceed(eq(task), eq(SearchAction.NAME), eq(searchRequest), eq(listener));
     }
+
+    @SuppressWarnings("unchecked")
+    public void testApply_whenHybridQueryAndRequestCacheEnabled_thenRequestCacheSet() {
+        HybridQuerySearchRequestFilter requestCacheFilter = new HybridQuerySearchRequestFilter(
+            () -> true,
+            request -> List.of(indexMetadata("test_index", true))
+        );
+        SearchRequest searchRequest = hybridSearchRequest();
+        SearchRequest nonHybridSearchRequest = new SearchRequest("test_index");
+        nonHybridSearchRequest.source(new SearchSourceBuilder().query(new MatchAllQueryBuilder()));
+        ActionFilterChain<SearchRequest, ActionResponse> chain = mock(ActionFilterChain.class);
+
+        requestCacheFilter.apply(mock(Task.class), SearchAction.NAME, searchRequest, mock(ActionListener.class), chain);
+        requestCacheFilter.apply(mock(Task.class), SearchAction.NAME, nonHybridSearchRequest, mock(ActionListener.class), chain);
+
+        assertEquals(Boolean.TRUE, searchRequest.requestCache());
+        assertNull(nonHybridSearchRequest.requestCache());
+    }
+
+    @SuppressWarnings("unchecked")
+    public void testApply_whenRequestCacheSetExplicitlyOrScroll_thenRequestCacheNotChanged() {
+        HybridQuerySearchRequestFilter requestCacheFilter = new HybridQuerySearchRequestFilter(
+            () -> true,
+            request -> List.of(indexMetadata("test_index", true))
+        );
+        SearchRequest searchRequestWithoutCache = hybridSearchRequest().requestCache(false);
+        SearchRequest scrollSearchRequest = hybridSearchRequest().scroll(TimeValue.timeValueMinutes(1));
+        ActionFilterChain<SearchRequest, ActionResponse> chain = mock(ActionFilterChain.class);
+
+        requestCacheFilter.apply(mock(Task.class), SearchAction.NAME, searchRequestWithoutCache, mock(ActionListener.class), chain);
+        requestCacheFilter.apply(mock(Task.class), SearchAction.NAME, scrollSearchRequest, mock(ActionListener.class), chain);
+
+        assertEquals(Boolean.FALSE, searchRequestWithoutCache.requestCache());
+        assertNull(scrollSearchRequest.requestCache());
+    }
+
+    @SuppressWarnings("unchecked")
+    public void testApply_whenRequestCacheDisabled_thenRequestCacheNotSet() {
+        SearchRequest searchRequest = hybridSearchRequest();
+
+        filter.apply(mock(Task.class), SearchAction.NAME, searchRequest, mock(ActionListener.class), mock(ActionFilterChain.class));
+
+        assertNull(searchRequest.requestCache());
+        assertEquals(Integer.MAX_VALUE, searchRequest.getBatchedReduceSize());
+    }
+
+    @SuppressWarnings("unchecked")
+    public void testApply_whenIndexRequestCacheDisabled_thenRequestCacheNotSet() {
+        HybridQuerySearchRequestFilter requestCacheFilter = new HybridQuerySearchRequestFilter(
+            () -> true,
+            request -> List.of(indexMetadata("test_index", false))
+        );
+        SearchRequest searchRequest = hybridSearchRequest();
+        ActionFilterChain<SearchRequest, ActionResponse> chain = mock(ActionFilterChain.class);
+
+        requestCacheFilter.apply(mock(Task.class), SearchAction.NAME, searchRequest, mock(ActionListener.class), chain);
+
+        assertNull(searchRequest.requestCache());
+    }
+
+    @SuppressWarnings("unchecked")
+    public void testApply_whenRequestCacheDisabledOnOneOfIndices_thenRequestCacheNotSet() {
+        HybridQuerySearchRequestFilter requestCacheFilter = new HybridQuerySearchRequestFilter(
+            () -> true,
+            request -> List.of(indexMetadata("test_index", true), indexMetadata("other_index", false))
+        );
+        SearchRequest searchRequest = hybridSearchRequest();
+        ActionFilterChain<SearchRequest, ActionResponse> chain = mock(ActionFilterChain.class);
+
+        requestCacheFilter.apply(mock(Task.class), SearchAction.NAME, searchRequest, mock(ActionListener.class), chain);
+
+        assertNull(searchRequest.requestCache());
+    }
+
+    @SuppressWarnings("unchecked")
+    public void testApply_whenIndicesNotResolved_thenRequestCacheNotSetAndRequestProceeds() {
+        HybridQuerySearchRequestFilter requestCacheFilter = new HybridQuerySearchRequestFilter(() -> true, request -> {
+            throw new IndexNotFoundException("test_index");
+        });
+        SearchRequest searchRequest = hybridSearchRequest();
+        ActionFilterChain<SearchRequest, ActionResponse> chain = mock(ActionFilterChain.class);
+        ActionListener<ActionResponse> listener = mock(ActionListener.class);
+        Task task = mock(Task.class);
+
+        requestCacheFilter.apply(task, SearchAction.NAME, searchRequest, listener, chain);
+
+        assertNull(searchRequest.requestCache());
+        verify(chain).proceed(eq(task), eq(SearchAction.NAME), eq(searchRequest), eq(listener));
+    }
+
+    private IndexMetadata indexMetadata(String indexName, boolean requestCacheEnabled) {
+        Settings.Builder settingsBuilder = Settings.builder()
+            .put(IndexMetadata.SETTING_VERSION_CREATED, Version.CURRENT)
+            .put(IndexMetadata.SETTING_NUMBER_OF_SHARDS, 1)
+            .put(IndexMetadata.SETTING_NUMBER_OF_REPLICAS, 0)
+            .put(IndexMetadata.SETTING_INDEX_UUID, UUIDs.randomBase64UUID())
+            .put(IndicesRequestCache.INDEX_CACHE_REQUEST_ENABLED_SETTING.getKey(), requestCacheEnabled);
+        return IndexMetadata.builder(indexName).settings(settingsBuilder).build();
+    }
+
+    private SearchRequest hybridSearchRequest() {
+        HybridQueryBuilder hybridQuery = new HybridQueryBuilder();
+        hybridQuery.add(new MatchQueryBuilder("field", "value"));
+        hybridQuery.add(new MatchAllQueryBuilder());
+        return new SearchRequest("test_index").source(new SearchSourceBuilder().query(hybridQuery).size(10));
+    }
 }
@@ -20,6 +20,7 @@ import java.util.ArrayList;
 import java.util.List;
 import java.util.Map;
 import java.util.concurrent.ConcurrentHashMap;
+import java.util.concurrent.atomic.AtomicLongArray;
 import java.util.concurrent.atomic.AtomicReferenceArray;
 
 import static org.opensearch.neuralsearch.stats.metrics.MemoryStat.BYTES_PER_KILOBYTES;
@@ -181,11 +182,14 @@ public class SparseMemoryStatsIT extends SparseBaseIT {
         long originalCircuitBreakerMemoryStatsSum = originalCircuitBreakerMemoryStats.stream().mapToLong(Long::longValue).sum();
         double currentSparseMemoryUsageSum = currentSparseMemoryUsageStats.stream().mapToDouble(Double::doubleValue).sum();
 
-        // Increase size consists of two cache keys, one array for forward index and one map for clustered posting
+        // Increase size consists of two cache keys, two arrays for forward index and one map for clustered posting
         CacheKey cacheKey = new CacheKey(TestsPrepareUtils.prepareSegmentInfo(), TestsPrepareUtils.prepareKeyFieldInfo());
         long cacheKeySize = RamUsageEstimator.shallowSizeOf(cacheKey);
+        int cachedDocWords = (docCount + Long.SIZE - 1) / Long.SIZE;
         long emptyForwardIndexSize = RamUsageEstimator.shallowSizeOf(new AtomicReferenceArray<>(docCount)) + RamUsageEstimator
-            .alignObjectSize((long) docCount * RamUsageEstimator.NUM_BYTES_OBJECT_REF);
+            .alignObjectSize((long) docCount * RamUsageEstimator.NUM_BYTES_OBJECT_REF) + RamUsageEstimator.shallowSizeOf(
+                new AtomicLongArray(cachedDocWords)
+            ) + RamUsageEstimator.alignObjectSize((long) cachedDocWords * Long.BYTES);
         long emptyClusteredPostingSize = RamUsageEstimator.shallowSizeOf(new ConcurrentHashMap<>());
 
         double expectedSize = (double) (cacheKeySize * 2 + emptyClusteredPostingSize + emptyForwardIndexSize) / BYTES_PER_KILOBYTES;
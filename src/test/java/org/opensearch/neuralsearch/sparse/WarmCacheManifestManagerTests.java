@@ -0,0 +1,123 @@
+/*
+ * Copyright OpenSearch Contributors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+package org.opensearch.neuralsearch.sparse;
+
+import org.junit.Before;
+import org.opensearch.common.unit.TimeValue;
+import org.opensearch.core.index.shard.ShardId;
+import org.opensearch.index.shard.IndexShard;
+import org.opensearch.threadpool.Scheduler;
+import org.opensearch.threadpool.ThreadPool;
+
+import java.util.concurrent.ExecutorService;
+
+import static org.mockito.ArgumentMatchers.any;
+import static org.mockito.ArgumentMatchers.anyString;
+import static org.mockito.ArgumentMatchers.eq;
+import static org.mockito.Mockito.mock;
+import static org.mockito.Mockito.never;
+import static org.mockito.Mockito.times;
+import static org.mockito.Mockito.verify;
+import static org.mockito.Mockito.when;
+
+public class WarmCacheManifestManagerTests extends AbstractSparseTestBase {
+
+    private ThreadPool threadPool;
+    private ExecutorService genericExecutor;
+    private Scheduler.Cancellable cancellable;
+    private WarmCacheManifestManager manager;
+
+    @Before
+    @Override
+    public void setUp() {
+        super.setUp();
+        threadPool = mock(ThreadPool.class);
+        genericExecutor = mock(ExecutorService.class);
+        cancellable = mock(Scheduler.Cancellable.class);
+        when(threadPool.generic()).thenReturn(genericExecutor);
+        when(threadPool.scheduleWithFixedDelay(any(Runnable.class), any(TimeValue.class), anyString())).thenReturn(cancellable);
+        manager = new WarmCacheManifestManager();
+    }
+
+    public void testGetInstance_returnsSingleton() {
+        assertSame(WarmCacheManifestManager.getInstance(), WarmCacheManifestManager.getInstance());
+    }
+
+    public void testInitialize_schedulesPersistTask() {
+        TimeValue interval = TimeValue.timeValueMinutes(1);
+        manager.initialize(threadPool, interval);
+
+        verify(threadPool).scheduleWithFixedDelay(any(Runnable.class), eq(interval), eq(ThreadPool.Names.GENERIC));
+    }
+
+    public void testSetPersistInterval_withZero_cancelsPersistTask() {
+        manager.initialize(threadPool, TimeValue.timeValueMinutes(1));
+        manager.setPersistInterval(TimeValue.ZERO);
+
+        verify(cancellable).cancel();
+    }
+
+    public void testOnShardStarted_whenEnabled_warmsUpInBackground() {
+        manager.initialize(threadPool, TimeValue.timeValueMinutes(1));
+        IndexShard indexShard = mock(IndexShard.class);
+        when(indexShard.shardId()).thenReturn(new ShardId("index", "uuid", 0));
+
+        manager.onShardStarted(indexShard);
+
+        verify(genericExecutor).execute(any(Runnable.class));
+    }
+
+    public void testOnShardStarted_whenDisabled_doesNotWarmUp() {
+        manager.initialize(threadPool, TimeValue.ZERO);
+        IndexShard indexShard = mock(IndexShard.class);
+        when(indexShard.shardId()).thenReturn(new ShardId("index", "uuid", 0));
+
+        manager.onShardStarted(indexShard);
+        manager.persistAll();
+
+        verify(threadPool, never()).scheduleWithFixedDelay(any(Runnable.class), any(TimeValue.class), anyString());
+        verify(genericExecutor, never()).execute(any(Runnable.class));
+        verify(indexShard, never()).acquireSearcher(anyString());
+    }
+
+    public void testSetPersistInterval_whenEnabledAfterShardStarted_warmsUpShardOnce() {
+        manager.initialize(threadPool, TimeValue.ZERO);
+        IndexShard indexShard = mock(IndexShard.class);
+        when(indexShard.shardId()).thenReturn(new ShardId("index", "uuid", 0));
+        manager.onShardStarted(indexShard);
+
+        manager.setPersistInterval(TimeValue.timeValueMinutes(1));
+        manager.setPersistInterval(TimeValue.timeValueMinutes(2));
+
+        verify(genericExecutor, times(1)).execute(any(Runnable.class));
+    }
+
+    public void testSetPersistInterval_whenEnabledAfterShardClosed_doesNotWarmUpShard() {
+        manager.initialize(threadPool, TimeValue.ZERO);
+        IndexShard indexShard = mock(IndexShard.class);
+        ShardId shardId = new ShardId("index", "uuid", 0);
+        when(indexShard.shardId()).thenReturn(shardId);
+        manager.onShardStarted(indexShard);
+        manager.onShardClosed(shardId);
+
+        manager.setPersistInterval(TimeValue.timeValueMinutes(1));
+
+        verify(genericExecutor, never()).execute(any(Runnable.class));
+    }
+
+    public void testOnShardClosed_unregistersShardWithoutPersisting() {
+        manager.initialize(threadPool, TimeValue.timeValueMinutes(1));
+        IndexShard indexShard = mock(IndexShard.class);
+        ShardId shardId = new ShardId("index", "uuid", 0);
+        when(indexShard.shardId()).thenReturn(shardId);
+        manager.onShardStarted(indexShard);
+
+        manager.onShardClosed(shardId);
+        manager.persistAll();
+
+        // Neither the close nor a later periodic persist touches the closed shard
+        verify(indexShard, never()).acquireSearcher(anyString());
+    }
+}
@@ -8,6 +8,7 @@ import org.apache.lucene.index.SegmentInfo;
 import org.opensearch.neuralsearch.sparse.AbstractSparseTestBase;
 
 import static org.mockito.ArgumentMatchers.any;
+import static org.mockito.Mockito.doReturn;
 import static org.mockito.Mockito.mock;
 import static org.mockito.Mockito.never;
 import static org.mockito.Mockito.spy;
@@ -166,6 +167,70 @@ public class AbstractLruCacheTests extends AbstractSparseTestBase {
         verify(testCache, times(1)).doEviction(key);
     }
 
+    /**
+     * Test that evictMatching only evicts items within the scope
+     */
+    public void test_evictMatching_onlyEvictsItemsInScope() {
+        TestLruCache testCache = spy(new TestLruCache());
+        TestLruCacheKey key1 = new TestLruCacheKey("key1");
+        TestLruCacheKey key2 = new TestLruCacheKey("key2");
+        TestLruCacheKey key3 = new TestLruCacheKey("key3");
+
+        testCache.updateAccess(key1);
+        testCache.updateAccess(key2);
+        testCache.updateAccess(key3);
+
+        testCache.evictMatching(100, cacheKey -> cacheKey.equals(key2.getCacheKey()));
+
+        assertTrue(testCache.accessRecencyMap.containsKey(key1));
+        assertFalse(testCache.accessRecencyMap.containsKey(key2));
+        assertTrue(testCache.accessRecencyMap.containsKey(key3));
+        verify(testCache, never()).doEviction(key1);
+        verify(testCache, never()).doEviction(key3);
+    }
+
+    /**
+     * Test that evictMatching evicts the least recently used items across the cache keys in scope first
+     */
+    public void test_evictMatching_evictsLeastRecentlyUsedAcrossCacheKeysInScope() {
+        TestLruCache testCache = spy(new TestLruCache());
+        TestLruCacheKey key1 = new TestLruCacheKey("key1");
+        TestLruCacheKey key2 = new TestLruCacheKey("key2");
+        TestLruCacheKey key3 = new TestLruCacheKey("key3");
+        doReturn(10L).when(testCache).doEviction(any());
+
+        testCache.updateAccess(key1);
+        testCache.updateAccess(key2);
+        testCache.updateAccess(key3);
+        testCache.updateAccess(key1);
+
+        long bytesFreed = testCache.evictMatching(10, cacheKey -> !cacheKey.equals(key3.getCacheKey()));
+
+        assertEquals(10, bytesFreed);
+        assertTrue(testCache.accessRecencyMap.containsKey(key1));
+        assertFalse(testCache.accessRecencyMap.containsKey(key2));
+        assertTrue(testCache.accessRecencyMap.containsKey(key3));
+        assertTrue(testCache.accessRecencyMapsByCacheKey.get(key2.getCacheKey()).isEmpty());
+    }
+
+    /**
+     * Test that evict for a requester without budgets falls back to the global LRU order
+     */
+    public void test_evict_withRequesterWithoutBudget_evictsGlobally() {
+        TestLruCache testCache = spy(new TestLruCache());
+        TestLruCacheKey key1 = new TestLruCacheKey("key1");
+        TestLruCacheKey key2 = new TestLruCacheKey("key2");
+
+        testCache.updateAccess(key1);
+        testCache.updateAccess(key2);
+
+        testCache.evict(key2.getCacheKey(), 100);
+
+        assertTrue(testCache.accessRecencyMap.isEmpty());
+        verify(testCache, times(1)).doEviction(key1);
+        verify(testCache, times(1)).doEviction(key2);
+    }
+
     /**
      * Test that evictItem correctly removes an item from the access map
      */
@@ -224,6 +289,7 @@ public class AbstractLruCacheTests extends AbstractSparseTestBase {
         testCache.onIndexRemoval(cacheKey);
 
         assertFalse(testCache.accessRecencyMap.containsKey(key));
+        assertFalse(testCache.accessRecencyMapsByCacheKey.containsKey(cacheKey));
     }
 
     /**
@@ -0,0 +1,88 @@
+/*
+ * Copyright OpenSearch Contributors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+package org.opensearch.neuralsearch.sparse.cache;
+
+import org.opensearch.neuralsearch.sparse.AbstractSparseTestBase;
+
+import java.util.concurrent.atomic.AtomicLong;
+
+public class BudgetedRamBytesRecorderTests extends AbstractSparseTestBase {
+
+    public void testRecord_withinBudget_recordsInChain() {
+        RamBytesRecorder root = new RamBytesRecorder();
+        BudgetedRamBytesRecorder index = new BudgetedRamBytesRecorder(root, () -> 100L);
+        BudgetedRamBytesRecorder field = new BudgetedRamBytesRecorder(index, () -> 50L);
+
+        assertTrue(field.record(40L));
+
+        assertEquals(40L, field.getBytes());
+        assertEquals(40L, index.getBytes());
+        assertEquals(40L, root.getBytes());
+    }
+
+    public void testRecord_exceedsOwnBudget_recordsNothing() {
+        RamBytesRecorder root = new RamBytesRecorder();
+        BudgetedRamBytesRecorder index = new BudgetedRamBytesRecorder(root, () -> 100L);
+        BudgetedRamBytesRecorder field = new BudgetedRamBytesRecorder(index, () -> 50L);
+
+        assertFalse(field.record(60L));
+
+        assertEquals(0L, field.getBytes());
+        assertEquals(0L, index.getBytes());
+        assertEquals(0L, root.getBytes());
+    }
+
+    public void testRecord_exceedsParentBudget_rollsBack() {
+        RamBytesRecorder root = new RamBytesRecorder((bytes, total) -> total <= 30L);
+        BudgetedRamBytesRecorder index = new BudgetedRamBytesRecorder(root, () -> SparseMemoryBudgetManager.UNLIMITED);
+
+        assertFalse(index.record(40L));
+
+        assertEquals(0L, index.getBytes());
+        assertEquals(0L, root.getBytes());
+    }
+
+    public void testRecord_withDynamicBudget_usesCurrentBudget() {
+        AtomicLong budget = new AtomicLong(10L);
+        BudgetedRamBytesRecorder recorder = new BudgetedRamBytesRecorder(new RamBytesRecorder(), budget::get);
+
+        assertFalse(recorder.record(20L));
+        budget.set(20L);
+        assertTrue(recorder.record(20L));
+        assertTrue(recorder.isOverBudget(1L));
+        assertEquals(20L, recorder.getBudget());
+    }
+
+    public void testRecordWithoutValidation_propagatesToParentAndRunsPostAction() {
+        RamBytesRecorder root = new RamBytesRecorder();
+        BudgetedRamBytesRecorder recorder = new BudgetedRamBytesRecorder(root, () -> 10L);
+        AtomicLong postActionBytes = new AtomicLong();
+
+        recorder.recordWithoutValidation(20L, postActionBytes::set);
+
+        assertEquals(20L, recorder.getBytes());
+        assertEquals(20L, root.getBytes());
+        assertEquals(20L, postActionBytes.get());
+    }
+
+    public void testReleaseFromBudgets_keepsRootUntouched() {
+        RamBytesRecorder root = new RamBytesRecorder();
+        BudgetedRamBytesRecorder index = new BudgetedRamBytesRecorder(root, () -> 100L);
+        BudgetedRamBytesRecorder field = new BudgetedRamBytesRecorder(index, () -> 100L);
+        field.record(30L);
+
+        field.releaseFromBudgets(30L);
+
+        assertEquals(0L, field.getBytes());
+        assertEquals(0L, index.getBytes());
+        assertEquals(30L, root.getBytes());
+    }
+
+    public void testIsOverBudget_withUnlimitedBudget_returnsFalse() {
+        BudgetedRamBytesRecorder recorder = new BudgetedRamBytesRecorder(new RamBytesRecorder(), () -> SparseMemoryBudgetManager.UNLIMITED);
+
+        assertFalse(recorder.isOverBudget(Long.MAX_VALUE / 2));
+    }
+}
@@ -292,4 +292,38 @@ public class ForwardIndexCacheItemTests extends AbstractSparseTestBase {
         assertEquals("Vector should be inserted successfully", vector, readVector);
         verify(mockHandler, never()).accept(anyLong());
     }
+
+    public void test_getCachedDocIdRanges_withInsertedVectors() {
+        SparseVectorWriter writer = cacheItem.getWriter();
+        writer.insert(1, createVector(1, 2));
+        writer.insert(2, createVector(1, 2));
+        writer.insert(5, createVector(1, 2));
+
+        assertArrayEquals(new int[] { 1, 3, 5, 6 }, cacheItem.getCachedDocIdRanges());
+    }
+
+    public void test_getCachedDocIdRanges_withErasedVectors() {
+        // the range crosses the boundary between two words of the resident docs bitset
+        ForwardIndexCacheItem cacheItem = new ForwardIndexCacheItem(cacheKey, 128, mockGlobalRamBytesRecorder);
+        CacheableSparseVectorWriter writer = cacheItem.getWriter();
+        for (int docId = 60; docId < 70; docId++) {
+            writer.insert(docId, createVector(1, 2));
+        }
+        assertArrayEquals(new int[] { 60, 70 }, cacheItem.getCachedDocIdRanges());
+
+        writer.erase(64);
+
+        assertArrayEquals(new int[] { 60, 64, 65, 70 }, cacheItem.getCachedDocIdRanges());
+    }
+
+    public void test_getCachedDocIdRanges_whenUnchanged_thenNotCollectedAgain() {
+        cacheItem.getWriter().insert(1, createVector(1, 2));
+        int[] ranges = cacheItem.getCachedDocIdRanges();
+
+        assertSame(ranges, cacheItem.getCachedDocIdRanges());
+    }
+
+    public void test_getCachedDocIdRanges_withEmptyCache() {
+        assertEquals(0, cacheItem.getCachedDocIdRanges().length);
+    }
 }
@@ -0,0 +1,155 @@
+/*
+ * Copyright OpenSearch Contributors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+package org.opensearch.neuralsearch.sparse.cache;
+
+import lombok.SneakyThrows;
+import org.apache.lucene.index.SegmentInfo;
+import org.junit.Before;
+import org.opensearch.common.settings.Settings;
+import org.opensearch.core.common.unit.ByteSizeValue;
+import org.opensearch.neuralsearch.sparse.AbstractSparseTestBase;
+import org.opensearch.neuralsearch.sparse.SparseSettings;
+import org.opensearch.neuralsearch.sparse.TestsPrepareUtils;
+
+import java.util.Map;
+import java.util.function.Predicate;
+
+public class SparseMemoryBudgetManagerTests extends AbstractSparseTestBase {
+    private static final String INDEX_NAME = "test_index";
+    private static final String OTHER_INDEX_NAME = "other_index";
+    private static final String FIELD_NAME = "sparse_field";
+
+    private SparseMemoryBudgetManager manager;
+    private SegmentInfo segmentInfo;
+    private SegmentInfo otherSegmentInfo;
+
+    @Before
+    @Override
+    @SneakyThrows
+    public void setUp() {
+        super.setUp();
+        manager = new SparseMemoryBudgetManager();
+        segmentInfo = TestsPrepareUtils.prepareSegmentInfo();
+        otherSegmentInfo = TestsPrepareUtils.prepareSegmentInfo();
+        manager.registerShard(INDEX_NAME, segmentInfo.dir);
+        manager.registerShard(OTHER_INDEX_NAME, otherSegmentInfo.dir);
+    }
+
+    public void testGetInstance_returnsSameInstance() {
+        assertSame(SparseMemoryBudgetManager.getInstance(), SparseMemoryBudgetManager.getInstance());
+    }
+
+    public void testResolveIndex_withRegisteredAndUnknownDirectories() {
+        assertEquals(INDEX_NAME, manager.resolveIndex(new CacheKey(segmentInfo, FIELD_NAME)));
+        assertNull(manager.resolveIndex(new CacheKey(TestsPrepareUtils.prepareSegmentInfo(), FIELD_NAME)));
+
+        manager.unregisterShard(segmentInfo.dir);
+        assertNull(manager.resolveIndex(new CacheKey(segmentInfo, FIELD_NAME)));
+    }
+
+    public void testGetRecorder_withUnregisteredIndex_returnsGlobalTracker() {
+        assertSame(mockedMemoryUsageTracker, manager.getRecorder(new CacheKey(segmentInfo, FIELD_NAME)));
+    }
+
+    public void testGetRecorder_withRegisteredIndex_enforcesIndexBudget() {
+        manager.registerIndex(INDEX_NAME, Settings.builder().put(SparseSettings.SPARSE_MEMORY_BUDGET, "100b").build());
+        RamBytesRecorder recorder = manager.getRecorder(new CacheKey(segmentInfo, FIELD_NAME));
+
+        assertTrue(recorder instanceof BudgetedRamBytesRecorder);
+        assertTrue(recorder.record(80L));
+        assertFalse(recorder.record(30L));
+
+        manager.updateIndexBudget(INDEX_NAME, new ByteSizeValue(200));
+        assertTrue(recorder.record(30L));
+        assertEquals(110L, manager.getStats().get(INDEX_NAME).getResidentBytes());
+    }
+
+    public void testGetRecorder_withFieldBudget_enforcesFieldBudget() {
+        manager.registerIndex(
+            INDEX_NAME,
+            Settings.builder().put(SparseSettings.SPARSE_FIELD_MEMORY_BUDGET_PREFIX + FIELD_NAME, "50b").build()
+        );
+        RamBytesRecorder fieldRecorder = manager.getRecorder(new CacheKey(segmentInfo, FIELD_NAME));
+        RamBytesRecorder otherFieldRecorder = manager.getRecorder(new CacheKey(segmentInfo, "other_field"));
+
+        assertFalse(fieldRecorder.record(60L));
+        assertTrue(otherFieldRecorder.record(60L));
+
+        manager.updateFieldBudgets(INDEX_NAME, Settings.builder().put(FIELD_NAME, "100b").build());
+        assertTrue(fieldRecorder.record(60L));
+    }
+
+    public void testGetOverBudgetScope_returnsFieldThenIndexScope() {
+        manager.registerIndex(
+            INDEX_NAME,
+            Settings.builder()
+                .put(SparseSettings.SPARSE_MEMORY_BUDGET, "100b")
+                .put(SparseSettings.SPARSE_FIELD_MEMORY_BUDGET_PREFIX + FIELD_NAME, "50b")
+                .build()
+        );
+        CacheKey requester = new CacheKey(segmentInfo, FIELD_NAME);
+        CacheKey otherField = new CacheKey(segmentInfo, "other_field");
+        CacheKey otherIndex = new CacheKey(otherSegmentInfo, FIELD_NAME);
+        manager.getRecorder(requester).record(40L);
+        manager.getRecorder(otherField).record(50L);
+
+        assertNull(manager.getOverBudgetScope(requester, 5L));
+
+        Predicate<CacheKey> fieldScope = manager.getOverBudgetScope(requester, 20L);
+        assertTrue(fieldScope.test(requester));
+        assertFalse(fieldScope.test(otherField));
+        assertFalse(fieldScope.test(otherIndex));
+
+        Predicate<CacheKey> indexScope = manager.getOverBudgetScope(otherField, 20L);
+        assertTrue(indexScope.test(requester));
+        assertTrue(indexScope.test(otherField));
+        assertFalse(indexScope.test(otherIndex));
+    }
+
+    public void testGetOverFairShareScope_returnsIndicesAboveFairShare() {
+        manager.registerIndex(INDEX_NAME, Settings.EMPTY);
+        manager.registerIndex(OTHER_INDEX_NAME, Settings.EMPTY);
+        MemoryUsageManager.getInstance().setCapacityBytes(100L);
+        try {
+            assertNull(manager.getOverFairShareScope());
+
+            manager.getRecorder(new CacheKey(segmentInfo, FIELD_NAME)).record(60L);
+            Predicate<CacheKey> scope = manager.getOverFairShareScope();
+
+            assertTrue(scope.test(new CacheKey(segmentInfo, FIELD_NAME)));
+            assertFalse(scope.test(new CacheKey(otherSegmentInfo, FIELD_NAME)));
+        } finally {
+            MemoryUsageManager.getInstance().setCapacityBytes(-1L);
+        }
+    }
+
+    public void testGetStats_reportsResidentBytesAndBudgets() {
+        manager.registerIndex(
+            INDEX_NAME,
+            Settings.builder()
+                .put(SparseSettings.SPARSE_MEMORY_BUDGET, "1kb")
+                .put(SparseSettings.SPARSE_FIELD_MEMORY_BUDGET_PREFIX + "budgeted_field", "100b")
+                .build()
+        );
+        manager.getRecorder(new CacheKey(segmentInfo, FIELD_NAME)).record(10L);
+
+        IndexMemoryBudgetStats stats = manager.getStats().get(INDEX_NAME);
+
+        assertEquals(10L, stats.getResidentBytes());
+        assertEquals(1024L, stats.getBudgetBytes());
+        assertEquals(Map.of(FIELD_NAME, 10L, "budgeted_field", 0L), stats.getFieldResidentBytes());
+        assertEquals(Map.of("budgeted_field", 100L), stats.getFieldBudgetBytes());
+    }
+
+    public void testRemoveIndex_dropsBudgetAndDirectories() {
+        manager.registerIndex(INDEX_NAME, Settings.EMPTY);
+
+        manager.removeIndex(INDEX_NAME);
+
+        assertFalse(manager.getStats().containsKey(INDEX_NAME));
+        assertNull(manager.resolveIndex(new CacheKey(segmentInfo, FIELD_NAME)));
+        assertEquals(OTHER_INDEX_NAME, manager.resolveIndex(new CacheKey(otherSegmentInfo, FIELD_NAME)));
+    }
+}
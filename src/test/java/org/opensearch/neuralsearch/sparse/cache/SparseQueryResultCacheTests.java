@@ -0,0 +1,112 @@
+/*
+ * Copyright OpenSearch Contributors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+package org.opensearch.neuralsearch.sparse.cache;
+
+import lombok.SneakyThrows;
+import org.apache.commons.lang3.tuple.Pair;
+import org.apache.lucene.index.IndexReader;
+import org.junit.Before;
+import org.opensearch.core.common.unit.ByteSizeValue;
+import org.opensearch.neuralsearch.sparse.AbstractSparseTestBase;
+import org.opensearch.neuralsearch.sparse.query.SparseQueryContext;
+
+import java.util.List;
+
+import static org.mockito.ArgumentMatchers.any;
+import static org.mockito.ArgumentMatchers.anyLong;
+import static org.mockito.ArgumentMatchers.eq;
+import static org.mockito.Mockito.doReturn;
+import static org.mockito.Mockito.mock;
+import static org.mockito.Mockito.never;
+import static org.mockito.Mockito.times;
+import static org.mockito.Mockito.verify;
+
+public class SparseQueryResultCacheTests extends AbstractSparseTestBase {
+
+    private static final String FIELD = "field";
+    private static final List<Pair<Integer, Integer>> RESULTS = List.of(Pair.of(1, 10), Pair.of(3, 30));
+
+    private SparseQueryResultCache cache;
+    private IndexReader.CacheHelper cacheHelper;
+    private IndexReader.CacheKey readerKey;
+    private SparseQueryContext queryContext;
+
+    @Before
+    @Override
+    @SneakyThrows
+    public void setUp() {
+        super.setUp();
+        cache = new SparseQueryResultCache(1024 * 1024);
+        cacheHelper = mock(IndexReader.CacheHelper.class);
+        readerKey = new IndexReader.CacheKey();
+        queryContext = constructSparseQueryContext(10, 1.0f, List.of("1", "2"));
+    }
+
+    public void testGet_afterPut_returnsResults() {
+        SparseQueryResultCache.Key key = new SparseQueryResultCache.Key(readerKey, FIELD, createVector(1, 1, 2, 2), queryContext);
+
+        cache.put(key, cacheHelper, RESULTS);
+
+        SparseQueryResultCache.Key sameKey = new SparseQueryResultCache.Key(readerKey, FIELD, createVector(1, 1, 2, 2), queryContext);
+        assertEquals(RESULTS, cache.get(sameKey));
+        assertTrue(cache.ramBytesUsed() > 0);
+        verify(mockedMemoryUsageTracker).record(cache.ramBytesUsed());
+        verify(cacheHelper).addClosedListener(any());
+    }
+
+    public void testGet_withDifferentQuery_returnsNull() {
+        cache.put(new SparseQueryResultCache.Key(readerKey, FIELD, createVector(1, 1, 2, 2), queryContext), cacheHelper, RESULTS);
+
+        assertNull(cache.get(new SparseQueryResultCache.Key(readerKey, FIELD, createVector(1, 1, 2, 3), queryContext)));
+        assertNull(cache.get(new SparseQueryResultCache.Key(readerKey, "other", createVector(1, 1, 2, 2), queryContext)));
+        assertNull(
+            cache.get(new SparseQueryResultCache.Key(new IndexReader.CacheKey(), FIELD, createVector(1, 1, 2, 2), queryContext))
+        );
+    }
+
+    public void testPut_whenDisabled_doesNothing() {
+        cache.setCapacity(ByteSizeValue.ZERO);
+        SparseQueryResultCache.Key key = new SparseQueryResultCache.Key(readerKey, FIELD, createVector(1, 1), queryContext);
+
+        cache.put(key, cacheHelper, RESULTS);
+
+        assertFalse(cache.isEnabled());
+        assertNull(cache.get(key));
+        verify(mockedMemoryUsageTracker, never()).record(anyLong());
+    }
+
+    public void testPut_whenMemoryNotAccounted_doesNotCache() {
+        doReturn(false).when(mockedMemoryUsageTracker).record(anyLong());
+        SparseQueryResultCache.Key key = new SparseQueryResultCache.Key(readerKey, FIELD, createVector(1, 1), queryContext);
+
+        cache.put(key, cacheHelper, RESULTS);
+
+        assertNull(cache.get(key));
+        verify(cacheHelper, never()).addClosedListener(any());
+    }
+
+    public void testInvalidate_releasesEntriesOfReader() {
+        SparseQueryResultCache.Key key = new SparseQueryResultCache.Key(readerKey, FIELD, createVector(1, 1), queryContext);
+        cache.put(key, cacheHelper, RESULTS);
+        long bytes = cache.ramBytesUsed();
+
+        cache.invalidate(readerKey);
+
+        assertNull(cache.get(key));
+        assertEquals(0, cache.ramBytesUsed());
+        verify(mockedMemoryUsageTracker).recordWithoutValidation(eq(-bytes), any());
+    }
+
+    public void testSetCapacity_evictsAndReleasesBytes() {
+        SparseQueryResultCache.Key key = new SparseQueryResultCache.Key(readerKey, FIELD, createVector(1, 1), queryContext);
+        cache.put(key, cacheHelper, RESULTS);
+
+        cache.setCapacity(new ByteSizeValue(1));
+
+        assertNull(cache.get(key));
+        assertEquals(0, cache.ramBytesUsed());
+        verify(mockedMemoryUsageTracker, times(1)).recordWithoutValidation(anyLong(), any());
+    }
+}
@@ -0,0 +1,61 @@
+/*
+ * Copyright OpenSearch Contributors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+package org.opensearch.neuralsearch.sparse.cache;
+
+import lombok.SneakyThrows;
+import org.apache.lucene.index.SegmentInfo;
+import org.apache.lucene.util.BytesRef;
+import org.opensearch.neuralsearch.sparse.AbstractSparseTestBase;
+import org.opensearch.neuralsearch.sparse.TestsPrepareUtils;
+
+import java.nio.file.Files;
+import java.nio.file.Path;
+import java.util.List;
+
+public class WarmCacheManifestTests extends AbstractSparseTestBase {
+
+    @SneakyThrows
+    public void test_writeToAndReadFrom_roundTrip() {
+        SegmentInfo segmentInfo = TestsPrepareUtils.prepareSegmentInfo();
+        WarmCacheManifest.Entry entry = new WarmCacheManifest.Entry(
+            segmentInfo,
+            "sparse_field",
+            List.of(new BytesRef("1000"), new BytesRef("2000")),
+            new int[] { 0, 3, 7, 8 }
+        );
+        Path path = createTempDir().resolve(WarmCacheManifest.FILE_NAME);
+
+        new WarmCacheManifest(List.of(entry)).writeTo(path);
+        WarmCacheManifest manifest = WarmCacheManifest.readFrom(path);
+
+        assertNotNull(manifest);
+        assertEquals(1, manifest.getEntries().size());
+        WarmCacheManifest.Entry readEntry = manifest.getEntries().get(0);
+        assertEquals(entry.getKey(), readEntry.getKey());
+        assertEquals(WarmCacheManifest.entryKey(segmentInfo, "sparse_field"), readEntry.getKey());
+        assertEquals(entry.getTerms(), readEntry.getTerms());
+        assertArrayEquals(entry.getDocIdRanges(), readEntry.getDocIdRanges());
+        assertFalse(Files.exists(path.resolveSibling(WarmCacheManifest.FILE_NAME + ".tmp")));
+    }
+
+    @SneakyThrows
+    public void test_readFrom_withMissingFile_returnsNull() {
+        assertNull(WarmCacheManifest.readFrom(createTempDir().resolve(WarmCacheManifest.FILE_NAME)));
+    }
+
+    public void test_toDocIdRanges_mergesConsecutiveDocIds() {
+        int[] ranges = WarmCacheManifest.toDocIdRanges(new int[] { 1, 2, 3, 5, 8, 9, 0 }, 6);
+
+        assertArrayEquals(new int[] { 1, 4, 5, 6, 8, 10 }, ranges);
+    }
+
+    public void test_toDocIdRanges_withNoDocIds() {
+        assertEquals(0, WarmCacheManifest.toDocIdRanges(new int[0], 0).length);
+    }
+
+    public void test_isEmpty() {
+        assertTrue(new WarmCacheManifest(List.of()).isEmpty());
+    }
+}
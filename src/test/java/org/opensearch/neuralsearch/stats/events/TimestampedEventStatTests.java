@@ -43,6 +43,16 @@ public class TimestampedEventStatTests extends OpenSearchTestCase {
         assertEquals(2, stat.getValue());
     }
 
+    public void test_add() {
+        stat.add(3);
+        assertEquals(3, stat.getValue());
+
+        currentTime += BUCKET_INTERVAL_MS;
+        stat.increment();
+        assertEquals(4, stat.getValue());
+        assertEquals(3, stat.getTrailingIntervalValue());
+    }
+
     public void test_trailingIntervalSingleBucket() {
         // Add events in same bucket
         for (int i = 0; i < 5; i++) {
@@ -0,0 +1,64 @@
+/*
+ * Copyright OpenSearch Contributors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+package org.opensearch.neuralsearch.transport;
+
+import org.opensearch.Version;
+import org.opensearch.cluster.ClusterName;
+import org.opensearch.cluster.node.DiscoveryNode;
+import org.opensearch.common.io.stream.BytesStreamOutput;
+import org.opensearch.common.xcontent.XContentFactory;
+import org.opensearch.core.common.io.stream.StreamInput;
+import org.opensearch.core.common.transport.TransportAddress;
+import org.opensearch.core.xcontent.ToXContent;
+import org.opensearch.core.xcontent.XContentBuilder;
+import org.opensearch.neuralsearch.sparse.AbstractSparseTestBase;
+import org.opensearch.neuralsearch.sparse.cache.IndexMemoryBudgetStats;
+
+import java.io.IOException;
+import java.net.InetAddress;
+import java.util.Collections;
+import java.util.List;
+import java.util.Map;
+
+public class NeuralSparseMemoryStatsResponseTests extends AbstractSparseTestBase {
+    private static final String NODE_ID = "node_1";
+
+    public void testSerialization_roundTrip() throws IOException {
+        NeuralSparseMemoryStatsResponse response = prepareResponse();
+
+        BytesStreamOutput output = new BytesStreamOutput();
+        response.writeTo(output);
+        StreamInput input = output.bytes().streamInput();
+        NeuralSparseMemoryStatsResponse deserialized = new NeuralSparseMemoryStatsResponse(input);
+
+        assertEquals(1, deserialized.getNodes().size());
+        assertEquals(NODE_ID, deserialized.getNodes().get(0).getNode().getId());
+        assertEquals(response.getNodes().get(0).getIndexStats(), deserialized.getNodes().get(0).getIndexStats());
+    }
+
+    public void testToXContent() throws IOException {
+        NeuralSparseMemoryStatsResponse response = prepareResponse();
+
+        XContentBuilder builder = XContentFactory.jsonBuilder();
+        response.toXContent(builder, ToXContent.EMPTY_PARAMS);
+
+        String expected = "{\"nodes\":{\"node_1\":{\"indices\":{\"test_index\":{\"resident_in_bytes\":100,\"budget_in_bytes\":1024,"
+            + "\"fields\":{\"sparse_field\":{\"resident_in_bytes\":100,\"budget_in_bytes\":-1}}}}}}}";
+        assertEquals(expected, builder.toString());
+    }
+
+    private NeuralSparseMemoryStatsResponse prepareResponse() {
+        DiscoveryNode node = new DiscoveryNode(
+            NODE_ID,
+            new TransportAddress(InetAddress.getLoopbackAddress(), 9300),
+            Collections.emptyMap(),
+            Collections.emptySet(),
+            Version.CURRENT
+        );
+        IndexMemoryBudgetStats stats = new IndexMemoryBudgetStats(100L, 1024L, Map.of("sparse_field", 100L), Map.of());
+        NeuralSparseMemoryStatsNodeResponse nodeResponse = new NeuralSparseMemoryStatsNodeResponse(node, Map.of("test_index", stats));
+        return new NeuralSparseMemoryStatsResponse(new ClusterName("test"), List.of(nodeResponse), List.of());
+    }
+}
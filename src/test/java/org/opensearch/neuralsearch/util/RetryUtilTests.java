@@ -0,0 +1,127 @@
+/*
+ * Copyright OpenSearch Contributors
+ * SPDX-License-Identifier: Apache-2.0
+ */
+package org.opensearch.neuralsearch.util;
+
+import org.junit.After;
+import org.junit.Before;
+import org.mockito.ArgumentCaptor;
+import org.opensearch.cluster.node.DiscoveryNode;
+import org.opensearch.common.unit.TimeValue;
+import org.opensearch.core.action.ActionListener;
+import org.opensearch.test.OpenSearchTestCase;
+import org.opensearch.threadpool.ThreadPool;
+import org.opensearch.transport.NodeNotConnectedException;
+
+import static org.mockito.ArgumentMatchers.any;
+import static org.mockito.ArgumentMatchers.eq;
+import static org.mockito.Mockito.mock;
+import static org.mockito.Mockito.never;
+import static org.mockito.Mockito.verify;
+import static org.mockito.Mockito.verifyNoInteractions;
+
+public class RetryUtilTests extends OpenSearchTestCase {
+
+    private ThreadPool threadPool;
+    private ActionListener<Object> listener;
+    private Runnable retryAction;
+    private NodeNotConnectedException retryableException;
+
+    @Before
+    public void setup() {
+        TestUtils.initializeEventStatsManager();
+        threadPool = mock(ThreadPool.class);
+        listener = mock(ActionListener.class);
+        retryAction = mock(Runnable.class);
+        retryableException = new NodeNotConnectedException(mock(DiscoveryNode.class), "Node not connected");
+        RetryUtil.initialize(threadPool, 1);
+    }
+
+    @After
+    public void cleanup() {
+        RetryUtil.reset();
+    }
+
+    public void testHandleRetryOrFailure_whenRetryable_thenScheduledWithoutBlocking() {
+        RetryUtil.handleRetryOrFailure(retryableException, 0, retryAction, listener);
+
+        ArgumentCaptor<Runnable> retryCaptor = ArgumentCaptor.forClass(Runnable.class);
+        ArgumentCaptor<TimeValue> delayCaptor = ArgumentCaptor.forClass(TimeValue.class);
+        verify(threadPool).schedule(retryCaptor.capture(), delayCaptor.capture(), eq(ThreadPool.Names.GENERIC));
+        verifyNoInteractions(retryAction);
+        assertEquals(1, RetryUtil.getPendingRetries());
+        assertTrue(delayCaptor.getValue().millis() >= 250 && delayCaptor.getValue().millis() <= 500);
+
+        retryCaptor.getValue().run();
+
+        verify(retryAction).run();
+        assertEquals(0, RetryUtil.getPendingRetries());
+        verifyNoInteractions(listener);
+    }
+
+    public void testHandleRetryOrFailure_whenNotInitialized_thenFailWithoutRetry() {
+        RetryUtil.reset();
+
+        RetryUtil.handleRetryOrFailure(retryableException, 0, retryAction, listener);
+
+        verify(listener).onFailure(retryableException);
+        verifyNoInteractions(threadPool, retryAction);
+        assertEquals(0, RetryUtil.getPendingRetries());
+    }
+
+    public void testInitialize_whenThreadPoolNull_thenFail() {
+        expectThrows(NullPointerException.class, () -> RetryUtil.initialize(null, 1));
+    }
+
+    public void testHandleRetryOrFailure_whenNotRetryable_thenFail() {
+        IllegalStateException exception = new IllegalStateException("invalid model");
+
+        RetryUtil.handleRetryOrFailure(exception, 0, retryAction, listener);
+
+        verify(listener).onFailure(exception);
+        verifyNoInteractions(threadPool, retryAction);
+    }
+
+    public void testHandleRetryOrFailure_whenMaxRetriesReached_thenGiveUp() {
+        RetryUtil.handleRetryOrFailure(retryableException, 3, retryAction, listener);
+
+        verify(listener).onFailure(retryableException);
+        verifyNoInteractions(threadPool, retryAction);
+    }
+
+    public void testHandleRetryOrFailure_whenBudgetExhausted_thenGiveUp() {
+        ActionListener<Object> secondListener = mock(ActionListener.class);
+        RetryUtil.handleRetryOrFailure(retryableException, 0, retryAction, listener);
+
+        RetryUtil.handleRetryOrFailure(retryableException, 0, retryAction, secondListener);
+
+        verify(secondListener).onFailure(retryableException);
+        verify(listener, never()).onFailure(any());
+        assertEquals(1, RetryUtil.getPendingRetries());
+
+        ArgumentCaptor<Runnable> retryCaptor = ArgumentCaptor.forClass(Runnable.class);
+        verify(threadPool).schedule(retryCaptor.capture(), any(TimeValue.class), eq(ThreadPool.Names.GENERIC));
+        retryCaptor.getValue().run();
+        assertEquals(0, RetryUtil.getPendingRetries());
+    }
+
+    public void testHandleRetryOrFailure_whenRetryActionThrows_thenFailListener() {
+        RuntimeException exception = new RuntimeException("retry failed");
+        RetryUtil.handleRetryOrFailure(retryableException, 0, () -> { throw exception; }, listener);
+        ArgumentCaptor<Runnable> retryCaptor = ArgumentCaptor.forClass(Runnable.class);
+        verify(threadPool).schedule(retryCaptor.capture(), any(TimeValue.class), eq(ThreadPool.Names.GENERIC));
+
+        retryCaptor.getValue().run();
+
+        verify(listener).onFailure(exception);
+    }
+
+    public void testCalculateBackoffTime_thenExponentialWithJitter() {
+        for (int retryTime = 0; retryTime < 3; retryTime++) {
+            long backoffTime = RetryUtil.calculateBackoffTime(retryTime);
+            long maxBackoffTime = 500L << retryTime;
+            assertTrue(backoffTime >= maxBackoffTime / 2 && backoffTime <= maxBackoffTime);
+        }
+    }
+}